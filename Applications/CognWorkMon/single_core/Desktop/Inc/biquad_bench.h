@@ -0,0 +1,33 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Author:          Stefano Albini                  //
+// Contributions:   Dimitrios Samakovlis            //
+// Date:            September 2023                  //
+//////////////////////////////////////////////////////
+
+#ifndef BIQUAD_BENCH_H
+#define BIQUAD_BENCH_H
+
+// Filters CH_TO_STORE synthetic channels with biquad_filter (one channel after the other),
+// biquad_filter_mc_c and biquad_filter_mc, window by window, prints the samples per second of
+// each and the largest difference to biquad_filter (the tolerance is 0: the outputs are the same).
+// Started with "CognWorkMon biquadbench"; returns 0 when all the outputs match.
+int biquad_bench(void);
+
+#endif
@@ -38,4 +38,26 @@ typedef struct
 void init_filter(filter_instance *S, uint8_t numStages, my_int *pCoeffs, my_int *pState);
 void biquad_filter(filter_instance *S, my_int *pSrc, my_int *pDst, my_int blockSize);
 
+#define BIQ_MAX_CH      4   // channels filtered together by biquad_filter_mc
+#define BIQ_MC_STAGES   8   // max stages of the AVX2 version, more stages use biquad_filter_mc_c
+
+// Cascade of filter_instance applied to up to BIQ_MAX_CH channels that share the coefficients.
+// The state is stored with the channels contiguous (SoA), 4*BIQ_MAX_CH values per stage:
+// pState[(4*stage + k)*BIQ_MAX_CH + ch] with k = 0..3 for x[n-1], x[n-2], y[n-1], y[n-2]
+typedef struct
+{
+    uint32_t numStages;
+    uint32_t numChannels;
+    my_int *pState;
+    my_int *pCoeffs;
+} filter_instance_mc;
+
+void init_filter_mc(filter_instance_mc *S, uint8_t numStages, uint8_t numChannels, my_int *pCoeffs, my_int *pState);
+// Filters pSrc[ch] into pDst[ch] (can be the same buffer) for each channel, with the same output as
+// biquad_filter on each channel. The samples go through all the stages one after the other, with
+// the channels in the lanes of an AVX2 vector when the CPU has it.
+void biquad_filter_mc(filter_instance_mc *S, my_int *pSrc[], my_int *pDst[], my_int blockSize);
+// Portable version of biquad_filter_mc
+void biquad_filter_mc_c(filter_instance_mc *S, my_int *pSrc[], my_int *pDst[], my_int blockSize);
+
 #endif
\ No newline at end of file
@@ -56,6 +56,11 @@ typedef struct{
 
 unsigned int FeatureExtraction(my_int *features, my_int *sig, uint8_t channel);
 
+// Rebuilds the trees of the forest from the branches of model_18.h, with the thresholds in fixed point.
+// Called by decisionTreeFun if needed. Returns 0 if the branches do not form binary trees, in which
+// case decisionTreeFun scans the branches.
+int DecisionForest_Init(void);
+
 int decisionTreeFun(my_int x[]);
 
 #endif
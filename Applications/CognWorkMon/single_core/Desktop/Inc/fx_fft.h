@@ -21,9 +21,29 @@
 // Date:            September 2023                  //
 //////////////////////////////////////////////////////
 
+#ifndef FX_FFT_H
+#define FX_FFT_H
+
 #include <stdint.h>
 #include <main.h>
+#include <window_definitions.h>
+
+#define FFT_SIZE WINDOW_LENGTH
+
+// Real FFT of FFT_SIZE samples with its own workspace and bit reversal table: each caller
+// (e.g. each channel) keeps its plan, so the transforms need no allocation and can run in parallel.
+typedef struct {
+  uint32_t num_bits;
+  uint16_t bit_reverse[FFT_SIZE / 2];  // ReverseBits(i, num_bits)
+  my_int re[FFT_SIZE / 2 + 1];
+  my_int im[FFT_SIZE / 2 + 1];
+} fft_plan_t;
 
+void fft_plan_init(fft_plan_t *plan);
+// Full spectrum (FFT_SIZE bins) of the FFT_SIZE real samples of input
+void fft_plan_exec(fft_plan_t *plan, const my_int *input, my_int *outputR, my_int *outputI);
+
+// Same transform with a plan shared by all the callers
 void init();
 void fft(my_int *input, my_int *outputR, my_int *outputI);
 
@@ -33,4 +53,6 @@ uint32_t ReverseBits ( uint32_t index, uint32_t NumBits );
 uint32_t NumberOfBitsNeeded ( uint32_t nsample );
 
 // Iterative radix2 implementation with input in bit reversed order
-void fft_cplx_radix2_iter  (my_int *Real_Out, my_int *Imag_Out, int32_t fft_size, int32_t nbits, my_int *re_factors, my_int *im_factors);
\ No newline at end of file
+void fft_cplx_radix2_iter  (my_int *Real_Out, my_int *Imag_Out, int32_t fft_size, int32_t nbits, my_int *re_factors, my_int *im_factors);
+
+#endif
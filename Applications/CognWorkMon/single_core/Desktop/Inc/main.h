@@ -33,6 +33,9 @@
 
 #define APPLY_BLINK_REMOVAL
 #define FILTER_ACTIVE
+// #define PARALLEL_CHANNELS    // one thread per channel for the blink removal, filter and feature extraction of a window
+#define MULTICHANNEL_BIQUAD     // without PARALLEL_CHANNELS, filter the 4 channels of a window together (biquad_filter_mc)
+#define COMPILED_FOREST         // classify with the trees rebuilt from model_18.h at init instead of scanning all the branches
 
 // defines the number of halfindow to process before the script terminates
 // If the input data is not enough, they are repeated in a cyclic way
@@ -25,12 +25,14 @@
 #define POWER_FEAT_EXTRACTION_H
 
 #include <featureExtraction.h>
+#include <fx_fft.h>
 
 int8_t PowerFeatureExtractionInit(uint16_t fftSize, unsigned short samp_freq, uint8_t nBatches, uint8_t nchannels);
 int8_t PowerFeatures_BatchCalc(my_int *sig, uint8_t channel);
 void PowerFeatures_GetFeat(my_int *features, uint8_t channel);
 void Psd(my_int *periodogram, my_int *power_density, int sampling_frequency, int numel_power);
-void Periodogram(my_int *sig, my_int *periodogram, int numel_sig);
+// spectrum is a work buffer of 3*numel_sig
+void Periodogram(fft_plan_t *plan, my_int *spectrum, my_int *sig, my_int *periodogram, int numel_sig);
 my_int Bpower(my_int *power_density, my_int f1, my_int f2, my_int frequency_resolution);
 
 void endPowerModule();
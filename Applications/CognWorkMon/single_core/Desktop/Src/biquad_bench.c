@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Author:          Stefano Albini                  //
+// Contributions:   Dimitrios Samakovlis            //
+// Date:            September 2023                  //
+//////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <main.h>
+#include <biquad_filter.h>
+#include <utils_functions.h>
+#include <filter_signal_param.h>
+#include <window_definitions.h>
+#include <biquad_bench.h>
+
+#define BENCH_WINDOWS   16
+#define BENCH_LEN       (BENCH_WINDOWS * WINDOW_LENGTH)
+#define REPEAT          20
+#define TWO_PI          6.283185307179586
+
+static my_int input[CH_TO_STORE][BENCH_LEN];
+static my_int out_ref[CH_TO_STORE][BENCH_LEN];
+static my_int out_mc[CH_TO_STORE][BENCH_LEN];
+
+static my_int coeffs[SOS_N_BIQUAD * 6];
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// biquad_filter on each channel, as the pipeline does
+static void run_single(void)
+{
+    my_int state[CH_TO_STORE][SOS_N_SAMPLES_NEEDED];
+    filter_instance S[CH_TO_STORE];
+
+    for (int ch = 0; ch < CH_TO_STORE; ch++)
+        init_filter(&S[ch], SOS_N_BIQUAD, coeffs, state[ch]);
+
+    for (int w = 0; w < BENCH_WINDOWS; w++)
+        for (int ch = 0; ch < CH_TO_STORE; ch++)
+            biquad_filter(&S[ch], &input[ch][w * WINDOW_LENGTH], &out_ref[ch][w * WINDOW_LENGTH], WINDOW_LENGTH);
+}
+
+static void run_mc(void (*filter)(filter_instance_mc *, my_int *[], my_int *[], my_int))
+{
+    my_int state[SOS_N_SAMPLES_NEEDED * BIQ_MAX_CH];
+    filter_instance_mc S;
+    my_int *src[CH_TO_STORE], *dst[CH_TO_STORE];
+
+    init_filter_mc(&S, SOS_N_BIQUAD, CH_TO_STORE, coeffs, state);
+
+    for (int w = 0; w < BENCH_WINDOWS; w++)
+    {
+        for (int ch = 0; ch < CH_TO_STORE; ch++)
+        {
+            src[ch] = &input[ch][w * WINDOW_LENGTH];
+            dst[ch] = &out_mc[ch][w * WINDOW_LENGTH];
+        }
+        filter(&S, src, dst, WINDOW_LENGTH);
+    }
+}
+
+static my_int max_diff(void)
+{
+    my_int diff = 0;
+    for (int ch = 0; ch < CH_TO_STORE; ch++)
+        for (int n = 0; n < BENCH_LEN; n++)
+            diff = abs(out_mc[ch][n] - out_ref[ch][n]) > diff ? abs(out_mc[ch][n] - out_ref[ch][n]) : diff;
+    return diff;
+}
+
+int biquad_bench(void)
+{
+    double best[3] = {1e9, 1e9, 1e9};
+    my_int diff[2];
+    const char *names[3] = {"biquad_filter x4", "biquad_filter_mc_c", "biquad_filter_mc"};
+
+    convert_to_x(sos_filter_arm_biquad_second, coeffs, SOS_N_BIQUAD * 6, N_DEC_BIQ);
+
+    // EEG-like test signal: a few rhythms, a drift and some noise, in uV
+    srand(1);
+    for (int ch = 0; ch < CH_TO_STORE; ch++)
+        for (int n = 0; n < BENCH_LEN; n++)
+        {
+            double t = (double)n / SAMPLING_FREQ;
+            double v = 20.0 * sin(TWO_PI * (10.0 + ch) * t) + 10.0 * sin(TWO_PI * 22.0 * t + ch) + 30.0 * sin(TWO_PI * 0.2 * t) +
+                       5.0 * ((double)rand() / RAND_MAX - 0.5);
+            input[ch][n] = fx_dtox(v, N_DEC_BIQ);
+        }
+
+    for (int r = 0; r < REPEAT; r++)
+    {
+        double start = now();
+        run_single();
+        double t0 = now();
+        run_mc(biquad_filter_mc_c);
+        double t1 = now();
+        if (r == 0)
+            diff[0] = max_diff();
+        run_mc(biquad_filter_mc);
+        double t2 = now();
+        if (r == 0)
+            diff[1] = max_diff();
+
+        best[0] = t0 - start < best[0] ? t0 - start : best[0];
+        best[1] = t1 - t0 < best[1] ? t1 - t0 : best[1];
+        best[2] = t2 - t1 < best[2] ? t2 - t1 : best[2];
+    }
+
+    printf("%d channels x %d samples, %d stages\n", CH_TO_STORE, BENCH_LEN, SOS_N_BIQUAD);
+    printf("filter                Msamples/s  speedup  max diff\n");
+    for (int k = 0; k < 3; k++)
+    {
+        printf("%-20s  %10.2f  %6.2fx", names[k], CH_TO_STORE * (double)BENCH_LEN / best[k] * 1e-6, best[0] / best[k]);
+        if (k > 0)
+            printf("  %8d", (int)diff[k - 1]);
+        printf("\n");
+    }
+    return diff[0] != 0 || diff[1] != 0;
+}
@@ -112,3 +112,149 @@ void biquad_filter(filter_instance *S, my_int *pSrc, my_int *pDst, my_int blockS
 
     } while (stage > 0u);
 }
+
+//Initializes a multichannel filter instance: all the channels start from a zero state
+void init_filter_mc(filter_instance_mc *S, uint8_t numStages, uint8_t numChannels, my_int *pCoeffs, my_int *pState)
+{
+    S->numStages = numStages;
+    S->numChannels = numChannels;
+    S->pCoeffs = pCoeffs;
+    memset(pState, 0, (4u * (uint32_t)numStages * BIQ_MAX_CH) * sizeof(my_int));
+    S->pState = pState;
+}
+
+void biquad_filter_mc_c(filter_instance_mc *S, my_int *pSrc[], my_int *pDst[], my_int blockSize)
+{
+    my_int x[BIQ_MAX_CH];                  /*  sample of each channel through the stages */
+    my_int acc;
+    uint32_t ch, stage;
+
+    for (my_int n = 0; n < blockSize; n++)
+    {
+        for (ch = 0; ch < BIQ_MAX_CH; ch++)
+            x[ch] = ch < S->numChannels ? pSrc[ch][n] : 0;
+
+        for (stage = 0; stage < S->numStages; stage++)
+        {
+            my_int *c = &S->pCoeffs[5 * stage];
+            my_int *st = &S->pState[4 * BIQ_MAX_CH * stage];
+
+            for (ch = 0; ch < BIQ_MAX_CH; ch++)
+            {
+                acc = fx_mulx(c[0], x[ch], N_DEC_BIQ) + fx_mulx(c[1], st[ch], N_DEC_BIQ) + fx_mulx(c[2], st[BIQ_MAX_CH + ch], N_DEC_BIQ) +
+                      fx_mulx(c[3], st[2 * BIQ_MAX_CH + ch], N_DEC_BIQ) + fx_mulx(c[4], st[3 * BIQ_MAX_CH + ch], N_DEC_BIQ);
+
+                st[BIQ_MAX_CH + ch] = st[ch];
+                st[ch] = x[ch];
+                st[3 * BIQ_MAX_CH + ch] = st[2 * BIQ_MAX_CH + ch];
+                st[2 * BIQ_MAX_CH + ch] = acc;
+                x[ch] = acc;
+            }
+        }
+
+        for (ch = 0; ch < S->numChannels; ch++)
+            pDst[ch][n] = x[ch];
+    }
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && N_DEC_BIQ > 0
+#include <immintrin.h>
+
+#define AVX2 __attribute__((target("avx2")))
+
+// fx_mulx(c, x, N_DEC_BIQ) in each 64-bit lane. vpmuldq reads the low 32 bits of the lanes, and
+// only the low 32 bits of the result are kept, which the logical shifts give the same as the
+// arithmetic ones of fx_mulx. The high halves of the lanes are garbage.
+AVX2 static inline __m256i mulx_lanes(__m256i c, __m256i x)
+{
+    __m256i p = _mm256_srli_epi64(_mm256_mul_epi32(c, x), N_DEC_BIQ - 1);
+    return _mm256_srli_epi64(_mm256_add_epi64(p, _mm256_set1_epi64x(1)), 1);
+}
+
+AVX2 static void biquad_filter_mc_avx2(filter_instance_mc *S, my_int *pSrc[], my_int *pDst[], my_int blockSize)
+{
+    __m256i coef[5 * BIQ_MC_STAGES];
+    __m256i xn1[BIQ_MC_STAGES], xn2[BIQ_MC_STAGES], yn1[BIQ_MC_STAGES], yn2[BIQ_MC_STAGES];
+    my_int *src[BIQ_MAX_CH], *dst[BIQ_MAX_CH], inc[BIQ_MAX_CH];
+    my_int zero = 0, discard;
+    uint32_t ch, stage, numStages = S->numStages;
+    my_int lanes[BIQ_MAX_CH];
+
+    // the lanes of missing channels stay on a zero input and a discarded output
+    for (ch = 0; ch < BIQ_MAX_CH; ch++)
+    {
+        inc[ch] = ch < S->numChannels;
+        src[ch] = inc[ch] ? pSrc[ch] : &zero;
+        dst[ch] = inc[ch] ? pDst[ch] : &discard;
+    }
+
+    for (stage = 0; stage < numStages; stage++)
+    {
+        my_int *st = &S->pState[4 * BIQ_MAX_CH * stage];
+        for (int k = 0; k < 5; k++)
+            coef[5 * stage + k] = _mm256_set1_epi64x(S->pCoeffs[5 * stage + k]);
+        xn1[stage] = _mm256_cvtepi32_epi64(_mm_loadu_si128((__m128i *)&st[0]));
+        xn2[stage] = _mm256_cvtepi32_epi64(_mm_loadu_si128((__m128i *)&st[BIQ_MAX_CH]));
+        yn1[stage] = _mm256_cvtepi32_epi64(_mm_loadu_si128((__m128i *)&st[2 * BIQ_MAX_CH]));
+        yn2[stage] = _mm256_cvtepi32_epi64(_mm_loadu_si128((__m128i *)&st[3 * BIQ_MAX_CH]));
+    }
+
+    for (my_int n = 0; n < blockSize; n++)
+    {
+        __m256i x = _mm256_set_epi64x(*src[3], *src[2], *src[1], *src[0]);
+
+        for (stage = 0; stage < numStages; stage++)
+        {
+            __m256i *c = &coef[5 * stage];
+            __m256i acc = _mm256_add_epi64(_mm256_add_epi64(mulx_lanes(c[0], x), mulx_lanes(c[1], xn1[stage])),
+                                           _mm256_add_epi64(mulx_lanes(c[2], xn2[stage]), mulx_lanes(c[3], yn1[stage])));
+            acc = _mm256_add_epi64(acc, mulx_lanes(c[4], yn2[stage]));
+
+            xn2[stage] = xn1[stage];
+            xn1[stage] = x;
+            yn2[stage] = yn1[stage];
+            yn1[stage] = acc;
+            x = acc;
+        }
+
+        // low 32 bits of the 4 lanes
+        _mm_storeu_si128((__m128i *)lanes, _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6))));
+        for (ch = 0; ch < BIQ_MAX_CH; ch++)
+        {
+            *dst[ch] = lanes[ch];
+            src[ch] += inc[ch];
+            dst[ch] += inc[ch];
+        }
+    }
+
+    for (stage = 0; stage < numStages; stage++)
+    {
+        my_int *st = &S->pState[4 * BIQ_MAX_CH * stage];
+        __m256i pick = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+        _mm_storeu_si128((__m128i *)&st[0], _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(xn1[stage], pick)));
+        _mm_storeu_si128((__m128i *)&st[BIQ_MAX_CH], _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(xn2[stage], pick)));
+        _mm_storeu_si128((__m128i *)&st[2 * BIQ_MAX_CH], _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(yn1[stage], pick)));
+        _mm_storeu_si128((__m128i *)&st[3 * BIQ_MAX_CH], _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(yn2[stage], pick)));
+    }
+}
+
+void biquad_filter_mc(filter_instance_mc *S, my_int *pSrc[], my_int *pDst[], my_int blockSize)
+{
+    static int avx2 = -1;
+    if (avx2 < 0)
+    {
+        __builtin_cpu_init();
+        avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+
+    if (avx2 && S->numStages <= BIQ_MC_STAGES)
+        biquad_filter_mc_avx2(S, pSrc, pDst, blockSize);
+    else
+        biquad_filter_mc_c(S, pSrc, pDst, blockSize);
+}
+#else
+void biquad_filter_mc(filter_instance_mc *S, my_int *pSrc[], my_int *pDst[], my_int blockSize)
+{
+    biquad_filter_mc_c(S, pSrc, pDst, blockSize);
+}
+#endif
@@ -33,9 +33,8 @@ _features_t features_eeg;
 
 unsigned int FeatureExtraction(my_int *features, my_int *sig, uint8_t channel)
 {
-	static unsigned char status = 0;
-	static unsigned short sampling_frequency = SAMPLING_FREQ;
-	static uint8_t num_bins; // used for histogram
+	unsigned char status = 0; // not static: the channels can be processed in parallel
+	uint8_t num_bins; // used for histogram
 	my_int *cpy_data_feat, *hist;
 
 	num_bins = StatisticalFeatures_ReturnHistogramNBins();
@@ -85,6 +84,108 @@ unsigned int FeatureExtraction(my_int *features, my_int *sig, uint8_t channel)
 }
 
 // <-------------- DECISION TREE --------------->
+
+#define MAX_BRANCHES    (sizeof(CLASS_LABELS[0]) / sizeof(CLASS_LABELS[0][0]))
+#define FOREST_MAX_NODES (NO_BAGS * MAX_BRANCHES)
+#define NODE_EMPTY      INT16_MIN
+#define LEAF(label)     (-1 - (int16_t)(label))
+
+// A test of a tree. child[0] is taken when x[feature] < threshold and child[1] otherwise.
+// A child >= 0 is the index of the next node, and a child < 0 is the leaf LEAF(label).
+typedef struct {
+	my_int threshold;
+	uint8_t feature;
+	int16_t child[2];
+} forest_node_t;
+
+static forest_node_t forest_nodes[FOREST_MAX_NODES];
+static int16_t forest_roots[NO_BAGS];
+static int8_t forest_status = -1; // -1: not built, 0: the branches are not trees, 1: built
+
+static int16_t forest_new_node(uint16_t *n_nodes)
+{
+	if (*n_nodes >= FOREST_MAX_NODES)
+		return NODE_EMPTY;
+	forest_nodes[*n_nodes].feature = 0xff; // no test yet
+	forest_nodes[*n_nodes].child[0] = NODE_EMPTY;
+	forest_nodes[*n_nodes].child[1] = NODE_EMPTY;
+	return (*n_nodes)++;
+}
+
+// Each branch of a bag is the path from the root to a leaf: its tests are merged into the nodes of
+// the previous branches when they share them. BRANCH_LOGIC 1 is the x < value side, 0 the x >= value one.
+int DecisionForest_Init(void)
+{
+	uint16_t n_nodes = 0;
+
+	forest_status = 0;
+	for (uint16_t bagi = 0; bagi < NO_BAGS; bagi++)
+	{
+		forest_roots[bagi] = forest_new_node(&n_nodes);
+		if (forest_roots[bagi] == NODE_EMPTY)
+			return 0;
+
+		for (uint16_t bi = 0; bi < NO_BRANCHES[bagi]; bi++)
+		{
+			int16_t node = forest_roots[bagi];
+			for (uint16_t ni = 0; ni < BRANCH_LENGTHS[bagi][bi]; ni++)
+			{
+				forest_node_t *n = &forest_nodes[node];
+				my_int threshold = fx_ftox(BRANCH_VALUES[bagi][bi][ni], N_DEC_PSD);
+				uint8_t feature = BRANCH_VECTOR_INDEX[bagi][bi][ni] - 1;
+				uint8_t side = (BRANCH_LOGIC[bagi][bi][ni] == 1) ? 0 : 1;
+
+				if (BRANCH_LOGIC[bagi][bi][ni] > 1)
+					return 0;
+				if (n->feature == 0xff)
+				{
+					n->feature = feature;
+					n->threshold = threshold;
+				}
+				else if (n->feature != feature || n->threshold != threshold)
+				{
+					return 0;
+				}
+
+				if (ni == BRANCH_LENGTHS[bagi][bi] - 1)
+				{
+					if (n->child[side] != NODE_EMPTY)
+						return 0;
+					n->child[side] = LEAF(CLASS_LABELS[bagi][bi]);
+				}
+				else
+				{
+					if (n->child[side] == NODE_EMPTY)
+					{
+						int16_t next = forest_new_node(&n_nodes);
+						if (next == NODE_EMPTY)
+							return 0;
+						n->child[side] = next;
+					}
+					if (n->child[side] < 0)
+						return 0;
+					node = n->child[side];
+				}
+			}
+			if (BRANCH_LENGTHS[bagi][bi] == 0)
+				return 0;
+		}
+	}
+
+	// no branch of the scan matches there: the bag votes 0 like in the scan
+	for (uint16_t k = 0; k < n_nodes; k++)
+	{
+		if (forest_nodes[k].feature == 0xff)
+			return 0;
+		for (uint8_t side = 0; side < 2; side++)
+			if (forest_nodes[k].child[side] == NODE_EMPTY)
+				forest_nodes[k].child[side] = LEAF(0);
+	}
+
+	forest_status = 1;
+	return 1;
+}
+
 int decisionTreeFun(my_int x[]) {
 	static uint8_t  idx_count_voting=0,  first_execution = 1;
 	static int16_t previous_nBags_voting_firstLbl[N_VOTING_SECTIONS][NO_CLASSES+1], count_out=0; //memory is expect to contain: previous_nBags_voting_firstLbl = nVotes LBL0 | ... | nVotes LBLx | output
@@ -104,6 +205,31 @@ int decisionTreeFun(my_int x[]) {
 	uint8_t storeMaxclasses[NO_CLASSES];
 
 
+	for (i = 0; i < NO_CLASSES; i++)
+		count[i] = 0;
+
+#ifdef COMPILED_FOREST
+	if (forest_status < 0)
+		DecisionForest_Init();
+	if (forest_status == 1)
+	{
+		for (bagi = 0; bagi < NO_BAGS; bagi++)
+		{
+			int16_t node = forest_roots[bagi];
+			while (node >= 0)
+				node = forest_nodes[node].child[x[forest_nodes[node].feature] >= forest_nodes[node].threshold];
+			lbl = -1 - node;
+			if (lbl >= NO_CLASSES)
+				continue;
+			count[lbl]++;
+			// a class with more than half of the votes is the only maximum whatever the other bags vote
+			if (2 * count[lbl] > NO_BAGS)
+				break;
+		}
+		goto vote;
+	}
+#endif
+
 	for (bagi = 0; bagi < NO_BAGS; bagi++)
 		out[bagi] = 0;
 
@@ -147,9 +273,6 @@ int decisionTreeFun(my_int x[]) {
 	for (j = 0; j < NO_CLASSES; j++)
 		ClassTest[j] = j;
 
-	for (i = 0; i < NO_CLASSES; i++)
-		count[i] = 0;
-
 	for (i = 0; i < NO_BAGS; i++) {
 		for (j = 0; j < NO_CLASSES; j++) {
 			if (out[i] == ClassTest[j])
@@ -157,6 +280,7 @@ int decisionTreeFun(my_int x[]) {
 		}
 	}
 
+vote:
 	for (j = 0; j < NO_CLASSES; j++) {
 		if (count[j] > max_el) {
 			output = j;
@@ -29,8 +29,6 @@
 #include <fx_fft.h>
 #include <window_definitions.h>
 
-#define FFT_SIZE WINDOW_LENGTH
-
 // radix 2
 my_int real_w_fxp_r2[FFT_SIZE / 2] =
 {
@@ -248,16 +246,18 @@ my_int B_i[FFT_SIZE / 2] =
   -130707, -130765, -130817, -130865, -130907, -130945, -130978, -131006, -131029, -131047, -131060, -131068
 };
 
-// tmp array for real fft
-my_int *fft_re_tmp;
-my_int *fft_im_tmp;
+static fft_plan_t shared_plan;
 
-uint32_t NumBits;
+void fft_plan_init(fft_plan_t *plan)
+{
+  // Real FFT of size FFT_SIZE is transform to a complex FFT of size FFT_SIZE/2
+  plan->num_bits = NumberOfBitsNeeded(FFT_SIZE / 2);
+  for (uint32_t i = 0; i < FFT_SIZE / 2; i++)
+    plan->bit_reverse[i] = ReverseBits(i, plan->num_bits);
+}
 
 void init()
 {
-  // Real FFT of size FFT_SIZE is transform to a complex FFT of size FFT_SIZE/2
-  NumBits = NumberOfBitsNeeded(FFT_SIZE / 2);
 
   // *** INITIALIZATION OF LOOK-UP TABLES ***
   // Not needed anymore - All table initialized statically
@@ -289,22 +289,29 @@ void init()
     B_i[i] = fx_mulx(fx_ftox(0.5, N_DEC_POW), fx_mulx(fx_itox(1, N_DEC_POW), cosx, N_DEC_POW), N_DEC_POW);
   }*/
 
-  fft_re_tmp = (my_int *)malloc(FFT_SIZE * sizeof(my_int));
-  fft_im_tmp = (my_int *)malloc(FFT_SIZE * sizeof(my_int));
+  fft_plan_init(&shared_plan);
 }
 
 void fft(my_int *input, my_int *outputR, my_int *outputI)
+{
+  fft_plan_exec(&shared_plan, input, outputR, outputI);
+}
+
+void fft_plan_exec(fft_plan_t *plan, const my_int *input, my_int *outputR, my_int *outputI)
 {
   int i, j;
+  my_int *fft_re_tmp = plan->re;
+  my_int *fft_im_tmp = plan->im;
+
   // Real input is transformed to complex input
   for (i = 0; i < FFT_SIZE / 2; i++)
   {
-    j = ReverseBits(i, NumBits);
+    j = plan->bit_reverse[i];
     fft_re_tmp[j] = input[2 * i];
     fft_im_tmp[j] = input[2 * i + 1];
   }
 
-  fft_cplx_radix2_iter(fft_re_tmp, fft_im_tmp, FFT_SIZE / 2, NumBits, real_w_fxp_r2, imag_w_fxp_r2);
+  fft_cplx_radix2_iter(fft_re_tmp, fft_im_tmp, FFT_SIZE / 2, plan->num_bits, real_w_fxp_r2, imag_w_fxp_r2);
 
   fft_re_tmp[FFT_SIZE / 2] = fft_re_tmp[0];
   fft_im_tmp[FFT_SIZE / 2] = fft_im_tmp[0];
@@ -325,9 +332,6 @@ void fft(my_int *input, my_int *outputR, my_int *outputI)
     outputR[FFT_SIZE - i] = outputR[i];
     outputI[FFT_SIZE - i] = -outputI[i];
   }
-
-  free(fft_re_tmp);
-  free(fft_im_tmp);
 }
 
 uint32_t ReverseBits(uint32_t index, uint32_t NumBits)
@@ -25,6 +25,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include <main.h>
 #include <window_definitions.h>
 #include <signal_pre_proc.h>
@@ -34,14 +35,82 @@
 #include <featureExtraction.h>
 #include <statisticalFeatureExtraction.h>
 #include <powerfeatureExtraction.h>
+#include <biquad_bench.h>
 
 
 
 /* Import file for testing hardcoded data */
 #include <data/W14_1_mod_s1d1_f.h>
 
+#ifdef PARALLEL_CHANNELS
+#include <pthread.h>
+#endif
+
 extern _features_t features_eeg;
 
+// Processing of one channel for the current window. The channels share no buffer, so the
+// CH_TO_STORE jobs can run in parallel.
+typedef struct {
+    uint8_t channel;
+    const my_int *signal;       // first sample of the window
+#ifdef FILTER_ACTIVE
+    filter_instance *filter;
+#endif
+    uint8_t npeaks;             // blinks found by PreProc_FindPeaks
+    my_int *buffer;             // WINDOW_LENGTH samples, private to the channel
+    uint8_t status;             // FeatureExtraction result
+} channel_job_t;
+
+static void ChannelBlinkRemoval(channel_job_t *job)
+{
+    vect_copy((my_int *)job->signal, job->buffer, WINDOW_LENGTH);
+#ifdef APPLY_BLINK_REMOVAL
+    PreProc_BlinkRemoval(job->buffer, job->npeaks);
+#endif
+}
+
+static void ChannelFeatures(channel_job_t *job)
+{
+    job->status = FeatureExtraction(&features_eeg.features_all[job->channel * NUM_FEATURES], job->buffer, job->channel);
+}
+
+#if defined(PARALLEL_CHANNELS) || !(defined(MULTICHANNEL_BIQUAD) && defined(APPLY_BLINK_REMOVAL))
+// The whole window of one channel (the multichannel biquad splits it in two phases instead)
+static void *ChannelWorker(void *arg)
+{
+    channel_job_t *job = (channel_job_t *)arg;
+
+    ChannelBlinkRemoval(job);
+#ifdef APPLY_BLINK_REMOVAL
+    // Biquad Filter
+    biquad_filter(job->filter, job->buffer, job->buffer, WINDOW_LENGTH);
+#endif
+    ChannelFeatures(job);
+    return NULL;
+}
+#endif
+
+#ifdef PARALLEL_CHANNELS
+// Channels B, C and D run on their own thread for the whole run and channel A on the main one.
+// window_start releases the threads once the jobs of a window are set, and window_done is the
+// barrier before the classification.
+static pthread_barrier_t window_start, window_done;
+static uint8_t workers_stop = 0;
+
+static void *ChannelThread(void *arg)
+{
+    for (;;)
+    {
+        pthread_barrier_wait(&window_start);
+        if (workers_stop)
+            break;
+        ChannelWorker(arg);
+        pthread_barrier_wait(&window_done);
+    }
+    return NULL;
+}
+#endif
+
 void eGlass()
 {
     uint8_t status = 0; // for the features extraction
@@ -73,9 +142,38 @@ void eGlass()
     {
         init_filter(&S[i], SOS_N_BIQUAD, new_sos_filter_second, fstate_ch[i]); // second one
     }
+#if !defined(PARALLEL_CHANNELS) && defined(MULTICHANNEL_BIQUAD)
+    // the same filter for the 4 channels at once
+    fixed_t fstate_mc[SOS_N_SAMPLES_NEEDED * BIQ_MAX_CH];
+    filter_instance_mc S_mc;
+    init_filter_mc(&S_mc, SOS_N_BIQUAD, CH_TO_STORE, new_sos_filter_second, fstate_mc);
+#endif
+#endif
+
+    uint8_t npeaks = 0;
+
+    const my_int *channel_signals[CH_TO_STORE] = {Signals_raw_test.signal->signal_chA, Signals_raw_test.signal->signal_chB,
+                                                  Signals_raw_test.signal->signal_chC, Signals_raw_test.signal->signal_chD};
+    channel_job_t jobs[CH_TO_STORE];
+    for (uint8_t ch = 0; ch < CH_TO_STORE; ch++)
+    {
+        jobs[ch].channel = ch;
+        jobs[ch].buffer = (my_int *)malloc(WINDOW_LENGTH * sizeof(my_int));
+    }
+#ifdef PARALLEL_CHANNELS
+    pthread_t workers[CH_TO_STORE];
+    pthread_barrier_init(&window_start, NULL, CH_TO_STORE);
+    pthread_barrier_init(&window_done, NULL, CH_TO_STORE);
+    for (uint8_t ch = 1; ch < CH_TO_STORE; ch++)
+        pthread_create(&workers[ch], NULL, ChannelThread, &jobs[ch]);
 #endif
 
-    uint8_t npeaks;
+#ifdef COMPILED_FOREST
+    if (DecisionForest_Init() == 0)
+    {
+        printf("ERROR FOREST INIT! Using the branch scan\n");
+    }
+#endif
 
     PowerFeatureExtractionInit(WINDOW_LENGTH, SAMPLING_FREQ, N_BATCHES, N_CHANNEL_USED);
 
@@ -134,51 +232,42 @@ void eGlass()
         printf("[%d - %d)\n", start_full_index, start_full_index + WINDOW_LENGTH);
 #endif
 #endif
-            /* CHANNEL A */
-            // get chA data from the beginning
-            
-            // get a full window
-            vect_copy(&Signals_raw_test.signal->signal_chA[start_full_index], procpool, WINDOW_LENGTH);
-
 #ifdef APPLY_BLINK_REMOVAL
             change_bit_depth(relEN_coeff, relEN_coeff, WINDOW_LENGTH, N_DEC_REL, N_DEC_BLINK); 
-	    // find peaks
+	    // find peaks (on the relative energy of channel A, used for all the channels)
             npeaks = PreProc_FindPeaks(relEN_coeff, WINDOW_LENGTH);
 
-            // blink removal
-            PreProc_BlinkRemoval(procpool, npeaks); // NO DEVI PRIMA CONVERTIRE TUTTO CON LO STESSO NUMERO DI BITS!!!
-		
-		// Biquad Filter
-            biquad_filter(&S[CHA], procpool, procpool, WINDOW_LENGTH); 
-
             relEn_SetStatus(REL_EN_START); // restart relEn calculation
 #endif
 
-            status = FeatureExtraction(features_eeg.feature_chA, procpool, CHA);
-
-            /* CHANNEL B */
-            vect_copy(&Signals_raw_test.signal->signal_chB[start_full_index], procpool, WINDOW_LENGTH);
-#ifdef APPLY_BLINK_REMOVAL
-            PreProc_BlinkRemoval(procpool, npeaks);
-            biquad_filter(&S[CHB], procpool, procpool, WINDOW_LENGTH);
-#endif
-            status = FeatureExtraction(features_eeg.feature_chB, procpool, CHB);
-
-            /* CHANNEL C */
-            vect_copy(&Signals_raw_test.signal->signal_chC[start_full_index], procpool, WINDOW_LENGTH);
-#ifdef APPLY_BLINK_REMOVAL
-            PreProc_BlinkRemoval(procpool, npeaks);
-            biquad_filter(&S[CHC], procpool, procpool, WINDOW_LENGTH);
+            // get a full window of each channel: blink removal, biquad filter, features
+            for (uint8_t ch = 0; ch < CH_TO_STORE; ch++)
+            {
+                jobs[ch].signal = &channel_signals[ch][start_full_index];
+#ifdef FILTER_ACTIVE
+                jobs[ch].filter = &S[ch];
 #endif
-            status = FeatureExtraction(features_eeg.feature_chC, procpool, CHC);
-
-            /* CHANNEL D */
-            vect_copy(&Signals_raw_test.signal->signal_chD[start_full_index], procpool, WINDOW_LENGTH);
-#ifdef APPLY_BLINK_REMOVAL
-            PreProc_BlinkRemoval(procpool, npeaks);
-            biquad_filter(&S[CHD], procpool, procpool, WINDOW_LENGTH);
+                jobs[ch].npeaks = npeaks;
+            }
+#ifdef PARALLEL_CHANNELS
+            pthread_barrier_wait(&window_start);
+            ChannelWorker(&jobs[CHA]);
+            pthread_barrier_wait(&window_done);   // all the features are ready before the classification
+#elif defined(MULTICHANNEL_BIQUAD) && defined(APPLY_BLINK_REMOVAL)
+            my_int *buffers[CH_TO_STORE];
+            for (uint8_t ch = 0; ch < CH_TO_STORE; ch++)
+            {
+                ChannelBlinkRemoval(&jobs[ch]);
+                buffers[ch] = jobs[ch].buffer;
+            }
+            biquad_filter_mc(&S_mc, buffers, buffers, WINDOW_LENGTH);
+            for (uint8_t ch = 0; ch < CH_TO_STORE; ch++)
+                ChannelFeatures(&jobs[ch]);
+#else
+            for (uint8_t ch = 0; ch < CH_TO_STORE; ch++)
+                ChannelWorker(&jobs[ch]);
 #endif
-            status = FeatureExtraction(features_eeg.feature_chD, procpool, CHD);
+            status = jobs[CH_TO_STORE - 1].status;
 
             if (status)
             {
@@ -232,7 +321,18 @@ void eGlass()
         }
     }
 
+#ifdef PARALLEL_CHANNELS
+    workers_stop = 1;
+    pthread_barrier_wait(&window_start);
+    for (uint8_t ch = 1; ch < CH_TO_STORE; ch++)
+        pthread_join(workers[ch], NULL);
+    pthread_barrier_destroy(&window_start);
+    pthread_barrier_destroy(&window_done);
+#endif
+
     free(procpool);
+    for (uint8_t ch = 0; ch < CH_TO_STORE; ch++)
+        free(jobs[ch].buffer);
 #ifdef APPLY_BLINK_REMOVAL
     endRelEnModule();
 #endif
@@ -249,8 +349,10 @@ void eGlass()
 }
 
 /* Program Entry. */
-int main(void)
+int main(int argc, char **argv)
 {
+    if (argc > 1 && strcmp(argv[1], "biquadbench") == 0)
+        return biquad_bench();
 
     #ifdef PRINT_INFO
     printf("\n\n\t *** Cognitive Workload Monitoring fixed-point ***\n\n");
@@ -35,6 +35,9 @@ typedef struct{
 	uint16_t 	fftSize; // it need to be of the same size as the signal as arm_rfft_fast_f32 return an interleaved fashion representation (real, imag, real, imag, ...)
 	my_int 		total_power;
 	my_int 		*power_density; //store psd
+	fft_plan_t	fft_plan;		// FFT of the periodograms of this channel
+	my_int 		*spectrum;		// 3*fftSize: outputs of the FFT for Periodogram, and the signal for the total power
+	my_int 		*periodogram;	// fftSize/2+1: periodogram of the current batch
 } _power_features_t;
 
 _power_features_t *power;
@@ -56,8 +59,11 @@ int8_t PowerFeatureExtractionInit(uint16_t fftSize, unsigned short samp_freq, ui
 			power[i].total_power = 0;
             
             power[i].power_density = (my_int *) malloc ((fftSize/2+1)*sizeof (my_int));
+            power[i].spectrum = (my_int *) malloc (3*fftSize*sizeof (my_int));
+            power[i].periodogram = (my_int *) malloc ((fftSize/2+1)*sizeof (my_int));
+            fft_plan_init(&power[i].fft_plan);
 
-			if(power[i].power_density){
+			if(power[i].power_density && power[i].spectrum && power[i].periodogram && fftSize == FFT_SIZE){
 				memset(power[i].power_density, 0, (fftSize/2+1)* sizeof (my_int));
 				status=1;
 			}
@@ -74,22 +80,18 @@ int8_t PowerFeatureExtractionInit(uint16_t fftSize, unsigned short samp_freq, ui
 
 
 int8_t PowerFeatures_BatchCalc(my_int *sig, uint8_t channel){
-	my_int *sig_periodogram;
+	my_int *sig_periodogram = power[channel].periodogram;
 	my_int tp;
 	int8_t status = 0;
     
-    sig_periodogram = (my_int *) malloc ((power[channel].fftSize/2+1) * sizeof (my_int));
-
-    my_int *sig_tp = (my_int*)malloc(power[channel].fftSize*sizeof(my_int));	// used only for total_power computation
+    my_int *sig_tp = power[channel].spectrum;	// used only for total_power computation
 
 	change_bit_depth(sig, sig_tp, power[channel].fftSize, N_DEC_POW, N_DEC_TP);
 	vect_power(sig_tp, power[channel].fftSize, &tp, N_DEC_TP);
 	power[channel].total_power += tp;
-    
-	free(sig_tp);
 
 	//Periodogram function has to be executed after calculating p_tot (direct from the signal samples)
-	Periodogram(&sig[0], sig_periodogram, power[channel].fftSize);
+	Periodogram(&power[channel].fft_plan, power[channel].spectrum, &sig[0], sig_periodogram, power[channel].fftSize);
 
 	vect_add(sig_periodogram, power[channel].power_density, power[channel].power_density, power[channel].fftSize/2+1);
 	power[channel].batches_exec++;
@@ -106,8 +108,6 @@ int8_t PowerFeatures_BatchCalc(my_int *sig, uint8_t channel){
 		status = 1;
 	}
 
-	free(sig_periodogram);
-
 	return status;
 }
 
@@ -141,19 +141,18 @@ void PowerFeatures_GetFeat(my_int *features, uint8_t channel){
 }
 
 
-void Periodogram(my_int *sig, my_int *periodogram, int numel_sig){
+void Periodogram(fft_plan_t *plan, my_int *spectrum, my_int *sig, my_int *periodogram, int numel_sig){
 	my_int nyk;
 
 	//hamming window convolution
 	vect_mult(sig, hamming_win, sig, numel_sig, N_DEC_POW);
 
-    my_int *oR = (my_int*) malloc(WINDOW_LENGTH * sizeof(my_int));
-	my_int *oI = (my_int*) malloc(WINDOW_LENGTH * sizeof(my_int));
+    my_int *oR = spectrum;
+	my_int *oI = spectrum + WINDOW_LENGTH;
 	
-	init();
-	fft(sig, oR, oI);
+	fft_plan_exec(plan, sig, oR, oI);
 	
-    my_int *out = (my_int*) malloc((WINDOW_LENGTH) * sizeof(my_int));	// output in interleaved way [real, imag, real, imag ...]
+    my_int *out = spectrum + 2 * WINDOW_LENGTH;	// output in interleaved way [real, imag, real, imag ...]
 
 	// order the final vectors into one with only half the results (symmetry)
 	for (size_t i = 0; i < WINDOW_LENGTH/2; i++)
@@ -179,10 +178,6 @@ void Periodogram(my_int *sig, my_int *periodogram, int numel_sig){
 	my_int scale = fx_ftox(WINDOW_SCALING_FACTOR, N_DEC_PER);
 	change_bit_depth(periodogram, periodogram, numel_sig/2+1, N_DEC_CMPLX, N_DEC_PER);
 	vect_scale(periodogram, scale, periodogram, numel_sig/2+1, N_DEC_PER);
-    
-	free(out);
-	free(oR);
-	free(oI);
 
 	return;
 }
@@ -260,9 +255,11 @@ my_int Bpower(my_int *power_density, my_int f1, my_int f2, my_int frequency_reso
 }
 
 void endPowerModule(){
-	free(power);
-    
 	for(int i=0; i<N_CHANNEL_USED; i++){
 		free(power[i].power_density);
+		free(power[i].spectrum);
+		free(power[i].periodogram);
 	}
+
+	free(power);
 }
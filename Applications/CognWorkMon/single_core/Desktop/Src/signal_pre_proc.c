@@ -26,7 +26,6 @@
 #include <utils_functions.h>
 
 
-my_int blink_filter_buff[BLINK_N_POINTS_USED + SGFilter_NCOEF - 1];
 my_int pks[MAX_N_PEAKS_EXPECTED];
 uint16_t locks[MAX_N_PEAKS_EXPECTED];
 
@@ -35,6 +34,7 @@ uint8_t PreProc_BlinkRemoval(my_int *signal, uint16_t npeaks)
 {
 	uint8_t status = 1;
 	uint16_t idx_b;
+	my_int blink_filter_buff[BLINK_N_POINTS_USED + SGFilter_NCOEF - 1]; // per call: the channels can be processed in parallel
 
 	my_int *new_sgFilt_b = (my_int *)malloc(SGFilter_NCOEF * sizeof(my_int));
 
@@ -38,6 +38,7 @@
 
 #define APPLY_BLINK_REMOVAL
 #define FILTER_ACTIVE
+// #define CLUSTER_FORK_CHANNELS   // one cluster core per channel for the blink removal, filter and feature extraction of a window
 
 // defines the number of halfindow to process before the script terminates
 // If the input data is not enough, they are repeated in a cyclic way
@@ -85,4 +86,25 @@ typedef int32_t my_int;
 
 extern PI_L2 struct pi_device cluster_dev;            // important for allocating memory in the cluster L1 memory
 
+// L1 allocations of the per-channel pipeline. With CLUSTER_FORK_CHANNELS the cores allocate concurrently, so the allocator is locked
+#ifdef CLUSTER_FORK_CHANNELS
+static inline void *cl_l1_malloc(uint32_t size)
+{
+    pi_cl_team_critical_enter();
+    void *ptr = pi_cl_l1_malloc(&cluster_dev, size);
+    pi_cl_team_critical_exit();
+    return ptr;
+}
+
+static inline void cl_l1_free(void *ptr, uint32_t size)
+{
+    pi_cl_team_critical_enter();
+    pi_cl_l1_free(&cluster_dev, ptr, size);
+    pi_cl_team_critical_exit();
+}
+#else
+#define cl_l1_malloc(size)      pi_cl_l1_malloc(&cluster_dev, size)
+#define cl_l1_free(ptr, size)   pi_cl_l1_free(&cluster_dev, ptr, size)
+#endif
+
 #endif
@@ -57,15 +57,14 @@ void ClusterdecisionTreeFun(int *arg)	{
 
 unsigned int FeatureExtraction(my_int *features, my_int *sig, uint8_t channel)
 {
-	static unsigned char status = 0;
-	static unsigned short sampling_frequency = SAMPLING_FREQ;
-	static uint8_t num_bins; // used for histogram
+	unsigned char status = 0; // not static: the channels can be processed in parallel
+	uint8_t num_bins; // used for histogram
 	my_int *cpy_data_feat, *hist;
 
 	num_bins = StatisticalFeatures_ReturnHistogramNBins();
 
-	cpy_data_feat = (my_int *)pi_cl_l1_malloc(&cluster_dev, WINDOW_LENGTH * sizeof(my_int));
-	hist = (my_int *)pi_cl_l1_malloc(&cluster_dev, num_bins * sizeof(my_int));
+	cpy_data_feat = (my_int *)cl_l1_malloc(WINDOW_LENGTH * sizeof(my_int));
+	hist = (my_int *)cl_l1_malloc(num_bins * sizeof(my_int));
 
 	if (!cpy_data_feat || !hist)
 	{
@@ -103,8 +102,8 @@ unsigned int FeatureExtraction(my_int *features, my_int *sig, uint8_t channel)
 		PowerFeatures_GetFeat(features, channel);
 	}
 
-	pi_cl_l1_free(&cluster_dev, cpy_data_feat, WINDOW_LENGTH * sizeof(my_int));
-	pi_cl_l1_free(&cluster_dev, hist, num_bins * sizeof(my_int));
+	cl_l1_free(cpy_data_feat, WINDOW_LENGTH * sizeof(my_int));
+	cl_l1_free(hist, num_bins * sizeof(my_int));
 	
     return status;
 }
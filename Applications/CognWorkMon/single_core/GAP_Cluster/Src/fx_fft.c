@@ -258,10 +258,6 @@ my_int B_i[FFT_SIZE / 2] =
   -130707, -130765, -130817, -130865, -130907, -130945, -130978, -131006, -131029, -131047, -131060, -131068
 };
 
-// tmp array for real fft
-my_int *fft_re_tmp;
-my_int *fft_im_tmp;
-
 uint32_t NumBits;
 
 void init()
@@ -299,14 +295,15 @@ void init()
     B_r[i] = fx_mulx(fx_ftox(0.5, N_DEC_POW), (fx_itox(1, N_DEC_POW) + sinx), N_DEC_POW);
     B_i[i] = fx_mulx(fx_ftox(0.5, N_DEC_POW), fx_mulx(fx_itox(1, N_DEC_POW), cosx, N_DEC_POW), N_DEC_POW);
   }*/
-
-  fft_re_tmp = (my_int *)pi_cl_l1_malloc(&cluster_dev, FFT_SIZE * sizeof(my_int));
-  fft_im_tmp = (my_int *)pi_cl_l1_malloc(&cluster_dev, FFT_SIZE * sizeof(my_int));
 }
 
 void fft(my_int *input, my_int *outputR, my_int *outputI)
 {
   int i, j;
+  // tmp arrays for real fft, owned by the call so that several cores can run an fft at the same time
+  my_int *fft_re_tmp = (my_int *)cl_l1_malloc((FFT_SIZE / 2 + 1) * sizeof(my_int));
+  my_int *fft_im_tmp = (my_int *)cl_l1_malloc((FFT_SIZE / 2 + 1) * sizeof(my_int));
+
   // Real input is transformed to complex input
   for (i = 0; i < FFT_SIZE / 2; i++)
   {
@@ -337,8 +334,8 @@ void fft(my_int *input, my_int *outputR, my_int *outputI)
     outputI[FFT_SIZE - i] = -outputI[i];
   }
 
-  pi_cl_l1_free(&cluster_dev, fft_re_tmp, FFT_SIZE * sizeof(my_int));
-  pi_cl_l1_free(&cluster_dev, fft_im_tmp, FFT_SIZE * sizeof(my_int));
+  cl_l1_free(fft_re_tmp, (FFT_SIZE / 2 + 1) * sizeof(my_int));
+  cl_l1_free(fft_im_tmp, (FFT_SIZE / 2 + 1) * sizeof(my_int));
 }
 
 uint32_t ReverseBits(uint32_t index, uint32_t NumBits)
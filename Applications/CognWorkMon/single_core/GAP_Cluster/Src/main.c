@@ -73,12 +73,54 @@ ClusterChangeBitDepth(int *arg)    {
     change_bit_depth(arg[0], arg[0], arg[1], arg[2], arg[3]);
 }
 
+#ifdef CLUSTER_FORK_CHANNELS
+// Work of one channel for the current window, done by the cluster core with the channel index
+typedef struct {
+    my_int *signal;             // full window in L2
+    my_int *buffer;             // private L1 copy of the window
+    filter_instance *filter;
+    my_int *features;
+    uint8_t channel;
+    uint8_t npeaks;
+    uint8_t status;
+} channel_job_t;
+
+PI_L1 my_int chpool[CH_TO_STORE - 1][WINDOW_LENGTH];   // windows of channels B, C, D (channel A uses procpool)
+PI_L1 channel_job_t jobs[CH_TO_STORE];
+
+static void ChannelCore(void *arg)  {
+    channel_job_t *job = &((channel_job_t *)arg)[pi_core_id()];
+    pi_cl_dma_cmd_t dmaCp;
+
+    pi_cl_dma_cmd((unsigned int)job->signal, (unsigned int)job->buffer, WINDOW_LENGTH*sizeof(my_int), PI_CL_DMA_DIR_EXT2LOC, &dmaCp);
+    pi_cl_dma_wait(&dmaCp);
+
+#ifdef APPLY_BLINK_REMOVAL
+    PreProc_BlinkRemoval(job->buffer, job->npeaks);
+    biquad_filter(job->filter, job->buffer, job->buffer, WINDOW_LENGTH);
+#endif
+
+    job->status = FeatureExtraction(job->features, job->buffer, job->channel);
+}
+
+// Processes the channels of a window on CH_TO_STORE cores. The fork returns when all of them are done
+void ClusterChannelsFork(int *arg)  {
+    #ifdef PROFILING_CLUSTER_ON
+    profile_start();
+    #endif
+    pi_cl_team_fork(CH_TO_STORE, ChannelCore, (void *)arg);
+    #ifdef PROFILING_CLUSTER_ON
+    profile_stop();
+    #endif
+}
+#endif
+
 void eGlass()
 {
     uint8_t status = 0; // for the features extraction
     uint8_t out = 0;    // for the classification
     int st;             // for relative energy
-    uint8_t npeaks;     // for peaks
+    uint8_t npeaks = 0; // for peaks
 
     // Ranking indexes of the final features
     int32_t ranking[NUM_FEATURES*N_CHANNEL_USED] = {1,16, 12, 35, 7, 66, 17, 50, 14, 15, 45, 56, 57, 60, 38, 54, 29, 32, 2, 3, 5, 37, 13, 22, 4, 11, 26, 63, 6, 10, 41, 62, 19, 53, 34, 67, 23, 65, 36, 44, 43, 49, 21, 58, 24, 68, 51, 55, 39, 59, 27, 61, 9, 52, 18, 28, 33, 48, 20, 31, 8, 40, 47, 64, 25, 30, 42, 46};
@@ -138,6 +180,19 @@ void eGlass()
     pi_cluster_send_task_to_cl(&cluster_dev, pi_cluster_task(&cl_task, ClusterrelEn_Init, cluster_args)); // Initialize the relative energy module
 #endif
 
+#ifdef CLUSTER_FORK_CHANNELS
+    my_int *features_ch[CH_TO_STORE] = {features_eeg.feature_chA, features_eeg.feature_chB, features_eeg.feature_chC, features_eeg.feature_chD};
+    for (uint8_t ch = 0; ch < CH_TO_STORE; ch++)
+    {
+        jobs[ch].buffer = ch == CHA ? procpool : chpool[ch - 1];
+#ifdef FILTER_ACTIVE
+        jobs[ch].filter = &S[ch];
+#endif
+        jobs[ch].features = features_ch[ch];
+        jobs[ch].channel = ch;
+    }
+#endif
+
     int i = 0;
     int cnt = 0;
 
@@ -188,6 +243,38 @@ void eGlass()
         printf("[%d - %d)\n", start_full_index, start_full_index + WINDOW_LENGTH);
     #endif
 #endif
+#ifdef CLUSTER_FORK_CHANNELS
+#ifdef APPLY_BLINK_REMOVAL
+            // The peaks of the relative energy are shared by all the channels
+            cluster_args[0] = (int *)relEN_coeff;
+            cluster_args[1] = (int *)WINDOW_LENGTH;
+            cluster_args[2] = (int *)N_DEC_REL;
+            cluster_args[3] = (int *)N_DEC_BLINK;
+            pi_cluster_send_task_to_cl(&cluster_dev, pi_cluster_task(&cl_task, ClusterChangeBitDepth, cluster_args));
+
+            cluster_args[0] = (int *)relEN_coeff;
+            cluster_args[1] = (int *)WINDOW_LENGTH;
+            cluster_args[2] = (int *)&npeaks;
+            pi_cluster_send_task_to_cl(&cluster_dev, pi_cluster_task(&cl_task, ClusterPreProc_FindPeaks, cluster_args));
+
+            relEn_SetStatus(REL_EN_START); // restart relEn calculation
+#endif
+            jobs[CHA].signal = &Signals_raw_test.signal->signal_chA[start_full_index];
+            jobs[CHB].signal = &Signals_raw_test.signal->signal_chB[start_full_index];
+            jobs[CHC].signal = &Signals_raw_test.signal->signal_chC[start_full_index];
+            jobs[CHD].signal = &Signals_raw_test.signal->signal_chD[start_full_index];
+            for (uint8_t ch = 0; ch < CH_TO_STORE; ch++)
+            {
+                jobs[ch].npeaks = npeaks;
+            }
+
+            // Blink removal, filter and feature extraction of the 4 channels, one per core
+            pi_cluster_task(&cl_task, ClusterChannelsFork, (int *)jobs);
+            cl_task.slave_stack_size = 2048;
+            pi_cluster_send_task_to_cl(&cluster_dev, &cl_task);
+
+            status = jobs[CHD].status;
+#else
             /* CHANNEL A */
             // get chA data from the beginning
             
@@ -317,6 +404,7 @@ void eGlass()
             cluster_args[2] = (int *)CHD;
             cluster_args[3] = (int *)&status;
             pi_cluster_send_task_to_cl(&cluster_dev, pi_cluster_task(&cl_task, ClusterFeatureExtraction, cluster_args));
+#endif
 
             if (status)
             {
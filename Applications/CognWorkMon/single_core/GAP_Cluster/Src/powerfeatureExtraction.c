@@ -91,15 +91,15 @@ int8_t PowerFeatures_BatchCalc(my_int *sig, uint8_t channel){
 	my_int tp;
 	int8_t status = 0;
     
-    sig_periodogram = (my_int *) pi_cl_l1_malloc (&cluster_dev, (power[channel].fftSize/2+1) * sizeof (my_int));
+    sig_periodogram = (my_int *) cl_l1_malloc((power[channel].fftSize/2+1) * sizeof (my_int));
 
-    my_int *sig_tp = (my_int*)pi_cl_l1_malloc(&cluster_dev, power[channel].fftSize*sizeof(my_int));	// used only for total_power computation
+    my_int *sig_tp = (my_int*)cl_l1_malloc(power[channel].fftSize*sizeof(my_int));	// used only for total_power computation
 
 	change_bit_depth(sig, sig_tp, power[channel].fftSize, N_DEC_POW, N_DEC_TP);
 	vect_power(sig_tp, power[channel].fftSize, &tp, N_DEC_TP);
 	power[channel].total_power += tp;
     
-	pi_cl_l1_free(&cluster_dev, sig_tp, power[channel].fftSize*sizeof(my_int));
+	cl_l1_free(sig_tp, power[channel].fftSize*sizeof(my_int));
 
 	//Periodogram function has to be executed after calculating p_tot (direct from the signal samples)
 	Periodogram(&sig[0], sig_periodogram, power[channel].fftSize);
@@ -119,7 +119,7 @@ int8_t PowerFeatures_BatchCalc(my_int *sig, uint8_t channel){
 		status = 1;
 	}
 
-	pi_cl_l1_free(&cluster_dev, sig_periodogram, (power[channel].fftSize/2+1) * sizeof (my_int));
+	cl_l1_free(sig_periodogram, (power[channel].fftSize/2+1) * sizeof (my_int));
 
 	return status;
 }
@@ -160,13 +160,13 @@ void Periodogram(my_int *sig, my_int *periodogram, int numel_sig){
 	//hamming window convolution
 	vect_mult(sig, hamming_win, sig, numel_sig, N_DEC_POW);
 
-    my_int *oR = (my_int*) pi_cl_l1_malloc(&cluster_dev, WINDOW_LENGTH * sizeof(my_int));
-	my_int *oI = (my_int*) pi_cl_l1_malloc(&cluster_dev, WINDOW_LENGTH * sizeof(my_int));
+    my_int *oR = (my_int*) cl_l1_malloc(WINDOW_LENGTH * sizeof(my_int));
+	my_int *oI = (my_int*) cl_l1_malloc(WINDOW_LENGTH * sizeof(my_int));
 	
 	init();
 	fft(sig, oR, oI);
 	
-    my_int *out = (my_int*) pi_cl_l1_malloc(&cluster_dev,(WINDOW_LENGTH) * sizeof(my_int));	// output in interleaved way [real, imag, real, imag ...]
+    my_int *out = (my_int*) cl_l1_malloc((WINDOW_LENGTH) * sizeof(my_int));	// output in interleaved way [real, imag, real, imag ...]
 
 	// order the final vectors into one with only half the results (symmetry)
 	for (size_t i = 0; i < WINDOW_LENGTH/2; i++)
@@ -192,9 +192,9 @@ void Periodogram(my_int *sig, my_int *periodogram, int numel_sig){
 	change_bit_depth(periodogram, periodogram, numel_sig/2+1, N_DEC_CMPLX, N_DEC_PER);
 	vect_scale(periodogram, scale, periodogram, numel_sig/2+1, N_DEC_PER);
     
-	pi_cl_l1_free(&cluster_dev, out, WINDOW_LENGTH * sizeof(my_int));
-	pi_cl_l1_free(&cluster_dev, oR, WINDOW_LENGTH * sizeof(my_int));
-	pi_cl_l1_free(&cluster_dev, oI, WINDOW_LENGTH * sizeof(my_int));
+	cl_l1_free(out, WINDOW_LENGTH * sizeof(my_int));
+	cl_l1_free(oR, WINDOW_LENGTH * sizeof(my_int));
+	cl_l1_free(oI, WINDOW_LENGTH * sizeof(my_int));
 
 	return;
 }
@@ -28,7 +28,6 @@
 
 #include "pmsis.h"
 
-PI_L1 my_int blink_filter_buff[BLINK_N_POINTS_USED + SGFilter_NCOEF - 1];
 PI_L1 my_int pks[MAX_N_PEAKS_EXPECTED];
 PI_L1 uint16_t locks[MAX_N_PEAKS_EXPECTED];
 
@@ -66,7 +65,8 @@ uint8_t PreProc_BlinkRemoval(my_int *signal, uint16_t npeaks)
 	uint8_t status = 1;
 	uint16_t idx_b;
  
-	my_int *new_sgFilt_b = (my_int *)pi_cl_l1_malloc(&cluster_dev, SGFilter_NCOEF * sizeof(my_int));
+	my_int *new_sgFilt_b = (my_int *)cl_l1_malloc(SGFilter_NCOEF * sizeof(my_int));
+	my_int *blink_filter_buff = (my_int *)cl_l1_malloc((BLINK_N_POINTS_USED + SGFilter_NCOEF - 1) * sizeof(my_int)); // per call: the channels can be processed in parallel
     
 	convert_to_x(sgFilt_b, new_sgFilt_b, SGFilter_NCOEF, N_DEC_BIQ);
 
@@ -84,7 +84,8 @@ uint8_t PreProc_BlinkRemoval(my_int *signal, uint16_t npeaks)
 		npeaks--;
 	}
 	
-	pi_cl_l1_free(&cluster_dev, new_sgFilt_b, SGFilter_NCOEF * sizeof(my_int));
+	cl_l1_free(new_sgFilt_b, SGFilter_NCOEF * sizeof(my_int));
+	cl_l1_free(blink_filter_buff, (BLINK_N_POINTS_USED + SGFilter_NCOEF - 1) * sizeof(my_int));
 	return status;
 }
 
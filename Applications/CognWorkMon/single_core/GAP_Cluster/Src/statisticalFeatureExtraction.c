@@ -355,7 +355,7 @@ int8_t StatisticalFeaturesExtraction(my_int *data, uint16_t len, uint8_t channel
 	}
 
 	StatisticalFeatures_HistogramInsert(stats->stats[channel].histogram, data, len); //histogram only for data
-	cpy_data = (my_int *) pi_cl_l1_malloc(&cluster_dev, WINDOW_LENGTH * sizeof (my_int));
+	cpy_data = (my_int *) cl_l1_malloc(WINDOW_LENGTH * sizeof (my_int));
 	if(!cpy_data)
 		printf("ERROR\n");
 
@@ -418,7 +418,7 @@ int8_t StatisticalFeaturesExtraction(my_int *data, uint16_t len, uint8_t channel
 	stats->stats[channel].skew[stats->stats[channel].batches_exec] = fx_divx(m3, fx_powx(var, N_DEC_STAT, fx_ftox(1.5, N_DEC_STAT), N_DEC_STAT), N_DEC_STAT);
 
 	/* Copy of data represented as unsigend int32_t to be used for m4 computation */
-	my_int* data_cpy = (my_int *) pi_cl_l1_malloc(&cluster_dev, WINDOW_LENGTH * sizeof(my_int)); //added
+	my_int* data_cpy = (my_int *) cl_l1_malloc(WINDOW_LENGTH * sizeof(my_int)); //added
     
 	if(!data_cpy)
 		printf("MEM ERROR\n");
@@ -444,8 +444,8 @@ int8_t StatisticalFeaturesExtraction(my_int *data, uint16_t len, uint8_t channel
 		status = 1;
 	}
 	
-	pi_cl_l1_free(&cluster_dev, cpy_data, WINDOW_LENGTH * sizeof (my_int));
-	pi_cl_l1_free(&cluster_dev, data_cpy, WINDOW_LENGTH * sizeof(my_int));
+	cl_l1_free(cpy_data, WINDOW_LENGTH * sizeof (my_int));
+	cl_l1_free(data_cpy, WINDOW_LENGTH * sizeof(my_int));
     
 	return status;
 }
@@ -26,6 +26,10 @@
 #ifndef _DCT_LIN_H_
 #define _DCT_LIN_H_
 
-extern const float dct_cos[16384];
+#define DCT_LEN         128     // length of the transformed columns (MEL_ROWS)
+#define DCT_N_COEFFS    13      // coefficients kept (N_MFCC), the higher ones are never used
+
+// dct_cos[(DCT_LEN * k) + n] = cos(pi * k * (2n + 1) / (2 * DCT_LEN))
+extern const float dct_cos[DCT_N_COEFFS * DCT_LEN];
 
 #endif
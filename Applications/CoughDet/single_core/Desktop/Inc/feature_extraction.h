@@ -28,12 +28,14 @@
 
 #include <stdlib.h>
 #include <imu_features.h>
+#include <mfcc_stream.h>
 
 // Macro for printing the features
 // #define PRINT_AUDIO_FEAT
 #define PRINT_IMU_FEAT
 
 void audio_features(const int8_t *features_selector, const float *sig, int16_t len, int16_t fs, float *feats);
+void audio_features_stream(const int8_t *features_selector, mfcc_stream_t *stream, int32_t position, const float *sig, int16_t len, int16_t fs, float *feats);
 
 void imu_features(const int8_t *features_selector, const float sig[][Num_IMU_signals], int16_t len, float *feats);
 
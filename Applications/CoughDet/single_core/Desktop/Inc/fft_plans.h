@@ -0,0 +1,49 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Author:          Stefano Albini                  //
+// Contributions:   Dimitrios Samakovlis            //
+// Date:            September 2023                  //
+//////////////////////////////////////////////////////
+
+
+
+#ifndef _FFT_PLANS_H_
+#define _FFT_PLANS_H_
+
+#include <inttypes.h>
+#include <kiss_fftr.h>
+
+/*
+    Cache of the kiss_fftr plans, one per FFT size, shared by all the FFT users
+    (RFFT features, Welch periodogram, STFT of the MFCCs).
+    fft_plans_init allocates the plans of the sizes used by the features once, so that
+    the windows do no plan allocation and no twiddle initialization.
+    A plan holds its work buffer: it is used by one FFT at a time.
+*/
+
+#define FFT_PLANS_MAX 4     // number of different FFT sizes that can be cached
+
+int8_t fft_plans_init(int16_t audio_len);
+kiss_fftr_cfg fft_plan_get(int16_t nfft);
+void fft_plans_free(void);
+
+// RFFT of nfft samples with the cached plan, or with a plan allocated for this call if the cache is full
+void fft_rfft(int16_t nfft, const float *in, kiss_fft_cpx *out);
+
+#endif
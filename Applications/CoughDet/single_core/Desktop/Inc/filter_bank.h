@@ -0,0 +1,48 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Author:          Stefano Albini                  //
+// Contributions:   Dimitrios Samakovlis            //
+// Date:            September 2023                  //
+//////////////////////////////////////////////////////
+
+
+
+
+#ifndef _FILTER_BANK_H_
+#define _FILTER_BANK_H_
+
+#include <inttypes.h>
+
+/*
+    Filter bank of the EEPD features: the N_EEPD bandpass filters and the envelope low pass
+    filter (filters_parameters.h) applied forward and backward like filtfilt, for all the
+    bands in one pass over the signal.
+    The bands are the lanes of a single padded workspace stored sample after sample
+    (work[(n * FILTER_BANK_LANES) + band]), so each sample updates all the band filters together
+    and the loop over the lanes is vectorized by the compiler.
+    The workspace is allocated once by filter_bank_init and kept across the windows.
+*/
+
+#define FILTER_BANK_LANES 20    // N_EEPD bands rounded up to a multiple of the SIMD width
+
+int8_t filter_bank_init(int16_t len);
+const float *filter_bank_eepd(const float *sig, int16_t len);
+void filter_bank_free(void);
+
+#endif
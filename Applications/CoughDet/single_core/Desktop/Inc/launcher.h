@@ -34,6 +34,13 @@
 // Enable printing of results
 #define PRINTING_ON
 
+// MFCCs of the overlapping windows with the STFT frames of the previous windows (mfcc_stream.h).
+// The frames are shared only when AUDIO_STEP is a multiple of HOP_LEN, not with the default overlap
+// #define STREAMING_MFCC
+
+// Classification with the flat layout of the random forest (predict_c_flat in randomForest.h)
+#define FLAT_RANDOM_FOREST
+
 #define OVERLAP             80    // Percentage of overlap in one window
 
 #define WINDOW_LEN          0.3  // seconds of a window
@@ -26,6 +26,8 @@
 #ifndef _MEL_BASIS_SMALL_H_
 #define _MEL_BASIS_SMALL_H_
 
+#include <stdint.h>
+
 // This file contains the MEL matrix for projecting a power spectrum into a mel basis
 // The numbers are hardcoded and taken from python.
 
@@ -37,7 +39,7 @@
 #define MEL_ROWS		128
 #define MEL_COLUMNS		1025
 
-#define MAX_NZ_ELEMS    50  // max number of non-zero elements 
+#define MEL_NNZ         2020    // number of non-zero elements
 
 /* 
     Indexes of the first and last non-zero elements for each row of the mel basis. 
@@ -46,6 +48,8 @@
 */
 extern const int mel_nz_indexes[MEL_ROWS][2];
 
-extern const float mel_basis[MEL_ROWS][MAX_NZ_ELEMS];
+// Non-zero elements of each row, one row after the other (CSR)
+extern const int16_t mel_offsets[MEL_ROWS + 1];
+extern const float mel_values[MEL_NNZ];
 
 #endif
@@ -46,13 +46,21 @@
 // define used for the DCT computation
 #define PI 3.14159265358979323846
 
+// independent partial sums of the sparse mel product
+#define MEL_LANES 8
+
 #include <stdint.h>
+#include <kiss_fft.h>
 
+void stft_column(const float *frame, float *column, kiss_fft_cpx *cx_out);
 void stft(const float *x, int16_t len, int16_t n_frames, float *res);
+void mel_column(const float *power, float *mel);
 void mel_spectrogram(const float *x, int16_t len, int16_t n_frames, float *res);
 
 void power_to_dB(const float *x, int16_t len, float *res);
 
-void dct_matrix(const float *x, int16_t rows, int16_t cols, float *y);
+void dct_matrix(const float *x, int16_t rows, int16_t cols, int16_t n_coeffs, float *y);
+// DCT of one column of dct_matrix
+void _dct_linear(const float *x, int16_t len, int16_t n_coeffs, float *y);
 
 #endif
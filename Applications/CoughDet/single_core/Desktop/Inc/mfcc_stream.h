@@ -0,0 +1,64 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Author:          Stefano Albini                  //
+// Contributions:   Dimitrios Samakovlis            //
+// Date:            September 2023                  //
+//////////////////////////////////////////////////////
+
+
+
+#ifndef _MFCC_STREAM_H_
+#define _MFCC_STREAM_H_
+
+/*
+    Streaming version of get_mfcc_features for overlapping windows of the same audio stream.
+    The frames of the STFT that lie inside a window (not on its zero padding) are kept in a
+    small cache of the stream with their absolute position in the stream. When a later window
+    has a frame at the same position, its mel column in dB is taken from the cache instead of
+    computing the RFFT and the mel product again, and so is its DCT if the TOP_DB clipping of the
+    window leaves the column unchanged. The results are the same as get_mfcc_features.
+    Frames recur only when the step between windows is a multiple of HOP_LEN.
+*/
+
+#include <stdint.h>
+
+#include <mel_basis.h>
+#include <audio_features.h>
+
+#define MFCC_STREAM_FRAMES 8    // frames kept in the cache (the frames inside one window fit)
+
+typedef struct {
+    int32_t start;              // position of the first sample of the frame in the stream, -1 if empty
+    float db[MEL_ROWS];         // mel power in dB, before the TOP_DB clipping
+    float db_min;
+    int8_t mfcc_valid;          // mfcc is the DCT of db (nothing was clipped)
+    float mfcc[N_MFCC];
+} mfcc_frame_t;
+
+// Cache of one audio stream
+typedef struct {
+    mfcc_frame_t frames[MFCC_STREAM_FRAMES];
+    int8_t next_frame;          // round-robin replacement
+    int32_t last_position;      // position of the last window in the stream, -1 before the first one
+} mfcc_stream_t;
+
+void mfcc_stream_init(mfcc_stream_t *stream);
+int8_t get_mfcc_features_stream(mfcc_stream_t *stream, int32_t position, const float *x, int16_t len, float *mean_mfcc, float *std_mfcc);
+
+#endif
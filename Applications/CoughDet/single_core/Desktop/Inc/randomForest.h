@@ -52,4 +52,31 @@ extern const int16_t node_features[N_TREES][N_NODES];
 void predict_c(float *feat, float *probs);
 
 
+/*
+    Flat layout of the same forest, built from the tables above by rf_flat_init.
+    The nodes of each tree are packed in breadth first order, followed by two leaves
+    (class 0 and class 1) that point to themselves: walking a tree for its depth always
+    ends on a leaf, whose index minus the number of split nodes is the class.
+*/
+#define RF_BATCH        8       // feature vectors walked together by predict_c_flat
+
+typedef struct rf_node {
+    int16_t feature;
+    float threshold;
+    int16_t child[2];   // indexes in the tree of the left (feat[feature] <= threshold) and right children
+} rf_node_t;
+
+typedef struct rf_tree {
+    int32_t first;      // index of the root in the flat nodes
+    int16_t leaves;     // number of split nodes, index of the class 0 leaf
+    int16_t depth;      // max number of splits from the root to a leaf
+} rf_tree_t;
+
+// Builds the flat layout, before the first predict_c_flat; returns 0 on error
+int8_t rf_flat_init(void);
+void rf_flat_free(void);
+
+void predict_c_flat(const float *feats, int32_t n_vectors, float *probs);
+
+
 #endif
@@ -25,7 +25,7 @@
 
 #include "dct_lin.h"
 
-const float dct_cos[16384] = {
+const float dct_cos[DCT_N_COEFFS * DCT_LEN] = {
 1.000000,
 1.000000,
 1.000000,
@@ -1689,14725 +1689,5 @@ const float dct_cos[16384] = {
 0.514104,
 0.740952,
 0.903989,
-0.989176,
-0.987301,
-0.887640,
-0.698376,
-0.438616,
-0.134581,
--0.183040,
--0.482184,
--0.732654,
--0.909168,
--0.993907,
--0.978317,
--0.863973,
--0.662416,
--0.393992,
--0.085798,
-0.231058,
-0.524590,
-0.765167,
-0.928506,
-0.998118,
-0.966976,
-0.838225,
-0.624860,
-0.348419,
-0.036807,
--0.278520,
--0.565732,
--0.795837,
--0.945607,
--0.999925,
--0.953306,
--0.810457,
--0.585798,
--0.302006,
-0.012271,
-0.325310,
-0.605511,
-0.824589,
-0.960430,
-0.999322,
-0.937339,
-0.780737,
-0.545325,
-0.254865,
--0.061321,
--0.371317,
--0.643832,
--0.851355,
--0.972940,
--0.996313,
--0.919114,
--0.749136,
--0.503539,
--0.207111,
-0.110222,
-0.416430,
-0.680601,
-0.876070,
-0.983105,
-0.990903,
-0.898675,
-0.715731,
-0.460539,
-0.158858,
--0.158857,
--0.460539,
--0.715730,
--0.898674,
--0.990903,
--0.983105,
--0.876070,
--0.680601,
--0.416429,
--0.110222,
-0.207112,
-0.503538,
-0.749137,
-0.919114,
-0.996313,
-0.972940,
-0.851355,
-0.643832,
-0.371317,
-0.061321,
--0.254866,
--0.545324,
--0.780737,
--0.937339,
--0.999322,
--0.960430,
--0.824589,
--0.605510,
--0.325311,
--0.012271,
-0.302006,
-0.585798,
-0.810457,
-0.953306,
-0.999925,
-0.945607,
-0.795837,
-0.565732,
-0.278519,
--0.036806,
--0.348418,
--0.624860,
--0.838225,
--0.966977,
--0.998118,
--0.928506,
--0.765167,
--0.524588,
--0.231059,
-0.085797,
-0.393993,
-0.662417,
-0.863972,
-0.978317,
-0.993907,
-0.909167,
-0.732655,
-0.482184,
-0.183040,
--0.134582,
--0.438615,
--0.698376,
--0.887640,
--0.987302,
-0.985278,
-0.870087,
-0.653173,
-0.359895,
-0.024541,
--0.313682,
--0.615232,
--0.844854,
--0.975702,
--0.992480,
--0.893224,
--0.689541,
--0.405242,
--0.073565,
-0.266713,
-0.575808,
-0.817585,
-0.963776,
-0.997290,
-0.914210,
-0.724247,
-0.449611,
-0.122411,
--0.219101,
--0.534998,
--0.788346,
--0.949528,
--0.999699,
--0.932993,
--0.757209,
--0.492898,
--0.170962,
-0.170962,
-0.492898,
-0.757209,
-0.932993,
-0.999699,
-0.949528,
-0.788346,
-0.534997,
-0.219101,
--0.122411,
--0.449612,
--0.724247,
--0.914210,
--0.997290,
--0.963776,
--0.817585,
--0.575809,
--0.266712,
-0.073564,
-0.405242,
-0.689540,
-0.893225,
-0.992479,
-0.975702,
-0.844854,
-0.615231,
-0.313682,
--0.024542,
--0.359895,
--0.653173,
--0.870087,
--0.985278,
--0.985278,
--0.870087,
--0.653173,
--0.359894,
--0.024541,
-0.313681,
-0.615232,
-0.844853,
-0.975702,
-0.992480,
-0.893224,
-0.689541,
-0.405241,
-0.073565,
--0.266713,
--0.575808,
--0.817585,
--0.963776,
--0.997290,
--0.914210,
--0.724247,
--0.449612,
--0.122410,
-0.219101,
-0.534998,
-0.788346,
-0.949528,
-0.999699,
-0.932993,
-0.757209,
-0.492898,
-0.170960,
--0.170961,
--0.492898,
--0.757209,
--0.932993,
--0.999699,
--0.949528,
--0.788346,
--0.534996,
--0.219102,
-0.122410,
-0.449612,
-0.724248,
-0.914209,
-0.997290,
-0.963776,
-0.817584,
-0.575809,
-0.266713,
--0.073566,
--0.405240,
--0.689540,
--0.893224,
--0.992480,
--0.975703,
--0.844854,
--0.615231,
--0.313681,
-0.024539,
-0.359894,
-0.653173,
-0.870088,
-0.985277,
-0.983105,
-0.851355,
-0.605511,
-0.278520,
--0.085797,
--0.438616,
--0.732654,
--0.928506,
--0.999925,
--0.937339,
--0.749136,
--0.460539,
--0.110222,
-0.254865,
-0.585798,
-0.838225,
-0.978317,
-0.987301,
-0.863973,
-0.624860,
-0.302006,
--0.061321,
--0.416429,
--0.715731,
--0.919114,
--0.999322,
--0.945607,
--0.765167,
--0.482184,
--0.134580,
-0.231058,
-0.565732,
-0.824589,
-0.972940,
-0.990903,
-0.876070,
-0.643832,
-0.325310,
--0.036807,
--0.393992,
--0.698376,
--0.909168,
--0.998118,
--0.953306,
--0.780737,
--0.503539,
--0.158857,
-0.207111,
-0.545324,
-0.810457,
-0.966976,
-0.993907,
-0.887640,
-0.662415,
-0.348419,
--0.012272,
--0.371317,
--0.680602,
--0.898674,
--0.996313,
--0.960430,
--0.795837,
--0.524589,
--0.183040,
-0.183040,
-0.524589,
-0.795837,
-0.960430,
-0.996313,
-0.898674,
-0.680602,
-0.371317,
-0.012272,
--0.348419,
--0.662415,
--0.887640,
--0.993907,
--0.966976,
--0.810457,
--0.545326,
--0.207111,
-0.158857,
-0.503539,
-0.780737,
-0.953306,
-0.998118,
-0.909168,
-0.698376,
-0.393991,
-0.036805,
--0.325309,
--0.643832,
--0.876071,
--0.990902,
--0.972940,
--0.824589,
--0.565731,
--0.231059,
-0.134581,
-0.482185,
-0.765166,
-0.945607,
-0.999322,
-0.919113,
-0.715732,
-0.416430,
-0.061320,
--0.302007,
--0.624859,
--0.863973,
--0.987302,
--0.978318,
--0.838225,
--0.585798,
--0.254864,
-0.110221,
-0.460538,
-0.749137,
-0.937340,
-0.999925,
-0.928506,
-0.732654,
-0.438618,
-0.085798,
--0.278520,
--0.605512,
--0.851354,
--0.983105,
-0.980785,
-0.831470,
-0.555570,
-0.195090,
--0.195090,
--0.555570,
--0.831470,
--0.980785,
--0.980785,
--0.831470,
--0.555570,
--0.195090,
-0.195090,
-0.555570,
-0.831470,
-0.980785,
-0.980785,
-0.831470,
-0.555570,
-0.195091,
--0.195090,
--0.555570,
--0.831470,
--0.980785,
--0.980785,
--0.831470,
--0.555570,
--0.195090,
-0.195091,
-0.555571,
-0.831469,
-0.980785,
-0.980785,
-0.831470,
-0.555570,
-0.195090,
--0.195090,
--0.555570,
--0.831470,
--0.980785,
--0.980785,
--0.831469,
--0.555571,
--0.195090,
-0.195090,
-0.555570,
-0.831470,
-0.980785,
-0.980785,
-0.831470,
-0.555569,
-0.195090,
--0.195090,
--0.555571,
--0.831469,
--0.980785,
--0.980785,
--0.831470,
--0.555570,
--0.195091,
-0.195091,
-0.555570,
-0.831470,
-0.980785,
-0.980785,
-0.831469,
-0.555571,
-0.195090,
--0.195090,
--0.555570,
--0.831470,
--0.980785,
--0.980785,
--0.831470,
--0.555569,
--0.195090,
-0.195090,
-0.555571,
-0.831469,
-0.980785,
-0.980785,
-0.831470,
-0.555570,
-0.195089,
--0.195089,
--0.555570,
--0.831470,
--0.980785,
--0.980785,
--0.831469,
--0.555569,
--0.195091,
-0.195090,
-0.555571,
-0.831469,
-0.980785,
-0.980785,
-0.831469,
-0.555571,
-0.195090,
--0.195092,
--0.555569,
--0.831469,
--0.980785,
--0.980786,
--0.831470,
--0.555570,
--0.195089,
-0.195089,
-0.555570,
-0.831470,
-0.980785,
-0.980785,
-0.831469,
-0.555569,
-0.195091,
--0.195090,
--0.555571,
--0.831469,
--0.980785,
--0.980785,
--0.831469,
--0.555571,
--0.195090,
-0.195092,
-0.555569,
-0.831469,
-0.980785,
-0.978317,
-0.810457,
-0.503538,
-0.110222,
--0.302006,
--0.662416,
--0.909168,
--0.999925,
--0.919114,
--0.680601,
--0.325310,
-0.085797,
-0.482184,
-0.795837,
-0.972940,
-0.983105,
-0.824589,
-0.524590,
-0.134581,
--0.278520,
--0.643832,
--0.898674,
--0.999322,
--0.928506,
--0.698376,
--0.348419,
-0.061321,
-0.460539,
-0.780737,
-0.966976,
-0.987301,
-0.838225,
-0.545325,
-0.158859,
--0.254865,
--0.624860,
--0.887640,
--0.998118,
--0.937339,
--0.715731,
--0.371317,
-0.036807,
-0.438617,
-0.765167,
-0.960430,
-0.990903,
-0.851355,
-0.565731,
-0.183040,
--0.231058,
--0.605512,
--0.876070,
--0.996313,
--0.945607,
--0.732655,
--0.393991,
-0.012272,
-0.416429,
-0.749137,
-0.953306,
-0.993907,
-0.863973,
-0.585798,
-0.207111,
--0.207111,
--0.585797,
--0.863973,
--0.993907,
--0.953306,
--0.749136,
--0.416430,
--0.012271,
-0.393992,
-0.732654,
-0.945607,
-0.996313,
-0.876070,
-0.605511,
-0.231057,
--0.183039,
--0.565732,
--0.851356,
--0.990902,
--0.960431,
--0.765167,
--0.438618,
--0.036808,
-0.371318,
-0.715732,
-0.937339,
-0.998118,
-0.887639,
-0.624860,
-0.254866,
--0.158859,
--0.545324,
--0.838225,
--0.987302,
--0.966977,
--0.780738,
--0.460538,
--0.061319,
-0.348418,
-0.698377,
-0.928507,
-0.999322,
-0.898674,
-0.643831,
-0.278521,
--0.134581,
--0.524591,
--0.824588,
--0.983105,
--0.972940,
--0.795838,
--0.482184,
--0.085797,
-0.325312,
-0.680600,
-0.919114,
-0.999925,
-0.909168,
-0.662416,
-0.302005,
--0.110221,
--0.503538,
--0.810458,
--0.978317,
-0.975702,
-0.788346,
-0.449611,
-0.024541,
--0.405241,
--0.757209,
--0.963776,
--0.985278,
--0.817585,
--0.492898,
--0.073565,
-0.359895,
-0.724247,
-0.949528,
-0.992480,
-0.844854,
-0.534997,
-0.122411,
--0.313682,
--0.689540,
--0.932993,
--0.997290,
--0.870087,
--0.575808,
--0.170962,
-0.266713,
-0.653173,
-0.914210,
-0.999699,
-0.893224,
-0.615232,
-0.219101,
--0.219101,
--0.615232,
--0.893224,
--0.999699,
--0.914210,
--0.653173,
--0.266712,
-0.170962,
-0.575808,
-0.870087,
-0.997290,
-0.932993,
-0.689540,
-0.313682,
--0.122410,
--0.534998,
--0.844853,
--0.992479,
--0.949528,
--0.724247,
--0.359894,
-0.073565,
-0.492898,
-0.817585,
-0.985278,
-0.963776,
-0.757208,
-0.405241,
--0.024541,
--0.449612,
--0.788346,
--0.975702,
--0.975702,
--0.788346,
--0.449612,
--0.024541,
-0.405241,
-0.757208,
-0.963776,
-0.985278,
-0.817585,
-0.492898,
-0.073563,
--0.359894,
--0.724247,
--0.949529,
--0.992480,
--0.844853,
--0.534996,
--0.122412,
-0.313682,
-0.689542,
-0.932992,
-0.997290,
-0.870086,
-0.575809,
-0.170962,
--0.266714,
--0.653172,
--0.914210,
--0.999699,
--0.893225,
--0.615231,
--0.219100,
-0.219100,
-0.615232,
-0.893225,
-0.999699,
-0.914210,
-0.653172,
-0.266714,
--0.170962,
--0.575809,
--0.870086,
--0.997290,
--0.932992,
--0.689542,
--0.313682,
-0.122412,
-0.534996,
-0.844853,
-0.992480,
-0.949529,
-0.724247,
-0.359894,
--0.073563,
--0.492898,
--0.817585,
--0.985277,
--0.963776,
--0.757208,
--0.405243,
-0.024541,
-0.449612,
-0.788345,
-0.975702,
-0.972940,
-0.765167,
-0.393992,
--0.061321,
--0.503538,
--0.838225,
--0.993907,
--0.937339,
--0.680601,
--0.278520,
-0.183040,
-0.605511,
-0.898674,
-0.999925,
-0.887640,
-0.585798,
-0.158858,
--0.302006,
--0.698376,
--0.945607,
--0.990903,
--0.824589,
--0.482184,
--0.036808,
-0.416430,
-0.780737,
-0.978317,
-0.966976,
-0.749137,
-0.371317,
--0.085798,
--0.524589,
--0.851355,
--0.996313,
--0.928506,
--0.662416,
--0.254865,
-0.207111,
-0.624859,
-0.909168,
-0.999322,
-0.876070,
-0.565731,
-0.134580,
--0.325310,
--0.715730,
--0.953306,
--0.987301,
--0.810458,
--0.460538,
--0.012272,
-0.438616,
-0.795837,
-0.983106,
-0.960431,
-0.732654,
-0.348418,
--0.110222,
--0.545324,
--0.863973,
--0.998118,
--0.919114,
--0.643831,
--0.231058,
-0.231058,
-0.643832,
-0.919114,
-0.998118,
-0.863972,
-0.545325,
-0.110221,
--0.348418,
--0.732655,
--0.960431,
--0.983106,
--0.795837,
--0.438618,
-0.012271,
-0.460539,
-0.810456,
-0.987301,
-0.953306,
-0.715732,
-0.325310,
--0.134582,
--0.565731,
--0.876070,
--0.999322,
--0.909168,
--0.624859,
--0.207110,
-0.254865,
-0.662416,
-0.928507,
-0.996313,
-0.851355,
-0.524588,
-0.085798,
--0.371318,
--0.749138,
--0.966976,
--0.978317,
--0.780738,
--0.416430,
-0.036808,
-0.482182,
-0.824589,
-0.990903,
-0.945608,
-0.698376,
-0.302005,
--0.158857,
--0.585798,
--0.887640,
--0.999925,
--0.898674,
--0.605510,
--0.183041,
-0.278520,
-0.680602,
-0.937339,
-0.993907,
-0.838224,
-0.503539,
-0.061320,
--0.393990,
--0.765167,
--0.972940,
-0.970031,
-0.740951,
-0.336890,
--0.146730,
--0.595699,
--0.903989,
--0.998795,
--0.857729,
--0.514103,
--0.049068,
-0.427555,
-0.803207,
-0.989177,
-0.941544,
-0.671559,
-0.242980,
--0.242980,
--0.671559,
--0.941544,
--0.989176,
--0.803208,
--0.427555,
-0.049068,
-0.514103,
-0.857728,
-0.998795,
-0.903989,
-0.595699,
-0.146731,
--0.336890,
--0.740951,
--0.970031,
--0.970031,
--0.740951,
--0.336890,
-0.146730,
-0.595699,
-0.903990,
-0.998795,
-0.857729,
-0.514103,
-0.049067,
--0.427555,
--0.803207,
--0.989177,
--0.941544,
--0.671559,
--0.242981,
-0.242981,
-0.671559,
-0.941544,
-0.989177,
-0.803207,
-0.427555,
--0.049067,
--0.514102,
--0.857729,
--0.998795,
--0.903990,
--0.595699,
--0.146730,
-0.336890,
-0.740951,
-0.970031,
-0.970031,
-0.740951,
-0.336889,
--0.146729,
--0.595699,
--0.903990,
--0.998796,
--0.857728,
--0.514101,
--0.049068,
-0.427556,
-0.803207,
-0.989176,
-0.941544,
-0.671560,
-0.242980,
--0.242982,
--0.671558,
--0.941544,
--0.989176,
--0.803208,
--0.427554,
-0.049066,
-0.514103,
-0.857729,
-0.998795,
-0.903989,
-0.595698,
-0.146731,
--0.336890,
--0.740952,
--0.970031,
--0.970031,
--0.740952,
--0.336890,
-0.146732,
-0.595698,
-0.903989,
-0.998795,
-0.857729,
-0.514102,
-0.049066,
--0.427555,
--0.803208,
--0.989176,
--0.941544,
--0.671558,
--0.242981,
-0.242980,
-0.671560,
-0.941544,
-0.989176,
-0.803209,
-0.427556,
--0.049069,
--0.514101,
--0.857729,
--0.998796,
--0.903990,
--0.595699,
--0.146729,
-0.336889,
-0.740952,
-0.970031,
-0.966976,
-0.715731,
-0.278520,
--0.231058,
--0.680601,
--0.953306,
--0.978317,
--0.749136,
--0.325310,
-0.183040,
-0.643832,
-0.937339,
-0.987301,
-0.780737,
-0.371317,
--0.134580,
--0.605511,
--0.919114,
--0.993907,
--0.810457,
--0.416429,
-0.085797,
-0.565732,
-0.898674,
-0.998118,
-0.838225,
-0.460539,
--0.036807,
--0.524589,
--0.876070,
--0.999925,
--0.863973,
--0.503539,
--0.012272,
-0.482185,
-0.851355,
-0.999322,
-0.887640,
-0.545326,
-0.061320,
--0.438616,
--0.824589,
--0.996313,
--0.909168,
--0.585798,
--0.110222,
-0.393991,
-0.795837,
-0.990903,
-0.928506,
-0.624860,
-0.158857,
--0.348419,
--0.765167,
--0.983105,
--0.945608,
--0.662415,
--0.207111,
-0.302006,
-0.732654,
-0.972940,
-0.960430,
-0.698376,
-0.254864,
--0.254865,
--0.698377,
--0.960431,
--0.972940,
--0.732654,
--0.302007,
-0.207111,
-0.662417,
-0.945607,
-0.983105,
-0.765168,
-0.348419,
--0.158859,
--0.624859,
--0.928506,
--0.990902,
--0.795837,
--0.393991,
-0.110221,
-0.585798,
-0.909169,
-0.996313,
-0.824589,
-0.438618,
--0.061320,
--0.545326,
--0.887639,
--0.999322,
--0.851354,
--0.482184,
-0.012272,
-0.503537,
-0.863973,
-0.999925,
-0.876071,
-0.524589,
-0.036809,
--0.460538,
--0.838225,
--0.998118,
--0.898674,
--0.565730,
--0.085798,
-0.416430,
-0.810456,
-0.993907,
-0.919113,
-0.605512,
-0.134580,
--0.371319,
--0.780737,
--0.987302,
--0.937339,
--0.643831,
--0.183038,
-0.325310,
-0.749137,
-0.978317,
-0.953306,
-0.680600,
-0.231056,
--0.278516,
--0.715729,
--0.966976,
-0.963776,
-0.689541,
-0.219101,
--0.313682,
--0.757209,
--0.985278,
--0.932993,
--0.615232,
--0.122411,
-0.405241,
-0.817585,
-0.997290,
-0.893224,
-0.534997,
-0.024541,
--0.492898,
--0.870087,
--0.999699,
--0.844854,
--0.449611,
-0.073564,
-0.575808,
-0.914210,
-0.992480,
-0.788346,
-0.359895,
--0.170961,
--0.653173,
--0.949528,
--0.975702,
--0.724246,
--0.266712,
-0.266713,
-0.724247,
-0.975702,
-0.949528,
-0.653172,
-0.170962,
--0.359895,
--0.788346,
--0.992479,
--0.914210,
--0.575808,
--0.073565,
-0.449611,
-0.844853,
-0.999699,
-0.870087,
-0.492898,
--0.024541,
--0.534997,
--0.893225,
--0.997290,
--0.817585,
--0.405242,
-0.122410,
-0.615232,
-0.932993,
-0.985278,
-0.757209,
-0.313681,
--0.219100,
--0.689541,
--0.963777,
--0.963776,
--0.689540,
--0.219102,
-0.313682,
-0.757210,
-0.985278,
-0.932992,
-0.615232,
-0.122410,
--0.405240,
--0.817585,
--0.997291,
--0.893225,
--0.534997,
--0.024543,
-0.492898,
-0.870088,
-0.999699,
-0.844853,
-0.449613,
--0.073564,
--0.575809,
--0.914209,
--0.992479,
--0.788348,
--0.359895,
-0.170963,
-0.653172,
-0.949528,
-0.975703,
-0.724247,
-0.266712,
--0.266712,
--0.724247,
--0.975702,
--0.949528,
--0.653172,
--0.170963,
-0.359896,
-0.788345,
-0.992480,
-0.914209,
-0.575809,
-0.073564,
--0.449610,
--0.844853,
--0.999699,
--0.870087,
--0.492898,
-0.024540,
-0.534997,
-0.893225,
-0.997291,
-0.817584,
-0.405243,
--0.122411,
--0.615233,
--0.932994,
--0.985278,
--0.757210,
--0.313682,
-0.219103,
-0.689543,
-0.963775,
-0.960431,
-0.662416,
-0.158858,
--0.393992,
--0.824589,
--0.999322,
--0.863973,
--0.460539,
-0.085797,
-0.605511,
-0.937339,
-0.978317,
-0.715731,
-0.231058,
--0.325311,
--0.780737,
--0.993907,
--0.898674,
--0.524590,
-0.012271,
-0.545325,
-0.909168,
-0.990903,
-0.765167,
-0.302006,
--0.254865,
--0.732655,
--0.983106,
--0.928506,
--0.585798,
--0.061322,
-0.482185,
-0.876070,
-0.998118,
-0.810457,
-0.371318,
--0.183039,
--0.680602,
--0.966977,
--0.953306,
--0.643832,
--0.134581,
-0.416429,
-0.838224,
-0.999925,
-0.851355,
-0.438616,
--0.110222,
--0.624859,
--0.945607,
--0.972940,
--0.698376,
--0.207111,
-0.348419,
-0.795837,
-0.996313,
-0.887639,
-0.503538,
--0.036806,
--0.565732,
--0.919114,
--0.987302,
--0.749136,
--0.278521,
-0.278520,
-0.749138,
-0.987301,
-0.919113,
-0.565733,
-0.036807,
--0.503537,
--0.887640,
--0.996312,
--0.795837,
--0.348418,
-0.207110,
-0.698377,
-0.972940,
-0.945607,
-0.624858,
-0.110223,
--0.438617,
--0.851354,
--0.999925,
--0.838224,
--0.416430,
-0.134582,
-0.643831,
-0.953306,
-0.966977,
-0.680601,
-0.183038,
--0.371317,
--0.810458,
--0.998118,
--0.876070,
--0.482182,
-0.061320,
-0.585799,
-0.928506,
-0.983105,
-0.732655,
-0.254866,
--0.302008,
--0.765167,
--0.990903,
--0.909168,
--0.545325,
--0.012273,
-0.524590,
-0.898675,
-0.993907,
-0.780737,
-0.325308,
--0.231055,
--0.715729,
--0.978317,
--0.937339,
--0.605509,
--0.085801,
-0.460537,
-0.863973,
-0.999322,
-0.824588,
-0.393995,
--0.158857,
--0.662416,
--0.960431,
-0.956940,
-0.634393,
-0.098017,
--0.471397,
--0.881921,
--0.995185,
--0.773011,
--0.290285,
-0.290285,
-0.773011,
-0.995185,
-0.881921,
-0.471397,
--0.098017,
--0.634394,
--0.956940,
--0.956940,
--0.634394,
--0.098017,
-0.471397,
-0.881921,
-0.995185,
-0.773010,
-0.290285,
--0.290285,
--0.773010,
--0.995185,
--0.881921,
--0.471397,
-0.098017,
-0.634393,
-0.956940,
-0.956940,
-0.634393,
-0.098017,
--0.471397,
--0.881921,
--0.995185,
--0.773011,
--0.290285,
-0.290286,
-0.773011,
-0.995185,
-0.881921,
-0.471397,
--0.098017,
--0.634393,
--0.956940,
--0.956940,
--0.634393,
--0.098017,
-0.471397,
-0.881921,
-0.995185,
-0.773011,
-0.290284,
--0.290284,
--0.773011,
--0.995185,
--0.881921,
--0.471395,
-0.098017,
-0.634394,
-0.956940,
-0.956940,
-0.634394,
-0.098017,
--0.471395,
--0.881921,
--0.995185,
--0.773011,
--0.290284,
-0.290284,
-0.773011,
-0.995185,
-0.881921,
-0.471395,
--0.098017,
--0.634394,
--0.956940,
--0.956940,
--0.634394,
--0.098017,
-0.471395,
-0.881921,
-0.995185,
-0.773011,
-0.290284,
--0.290284,
--0.773011,
--0.995185,
--0.881921,
--0.471398,
-0.098017,
-0.634394,
-0.956940,
-0.956940,
-0.634394,
-0.098017,
--0.471395,
--0.881921,
--0.995185,
--0.773011,
--0.290284,
-0.290284,
-0.773011,
-0.995185,
-0.881921,
-0.471398,
--0.098017,
--0.634394,
--0.956941,
--0.956941,
--0.634394,
--0.098017,
-0.471399,
-0.881919,
-0.995185,
-0.773011,
-0.290283,
--0.290287,
--0.773009,
--0.995185,
--0.881921,
--0.471395,
-0.098021,
-0.634391,
-0.956940,
-0.953306,
-0.605511,
-0.036807,
--0.545325,
--0.928506,
--0.972940,
--0.662416,
--0.110222,
-0.482184,
-0.898674,
-0.987301,
-0.715731,
-0.183040,
--0.416429,
--0.863973,
--0.996313,
--0.765167,
--0.254866,
-0.348418,
-0.824589,
-0.999925,
-0.810457,
-0.325310,
--0.278520,
--0.780737,
--0.998118,
--0.851355,
--0.393992,
-0.207111,
-0.732654,
-0.990903,
-0.887640,
-0.460539,
--0.134580,
--0.680602,
--0.978318,
--0.919114,
--0.524589,
-0.061321,
-0.624860,
-0.960430,
-0.945607,
-0.585798,
-0.012272,
--0.565731,
--0.937339,
--0.966976,
--0.643831,
--0.085797,
-0.503539,
-0.909168,
-0.983105,
-0.698376,
-0.158857,
--0.438616,
--0.876071,
--0.993907,
--0.749136,
--0.231059,
-0.371318,
-0.838224,
-0.999322,
-0.795838,
-0.302006,
--0.302007,
--0.795837,
--0.999322,
--0.838225,
--0.371316,
-0.231057,
-0.749137,
-0.993907,
-0.876070,
-0.438618,
--0.158858,
--0.698377,
--0.983105,
--0.909167,
--0.503539,
-0.085798,
-0.643831,
-0.966977,
-0.937340,
-0.565732,
--0.012270,
--0.585798,
--0.945608,
--0.960431,
--0.624858,
--0.061321,
-0.524591,
-0.919113,
-0.978317,
-0.680602,
-0.134580,
--0.460537,
--0.887640,
--0.990902,
--0.732654,
--0.207110,
-0.393991,
-0.851356,
-0.998118,
-0.780737,
-0.278517,
--0.325307,
--0.810456,
--0.999925,
--0.824588,
--0.348415,
-0.254863,
-0.765167,
-0.996313,
-0.863971,
-0.416432,
--0.183039,
--0.715731,
--0.987302,
--0.898676,
--0.482185,
-0.110222,
-0.662417,
-0.972941,
-0.928507,
-0.545326,
--0.036808,
--0.605513,
--0.953305,
-0.949528,
-0.575808,
--0.024541,
--0.615232,
--0.963776,
--0.932993,
--0.534998,
-0.073565,
-0.653173,
-0.975702,
-0.914210,
-0.492898,
--0.122411,
--0.689540,
--0.985278,
--0.893224,
--0.449611,
-0.170962,
-0.724247,
-0.992480,
-0.870087,
-0.405241,
--0.219101,
--0.757209,
--0.997290,
--0.844853,
--0.359895,
-0.266713,
-0.788346,
-0.999699,
-0.817585,
-0.313682,
--0.313681,
--0.817585,
--0.999699,
--0.788347,
--0.266713,
-0.359894,
-0.844853,
-0.997290,
-0.757208,
-0.219101,
--0.405242,
--0.870087,
--0.992479,
--0.724247,
--0.170962,
-0.449611,
-0.893224,
-0.985278,
-0.689541,
-0.122409,
--0.492898,
--0.914210,
--0.975702,
--0.653172,
--0.073565,
-0.534999,
-0.932992,
-0.963776,
-0.615232,
-0.024541,
--0.575807,
--0.949528,
--0.949529,
--0.575808,
-0.024539,
-0.615232,
-0.963777,
-0.932993,
-0.534996,
--0.073564,
--0.653174,
--0.975702,
--0.914209,
--0.492899,
-0.122412,
-0.689540,
-0.985278,
-0.893225,
-0.449611,
--0.170961,
--0.724247,
--0.992479,
--0.870087,
--0.405243,
-0.219101,
-0.757208,
-0.997290,
-0.844853,
-0.359895,
--0.266714,
--0.788346,
--0.999699,
--0.817585,
--0.313681,
-0.313681,
-0.817585,
-0.999699,
-0.788346,
-0.266714,
--0.359896,
--0.844855,
--0.997291,
--0.757210,
--0.219101,
-0.405243,
-0.870089,
-0.992480,
-0.724247,
-0.170960,
--0.449614,
--0.893223,
--0.985278,
--0.689540,
--0.122408,
-0.492896,
-0.914209,
-0.975702,
-0.653171,
-0.073568,
--0.534996,
--0.932993,
--0.963775,
--0.615234,
--0.024543,
-0.575808,
-0.949529,
-0.945607,
-0.545325,
--0.085797,
--0.680601,
--0.987301,
--0.876070,
--0.393992,
-0.254865,
-0.795837,
-0.999925,
-0.780737,
-0.231058,
--0.416429,
--0.887639,
--0.983106,
--0.662416,
--0.061321,
-0.565732,
-0.953306,
-0.937339,
-0.524589,
--0.110223,
--0.698376,
--0.990903,
--0.863973,
--0.371317,
-0.278520,
-0.810457,
-0.999322,
-0.765167,
-0.207111,
--0.438616,
--0.898674,
--0.978317,
--0.643832,
--0.036807,
-0.585798,
-0.960430,
-0.928506,
-0.503539,
--0.134581,
--0.715731,
--0.993907,
--0.851355,
--0.348419,
-0.302006,
-0.824589,
-0.998118,
-0.749137,
-0.183038,
--0.460538,
--0.909169,
--0.972940,
--0.624858,
--0.012272,
-0.605512,
-0.966976,
-0.919113,
-0.482184,
--0.158859,
--0.732654,
--0.996313,
--0.838225,
--0.325309,
-0.325309,
-0.838225,
-0.996313,
-0.732654,
-0.158859,
--0.482185,
--0.919113,
--0.966976,
--0.605512,
-0.012272,
-0.624859,
-0.972940,
-0.909168,
-0.460538,
--0.183039,
--0.749137,
--0.998118,
--0.824589,
--0.302007,
-0.348419,
-0.851354,
-0.993907,
-0.715732,
-0.134580,
--0.503537,
--0.928506,
--0.960431,
--0.585798,
-0.036806,
-0.643832,
-0.978317,
-0.898674,
-0.438618,
--0.207108,
--0.765166,
--0.999322,
--0.810456,
--0.278523,
-0.371315,
-0.863973,
-0.990902,
-0.698374,
-0.110224,
--0.524590,
--0.937340,
--0.953305,
--0.565734,
-0.061320,
-0.662417,
-0.983106,
-0.887641,
-0.416430,
--0.231060,
--0.780739,
--0.999925,
--0.795837,
--0.254864,
-0.393995,
-0.876069,
-0.987302,
-0.680600,
-0.085794,
--0.545323,
--0.945607,
-0.941544,
-0.514103,
--0.146730,
--0.740951,
--0.998795,
--0.803208,
--0.242980,
-0.427555,
-0.903989,
-0.970031,
-0.595699,
--0.049068,
--0.671559,
--0.989176,
--0.857729,
--0.336890,
-0.336890,
-0.857728,
-0.989177,
-0.671559,
-0.049068,
--0.595699,
--0.970031,
--0.903989,
--0.427555,
-0.242980,
-0.803208,
-0.998795,
-0.740951,
-0.146730,
--0.514103,
--0.941544,
--0.941544,
--0.514102,
-0.146731,
-0.740951,
-0.998795,
-0.803207,
-0.242980,
--0.427556,
--0.903990,
--0.970031,
--0.595699,
-0.049069,
-0.671560,
-0.989177,
-0.857729,
-0.336889,
--0.336889,
--0.857729,
--0.989177,
--0.671558,
--0.049068,
-0.595700,
-0.970031,
-0.903989,
-0.427556,
--0.242982,
--0.803207,
--0.998795,
--0.740951,
--0.146729,
-0.514103,
-0.941545,
-0.941544,
-0.514101,
--0.146730,
--0.740952,
--0.998795,
--0.803209,
--0.242980,
-0.427553,
-0.903989,
-0.970032,
-0.595699,
--0.049066,
--0.671559,
--0.989176,
--0.857728,
--0.336891,
-0.336890,
-0.857728,
-0.989176,
-0.671560,
-0.049067,
--0.595698,
--0.970031,
--0.903990,
--0.427554,
-0.242979,
-0.803208,
-0.998796,
-0.740950,
-0.146731,
--0.514104,
--0.941545,
--0.941545,
--0.514103,
-0.146732,
-0.740953,
-0.998795,
-0.803208,
-0.242979,
--0.427558,
--0.903988,
--0.970031,
--0.595698,
-0.049071,
-0.671557,
-0.989176,
-0.857728,
-0.336886,
--0.336888,
--0.857729,
--0.989176,
--0.671562,
--0.049070,
-0.595699,
-0.970032,
-0.903991,
-0.427557,
--0.242980,
--0.803209,
--0.998796,
--0.740952,
--0.146730,
-0.514105,
-0.941543,
-0.937339,
-0.482184,
--0.207111,
--0.795837,
--0.998118,
--0.715731,
--0.085798,
-0.585798,
-0.972940,
-0.887640,
-0.371317,
--0.325311,
--0.863973,
--0.983106,
--0.624860,
-0.036807,
-0.680601,
-0.993907,
-0.824589,
-0.254865,
--0.438617,
--0.919114,
--0.953306,
--0.524590,
-0.158858,
-0.765167,
-0.999925,
-0.749136,
-0.134580,
--0.545325,
--0.960431,
--0.909168,
--0.416429,
-0.278521,
-0.838224,
-0.990903,
-0.662416,
-0.012272,
--0.643831,
--0.987301,
--0.851355,
--0.302006,
-0.393992,
-0.898674,
-0.966976,
-0.565732,
--0.110221,
--0.732655,
--0.999322,
--0.780737,
--0.183041,
-0.503539,
-0.945607,
-0.928506,
-0.460539,
--0.231059,
--0.810457,
--0.996312,
--0.698376,
--0.061319,
-0.605511,
-0.978317,
-0.876070,
-0.348420,
--0.348419,
--0.876069,
--0.978317,
--0.605512,
-0.061322,
-0.698376,
-0.996313,
-0.810458,
-0.231057,
--0.460538,
--0.928507,
--0.945607,
--0.503537,
-0.183040,
-0.780736,
-0.999322,
-0.732655,
-0.110222,
--0.565731,
--0.966977,
--0.898675,
--0.393991,
-0.302005,
-0.851356,
-0.987302,
-0.643831,
--0.012275,
--0.662414,
--0.990903,
--0.838224,
--0.278523,
-0.416428,
-0.909168,
-0.960430,
-0.545328,
--0.134579,
--0.749137,
--0.999925,
--0.765169,
--0.158859,
-0.524591,
-0.953307,
-0.919115,
-0.438617,
--0.254867,
--0.824591,
--0.993907,
--0.680601,
--0.036805,
-0.624857,
-0.983105,
-0.863973,
-0.325308,
--0.371314,
--0.887639,
--0.972940,
--0.585796,
-0.085795,
-0.715730,
-0.998118,
-0.795835,
-0.207114,
--0.482184,
--0.937340,
-0.932993,
-0.449611,
--0.266713,
--0.844854,
--0.985278,
--0.615232,
-0.073565,
-0.724247,
-0.999699,
-0.757209,
-0.122411,
--0.575808,
--0.975702,
--0.870087,
--0.313682,
-0.405241,
-0.914210,
-0.949528,
-0.492899,
--0.219101,
--0.817585,
--0.992480,
--0.653173,
-0.024541,
-0.689540,
-0.997290,
-0.788346,
-0.170962,
--0.534998,
--0.963776,
--0.893224,
--0.359894,
-0.359894,
-0.893224,
-0.963776,
-0.534998,
--0.170962,
--0.788346,
--0.997290,
--0.689540,
--0.024541,
-0.653173,
-0.992479,
-0.817585,
-0.219100,
--0.492898,
--0.949529,
--0.914210,
--0.405243,
-0.313682,
-0.870086,
-0.975702,
-0.575809,
--0.122412,
--0.757208,
--0.999699,
--0.724247,
--0.073563,
-0.615232,
-0.985277,
-0.844853,
-0.266714,
--0.449612,
--0.932992,
--0.932992,
--0.449612,
-0.266714,
-0.844853,
-0.985277,
-0.615231,
--0.073563,
--0.724247,
--0.999699,
--0.757208,
--0.122412,
-0.575809,
-0.975702,
-0.870086,
-0.313682,
--0.405240,
--0.914210,
--0.949529,
--0.492898,
-0.219100,
-0.817585,
-0.992480,
-0.653172,
--0.024541,
--0.689542,
--0.997291,
--0.788348,
--0.170962,
-0.535000,
-0.963775,
-0.893225,
-0.359894,
--0.359898,
--0.893223,
--0.963776,
--0.534996,
-0.170958,
-0.788345,
-0.997290,
-0.689539,
-0.024544,
--0.653172,
--0.992480,
--0.817583,
--0.219104,
-0.492898,
-0.949529,
-0.914211,
-0.405243,
--0.313682,
--0.870088,
--0.975703,
--0.575809,
-0.122412,
-0.757211,
-0.999699,
-0.724247,
-0.073563,
--0.615229,
--0.985277,
--0.844853,
--0.266710,
-0.449609,
-0.932993,
-0.928506,
-0.416430,
--0.325310,
--0.887640,
--0.960431,
--0.503538,
-0.231058,
-0.838225,
-0.983105,
-0.585798,
--0.134580,
--0.780737,
--0.996313,
--0.662416,
-0.036807,
-0.715731,
-0.999925,
-0.732655,
-0.061321,
--0.643832,
--0.993907,
--0.795837,
--0.158857,
-0.565731,
-0.978317,
-0.851355,
-0.254866,
--0.482184,
--0.953306,
--0.898674,
--0.348420,
-0.393991,
-0.919114,
-0.937339,
-0.438616,
--0.302006,
--0.876070,
--0.966976,
--0.524590,
-0.207111,
-0.824589,
-0.987301,
-0.605511,
--0.110221,
--0.765168,
--0.998118,
--0.680600,
-0.012271,
-0.698377,
-0.999322,
-0.749137,
-0.085797,
--0.624859,
--0.990903,
--0.810458,
--0.183038,
-0.545325,
-0.972940,
-0.863973,
-0.278521,
--0.460539,
--0.945607,
--0.909167,
--0.371317,
-0.371319,
-0.909168,
-0.945608,
-0.460538,
--0.278519,
--0.863973,
--0.972940,
--0.545324,
-0.183040,
-0.810456,
-0.990903,
-0.624860,
--0.085798,
--0.749136,
--0.999322,
--0.698376,
--0.012273,
-0.680601,
-0.998118,
-0.765167,
-0.110219,
--0.605509,
--0.987301,
--0.824588,
--0.207115,
-0.524588,
-0.966977,
-0.876069,
-0.302008,
--0.438616,
--0.937340,
--0.919115,
--0.393994,
-0.348419,
-0.898676,
-0.953307,
-0.482184,
--0.254867,
--0.851357,
--0.978318,
--0.565731,
-0.158861,
-0.795835,
-0.993907,
-0.643830,
--0.061324,
--0.732653,
--0.999925,
--0.715729,
--0.036810,
-0.662415,
-0.996313,
-0.780735,
-0.134583,
--0.585798,
--0.983106,
--0.838226,
--0.231059,
-0.503539,
-0.960431,
-0.887641,
-0.325310,
--0.416431,
--0.928505,
-0.923880,
-0.382683,
--0.382683,
--0.923880,
--0.923880,
--0.382684,
-0.382684,
-0.923880,
-0.923880,
-0.382683,
--0.382683,
--0.923879,
--0.923879,
--0.382684,
-0.382683,
-0.923880,
-0.923880,
-0.382684,
--0.382684,
--0.923879,
--0.923880,
--0.382683,
-0.382684,
-0.923880,
-0.923880,
-0.382684,
--0.382683,
--0.923880,
--0.923879,
--0.382683,
-0.382683,
-0.923879,
-0.923880,
-0.382683,
--0.382684,
--0.923880,
--0.923880,
--0.382684,
-0.382683,
-0.923880,
-0.923879,
-0.382683,
--0.382683,
--0.923880,
--0.923880,
--0.382685,
-0.382684,
-0.923879,
-0.923879,
-0.382684,
--0.382685,
--0.923880,
--0.923880,
--0.382683,
-0.382683,
-0.923880,
-0.923880,
-0.382685,
--0.382684,
--0.923879,
--0.923879,
--0.382684,
-0.382685,
-0.923880,
-0.923880,
-0.382683,
--0.382683,
--0.923880,
--0.923880,
--0.382685,
-0.382684,
-0.923879,
-0.923879,
-0.382684,
--0.382685,
--0.923880,
--0.923880,
--0.382683,
-0.382683,
-0.923880,
-0.923880,
-0.382685,
--0.382684,
--0.923881,
--0.923881,
--0.382684,
-0.382685,
-0.923878,
-0.923880,
-0.382683,
--0.382686,
--0.923879,
--0.923880,
--0.382681,
-0.382681,
-0.923879,
-0.923879,
-0.382680,
--0.382682,
--0.923880,
--0.923879,
--0.382686,
-0.382683,
-0.923880,
-0.923881,
-0.382685,
--0.382684,
--0.923881,
--0.923880,
--0.382684,
-0.382685,
-0.923878,
-0.923880,
-0.382682,
--0.382686,
--0.923879,
--0.923880,
--0.382681,
-0.382681,
-0.923879,
-0.923879,
-0.382680,
--0.382682,
--0.923880,
--0.923879,
--0.382686,
-0.382683,
-0.923880,
-0.919114,
-0.348419,
--0.438616,
--0.953306,
--0.876070,
--0.254865,
-0.524590,
-0.978317,
-0.824589,
-0.158858,
--0.605511,
--0.993907,
--0.765167,
--0.061321,
-0.680601,
-0.999925,
-0.698376,
--0.036807,
--0.749136,
--0.996313,
--0.624860,
-0.134581,
-0.810457,
-0.983105,
-0.545326,
--0.231058,
--0.863973,
--0.960430,
--0.460538,
-0.325309,
-0.909168,
-0.928506,
-0.371317,
--0.416430,
--0.945607,
--0.887640,
--0.278520,
-0.503539,
-0.972940,
-0.838225,
-0.183038,
--0.585798,
--0.990902,
--0.780737,
--0.085798,
-0.662417,
-0.999322,
-0.715732,
--0.012272,
--0.732654,
--0.998118,
--0.643832,
-0.110221,
-0.795837,
-0.987302,
-0.565731,
--0.207111,
--0.851354,
--0.966976,
--0.482184,
-0.302008,
-0.898675,
-0.937340,
-0.393991,
--0.393991,
--0.937340,
--0.898674,
--0.302007,
-0.482185,
-0.966976,
-0.851354,
-0.207111,
--0.565731,
--0.987302,
--0.795837,
--0.110220,
-0.643832,
-0.998118,
-0.732654,
-0.012268,
--0.715729,
--0.999322,
--0.662414,
-0.085795,
-0.780737,
-0.990902,
-0.585801,
--0.183039,
--0.838225,
--0.972939,
--0.503540,
-0.278520,
-0.887641,
-0.945608,
-0.416430,
--0.371319,
--0.928505,
--0.909168,
--0.325309,
-0.460542,
-0.960430,
-0.863973,
-0.231055,
--0.545323,
--0.983105,
--0.810456,
--0.134584,
-0.624859,
-0.996313,
-0.749134,
-0.036809,
--0.698377,
--0.999925,
--0.680603,
-0.061321,
-0.765169,
-0.993907,
-0.605512,
--0.158859,
--0.824591,
--0.978318,
--0.524589,
-0.254868,
-0.876069,
-0.953306,
-0.438614,
--0.348416,
--0.919114,
-0.914210,
-0.313682,
--0.492898,
--0.975702,
--0.817585,
--0.122411,
-0.653173,
-0.999699,
-0.689540,
--0.073565,
--0.788346,
--0.985278,
--0.534998,
-0.266713,
-0.893224,
-0.932993,
-0.359895,
--0.449612,
--0.963776,
--0.844853,
--0.170961,
-0.615231,
-0.997290,
-0.724247,
--0.024542,
--0.757208,
--0.992480,
--0.575808,
-0.219102,
-0.870087,
-0.949528,
-0.405241,
--0.405242,
--0.949528,
--0.870087,
--0.219101,
-0.575809,
-0.992479,
-0.757209,
-0.024543,
--0.724247,
--0.997291,
--0.615230,
-0.170962,
-0.844853,
-0.963776,
-0.449612,
--0.359897,
--0.932993,
--0.893225,
--0.266712,
-0.534997,
-0.985277,
-0.788346,
-0.073565,
--0.689542,
--0.999699,
--0.653174,
-0.122412,
-0.817585,
-0.975703,
-0.492898,
--0.313681,
--0.914210,
--0.914210,
--0.313683,
-0.492899,
-0.975702,
-0.817584,
-0.122410,
--0.653172,
--0.999699,
--0.689541,
-0.073563,
-0.788347,
-0.985278,
-0.534996,
--0.266713,
--0.893225,
--0.932994,
--0.359895,
-0.449613,
-0.963775,
-0.844854,
-0.170960,
--0.615229,
--0.997290,
--0.724246,
-0.024545,
-0.757208,
-0.992479,
-0.575806,
--0.219099,
--0.870087,
--0.949527,
--0.405244,
-0.405241,
-0.949529,
-0.870089,
-0.219102,
--0.575809,
--0.992480,
--0.757210,
--0.024540,
-0.724249,
-0.997291,
-0.615231,
--0.170964,
--0.844852,
--0.963776,
--0.449609,
-0.359892,
-0.932993,
-0.893224,
-0.266716,
--0.534996,
--0.985278,
--0.788344,
--0.073566,
-0.689541,
-0.999699,
-0.653175,
--0.122411,
--0.817586,
--0.975703,
--0.492899,
-0.313683,
-0.914208,
-0.909168,
-0.278520,
--0.545325,
--0.990903,
--0.749136,
-0.012272,
-0.765167,
-0.987301,
-0.524590,
--0.302006,
--0.919114,
--0.898674,
--0.254866,
-0.565732,
-0.993907,
-0.732655,
--0.036807,
--0.780737,
--0.983105,
--0.503539,
-0.325311,
-0.928506,
-0.887640,
-0.231058,
--0.585798,
--0.996313,
--0.715731,
-0.061321,
-0.795837,
-0.978317,
-0.482184,
--0.348419,
--0.937339,
--0.876070,
--0.207111,
-0.605512,
-0.998118,
-0.698376,
--0.085796,
--0.810458,
--0.972940,
--0.460540,
-0.371318,
-0.945607,
-0.863972,
-0.183040,
--0.624859,
--0.999322,
--0.680601,
-0.110221,
-0.824590,
-0.966977,
-0.438618,
--0.393993,
--0.953306,
--0.851354,
--0.158858,
-0.643831,
-0.999925,
-0.662416,
--0.134579,
--0.838225,
--0.960431,
--0.416431,
-0.416430,
-0.960430,
-0.838224,
-0.134580,
--0.662415,
--0.999925,
--0.643831,
-0.158857,
-0.851356,
-0.953306,
-0.393994,
--0.438614,
--0.966976,
--0.824588,
--0.110226,
-0.680600,
-0.999322,
-0.624862,
--0.183039,
--0.863973,
--0.945606,
--0.371319,
-0.460540,
-0.972941,
-0.810458,
-0.085797,
--0.698378,
--0.998118,
--0.605511,
-0.207114,
-0.876069,
-0.937339,
-0.348416,
--0.482181,
--0.978317,
--0.795836,
--0.061324,
-0.715730,
-0.996312,
-0.585801,
--0.231057,
--0.887640,
--0.928507,
--0.325312,
-0.503539,
-0.983106,
-0.780738,
-0.036806,
--0.732656,
--0.993907,
--0.565731,
-0.254868,
-0.898673,
-0.919114,
-0.302004,
--0.524587,
--0.987301,
--0.765166,
--0.012274,
-0.749136,
-0.990902,
-0.545328,
--0.278519,
--0.909169,
-0.903989,
-0.242980,
--0.595699,
--0.998795,
--0.671559,
-0.146730,
-0.857729,
-0.941544,
-0.336890,
--0.514103,
--0.989176,
--0.740951,
-0.049068,
-0.803208,
-0.970031,
-0.427555,
--0.427555,
--0.970031,
--0.803207,
--0.049068,
-0.740951,
-0.989176,
-0.514103,
--0.336890,
--0.941544,
--0.857728,
--0.146731,
-0.671559,
-0.998795,
-0.595700,
--0.242980,
--0.903990,
--0.903990,
--0.242980,
-0.595700,
-0.998795,
-0.671559,
--0.146729,
--0.857729,
--0.941544,
--0.336891,
-0.514104,
-0.989176,
-0.740952,
--0.049069,
--0.803207,
--0.970032,
--0.427554,
-0.427555,
-0.970031,
-0.803207,
-0.049068,
--0.740952,
--0.989176,
--0.514103,
-0.336891,
-0.941544,
-0.857729,
-0.146729,
--0.671559,
--0.998796,
--0.595698,
-0.242980,
-0.903989,
-0.903989,
-0.242980,
--0.595698,
--0.998796,
--0.671559,
-0.146729,
-0.857729,
-0.941544,
-0.336891,
--0.514104,
--0.989177,
--0.740952,
-0.049069,
-0.803210,
-0.970032,
-0.427554,
--0.427558,
--0.970031,
--0.803207,
--0.049064,
-0.740950,
-0.989176,
-0.514100,
--0.336888,
--0.941544,
--0.857727,
--0.146733,
-0.671559,
-0.998795,
-0.595701,
--0.242980,
--0.903990,
--0.903990,
--0.242980,
-0.595701,
-0.998795,
-0.671559,
--0.146733,
--0.857727,
--0.941544,
--0.336888,
-0.514100,
-0.989176,
-0.740950,
--0.049065,
--0.803207,
--0.970031,
--0.427558,
-0.427555,
-0.970032,
-0.803209,
-0.049068,
--0.740952,
--0.989177,
--0.514103,
-0.336892,
-0.941543,
-0.857729,
-0.146729,
--0.671556,
--0.998795,
--0.595698,
-0.242977,
-0.903989,
-0.898674,
-0.207111,
--0.643832,
--0.999322,
--0.585798,
-0.278520,
-0.928506,
-0.863973,
-0.134581,
--0.698376,
--0.993907,
--0.524590,
-0.348418,
-0.953306,
-0.824589,
-0.061321,
--0.749136,
--0.983105,
--0.460539,
-0.416430,
-0.972940,
-0.780737,
--0.012272,
--0.795837,
--0.966976,
--0.393991,
-0.482183,
-0.987301,
-0.732654,
--0.085797,
--0.838225,
--0.945608,
--0.325311,
-0.545325,
-0.996313,
-0.680601,
--0.158857,
--0.876071,
--0.919114,
--0.254867,
-0.605512,
-0.999925,
-0.624860,
--0.231059,
--0.909168,
--0.887640,
--0.183038,
-0.662416,
-0.998118,
-0.565731,
--0.302006,
--0.937339,
--0.851354,
--0.110222,
-0.715730,
-0.990902,
-0.503538,
--0.371317,
--0.960431,
--0.810457,
--0.036808,
-0.765166,
-0.978317,
-0.438617,
--0.438615,
--0.978318,
--0.765168,
-0.036806,
-0.810458,
-0.960431,
-0.371315,
--0.503536,
--0.990903,
--0.715729,
-0.110220,
-0.851355,
-0.937338,
-0.302008,
--0.565732,
--0.998118,
--0.662418,
-0.183040,
-0.887641,
-0.909169,
-0.231058,
--0.624862,
--0.999925,
--0.605511,
-0.254868,
-0.919113,
-0.876070,
-0.158855,
--0.680599,
--0.996313,
--0.545322,
-0.325308,
-0.945608,
-0.838223,
-0.085799,
--0.732655,
--0.987301,
--0.482185,
-0.393993,
-0.966977,
-0.795838,
-0.012271,
--0.780739,
--0.972940,
--0.416429,
-0.460542,
-0.983105,
-0.749136,
--0.061324,
--0.824588,
--0.953306,
--0.348415,
-0.524589,
-0.993907,
-0.698374,
--0.134579,
--0.863974,
--0.928507,
--0.278521,
-0.585799,
-0.999322,
-0.643832,
--0.207113,
--0.898673,
-0.893224,
-0.170962,
--0.689540,
--0.992480,
--0.492898,
-0.405241,
-0.975702,
-0.757209,
--0.073565,
--0.844854,
--0.932993,
--0.266713,
-0.615231,
-0.999699,
-0.575808,
--0.313682,
--0.949528,
--0.817585,
--0.024542,
-0.788346,
-0.963776,
-0.359895,
--0.534998,
--0.997290,
--0.653173,
-0.219102,
-0.914210,
-0.870087,
-0.122412,
--0.724247,
--0.985278,
--0.449612,
-0.449611,
-0.985278,
-0.724247,
--0.122409,
--0.870088,
--0.914210,
--0.219102,
-0.653174,
-0.997290,
-0.534998,
--0.359897,
--0.963776,
--0.788347,
-0.024539,
-0.817585,
-0.949528,
-0.313683,
--0.575809,
--0.999699,
--0.615232,
-0.266714,
-0.932993,
-0.844854,
-0.073563,
--0.757209,
--0.975702,
--0.405243,
-0.492899,
-0.992480,
-0.689542,
--0.170963,
--0.893224,
--0.893225,
--0.170960,
-0.689541,
-0.992480,
-0.492897,
--0.405242,
--0.975703,
--0.757210,
-0.073566,
-0.844856,
-0.932993,
-0.266711,
--0.615229,
--0.999699,
--0.575807,
-0.313679,
-0.949528,
-0.817584,
-0.024544,
--0.788346,
--0.963775,
--0.359898,
-0.534998,
-0.997291,
-0.653175,
--0.219101,
--0.914211,
--0.870088,
--0.122410,
-0.724249,
-0.985278,
-0.449611,
--0.449614,
--0.985277,
--0.724246,
-0.122414,
-0.870086,
-0.914209,
-0.219105,
--0.653172,
--0.997290,
--0.535000,
-0.359894,
-0.963777,
-0.788348,
--0.024541,
--0.817586,
--0.949529,
--0.313682,
-0.575810,
-0.999699,
-0.615231,
--0.266716,
--0.932992,
--0.844853,
--0.073561,
-0.757208,
-0.975702,
-0.405238,
--0.492897,
--0.992480,
--0.689543,
-0.170961,
-0.893225,
-0.887640,
-0.134581,
--0.732654,
--0.978317,
--0.393992,
-0.524590,
-0.998118,
-0.624860,
--0.278520,
--0.945607,
--0.810457,
-0.012271,
-0.824589,
-0.937339,
-0.254865,
--0.643832,
--0.996313,
--0.503539,
-0.416430,
-0.983105,
-0.715731,
--0.158857,
--0.898674,
--0.876070,
--0.110222,
-0.749137,
-0.972940,
-0.371317,
--0.545324,
--0.999322,
--0.605510,
-0.302006,
-0.953306,
-0.795837,
--0.036806,
--0.838225,
--0.928506,
--0.231059,
-0.662417,
-0.993907,
-0.482184,
--0.438615,
--0.987302,
--0.698376,
-0.183039,
-0.909169,
-0.863973,
-0.085798,
--0.765166,
--0.966976,
--0.348419,
-0.565731,
-0.999925,
-0.585798,
--0.325310,
--0.960431,
--0.780737,
-0.061320,
-0.851354,
-0.919113,
-0.207111,
--0.680600,
--0.990902,
--0.460538,
-0.460538,
-0.990902,
-0.680600,
--0.207108,
--0.919113,
--0.851354,
--0.061324,
-0.780737,
-0.960430,
-0.325313,
--0.585798,
--0.999925,
--0.565734,
-0.348419,
-0.966977,
-0.765168,
--0.085798,
--0.863975,
--0.909168,
--0.183038,
-0.698374,
-0.987302,
-0.438614,
--0.482181,
--0.993907,
--0.662414,
-0.231056,
-0.928506,
-0.838223,
-0.036809,
--0.795837,
--0.953305,
--0.302007,
-0.605512,
-0.999323,
-0.545326,
--0.371319,
--0.972939,
--0.749137,
-0.110225,
-0.876069,
-0.898674,
-0.158855,
--0.715729,
--0.983105,
--0.416426,
-0.503537,
-0.996313,
-0.643834,
--0.254865,
--0.937340,
--0.824591,
--0.012272,
-0.810459,
-0.945608,
-0.278520,
--0.624862,
--0.998118,
--0.524589,
-0.393995,
-0.978317,
-0.732653,
--0.134577,
--0.887639,
-0.881921,
-0.098017,
--0.773010,
--0.956940,
--0.290285,
-0.634393,
-0.995185,
-0.471397,
--0.471397,
--0.995185,
--0.634394,
-0.290284,
-0.956940,
-0.773010,
--0.098017,
--0.881921,
--0.881921,
--0.098018,
-0.773010,
-0.956940,
-0.290285,
--0.634394,
--0.995185,
--0.471396,
-0.471396,
-0.995185,
-0.634394,
--0.290285,
--0.956940,
--0.773010,
-0.098016,
-0.881921,
-0.881921,
-0.098015,
--0.773011,
--0.956940,
--0.290286,
-0.634394,
-0.995185,
-0.471397,
--0.471395,
--0.995185,
--0.634393,
-0.290284,
-0.956941,
-0.773010,
--0.098017,
--0.881921,
--0.881921,
--0.098017,
-0.773010,
-0.956941,
-0.290284,
--0.634393,
--0.995185,
--0.471398,
-0.471398,
-0.995185,
-0.634394,
--0.290286,
--0.956941,
--0.773011,
-0.098016,
-0.881922,
-0.881921,
-0.098018,
--0.773012,
--0.956941,
--0.290285,
-0.634395,
-0.995185,
-0.471396,
--0.471400,
--0.995185,
--0.634392,
-0.290281,
-0.956940,
-0.773009,
--0.098014,
--0.881921,
--0.881920,
--0.098019,
-0.773011,
-0.956939,
-0.290286,
--0.634394,
--0.995185,
--0.471397,
-0.471399,
-0.995184,
-0.634393,
--0.290288,
--0.956940,
--0.773010,
-0.098021,
-0.881921,
-0.881920,
-0.098020,
--0.773010,
--0.956940,
--0.290287,
-0.634394,
-0.995184,
-0.471398,
--0.471398,
--0.995185,
--0.634394,
-0.290286,
-0.956939,
-0.773011,
--0.098020,
--0.881920,
--0.881921,
--0.098014,
-0.773009,
-0.956940,
-0.290288,
--0.634393,
--0.995185,
--0.471399,
-0.471397,
-0.995185,
-0.634395,
--0.290285,
--0.956941,
--0.773011,
-0.098018,
-0.881920,
-0.876070,
-0.061321,
--0.810457,
--0.928506,
--0.183040,
-0.732654,
-0.966976,
-0.302006,
--0.643832,
--0.990903,
--0.416429,
-0.545325,
-0.999925,
-0.524589,
--0.438617,
--0.993907,
--0.624860,
-0.325311,
-0.972940,
-0.715731,
--0.207111,
--0.937339,
--0.795837,
-0.085798,
-0.887639,
-0.863973,
-0.036808,
--0.824589,
--0.919114,
--0.158858,
-0.749136,
-0.960430,
-0.278519,
--0.662416,
--0.987302,
--0.393994,
-0.565733,
-0.999322,
-0.503539,
--0.460537,
--0.996313,
--0.605511,
-0.348418,
-0.978317,
-0.698375,
--0.231058,
--0.945607,
--0.780738,
-0.110223,
-0.898675,
-0.851356,
-0.012273,
--0.838225,
--0.909168,
--0.134582,
-0.765166,
-0.953306,
-0.254866,
--0.680600,
--0.983106,
--0.371316,
-0.585798,
-0.998118,
-0.482185,
--0.482181,
--0.998118,
--0.585796,
-0.371315,
-0.983106,
-0.680598,
--0.254865,
--0.953307,
--0.765169,
-0.134581,
-0.909169,
-0.838226,
--0.012272,
--0.851357,
--0.898675,
--0.110220,
-0.780735,
-0.945607,
-0.231055,
--0.698375,
--0.978317,
--0.348415,
-0.605510,
-0.996312,
-0.460541,
--0.503538,
--0.999322,
--0.565734,
-0.393993,
-0.987302,
-0.662417,
--0.278521,
--0.960430,
--0.749137,
-0.158861,
-0.919113,
-0.824589,
--0.036811,
--0.863972,
--0.887639,
--0.085800,
-0.795837,
-0.937338,
-0.207114,
--0.715731,
--0.972939,
--0.325312,
-0.624861,
-0.993907,
-0.438617,
--0.524592,
--0.999925,
--0.545325,
-0.416433,
-0.990902,
-0.643830,
--0.302003,
--0.966976,
--0.732653,
-0.183038,
-0.928506,
-0.810455,
--0.061319,
--0.876071,
-0.870087,
-0.024541,
--0.844854,
--0.893224,
--0.073565,
-0.817585,
-0.914210,
-0.122411,
--0.788346,
--0.932993,
--0.170962,
-0.757209,
-0.949528,
-0.219101,
--0.724247,
--0.963776,
--0.266712,
-0.689540,
-0.975702,
-0.313682,
--0.653173,
--0.985278,
--0.359894,
-0.615232,
-0.992480,
-0.405241,
--0.575808,
--0.997290,
--0.449612,
-0.534998,
-0.999699,
-0.492898,
--0.492898,
--0.999699,
--0.534996,
-0.449612,
-0.997290,
-0.575809,
--0.405240,
--0.992480,
--0.615231,
-0.359894,
-0.985277,
-0.653172,
--0.313682,
--0.975702,
--0.689542,
-0.266714,
-0.963776,
-0.724247,
--0.219100,
--0.949529,
--0.757208,
-0.170962,
-0.932992,
-0.788348,
--0.122412,
--0.914210,
--0.817585,
-0.073563,
-0.893225,
-0.844853,
--0.024541,
--0.870088,
--0.870088,
--0.024540,
-0.844856,
-0.893225,
-0.073563,
--0.817583,
--0.914210,
--0.122408,
-0.788345,
-0.932992,
-0.170965,
--0.757208,
--0.949527,
--0.219104,
-0.724247,
-0.963775,
-0.266714,
--0.689542,
--0.975703,
--0.313682,
-0.653175,
-0.985278,
-0.359894,
--0.615229,
--0.992480,
--0.405239,
-0.575806,
-0.997290,
-0.449608,
--0.534996,
--0.999699,
--0.492901,
-0.492898,
-0.999699,
-0.534999,
--0.449612,
--0.997290,
--0.575809,
-0.405243,
-0.992479,
-0.615231,
--0.359898,
--0.985277,
--0.653172,
-0.313679,
-0.975702,
-0.689539,
--0.266711,
--0.963776,
--0.724245,
-0.219100,
-0.949529,
-0.757211,
--0.170962,
--0.932994,
--0.788347,
-0.122412,
-0.914208,
-0.817585,
--0.073567,
--0.893227,
--0.844857,
-0.024537,
-0.870086,
-0.863973,
--0.012271,
--0.876070,
--0.851355,
-0.036807,
-0.887640,
-0.838225,
--0.061321,
--0.898674,
--0.824589,
-0.085797,
-0.909168,
-0.810457,
--0.110223,
--0.919114,
--0.795837,
-0.134581,
-0.928506,
-0.780737,
--0.158857,
--0.937339,
--0.765168,
-0.183040,
-0.945607,
-0.749136,
--0.207111,
--0.953306,
--0.732654,
-0.231058,
-0.960431,
-0.715731,
--0.254865,
--0.966977,
--0.698375,
-0.278520,
-0.972940,
-0.680602,
--0.302007,
--0.978318,
--0.662416,
-0.325309,
-0.983105,
-0.643831,
--0.348419,
--0.987301,
--0.624860,
-0.371319,
-0.990903,
-0.605511,
--0.393991,
--0.993907,
--0.585797,
-0.416430,
-0.996313,
-0.565733,
--0.438615,
--0.998118,
--0.545325,
-0.460538,
-0.999322,
-0.524588,
--0.482181,
--0.999925,
--0.503536,
-0.503537,
-0.999925,
-0.482187,
--0.524590,
--0.999322,
--0.460540,
-0.545326,
-0.998118,
-0.438617,
--0.565734,
--0.996313,
--0.416429,
-0.585795,
-0.993907,
-0.393990,
--0.605509,
--0.990903,
--0.371314,
-0.624859,
-0.987301,
-0.348421,
--0.643832,
--0.983105,
--0.325312,
-0.662417,
-0.978318,
-0.302006,
--0.680603,
--0.972940,
--0.278518,
-0.698374,
-0.966977,
-0.254863,
--0.715729,
--0.960430,
--0.231062,
-0.732654,
-0.953305,
-0.207114,
--0.749137,
--0.945606,
--0.183041,
-0.765169,
-0.937340,
-0.158858,
--0.780739,
--0.928507,
--0.134579,
-0.795835,
-0.919114,
-0.110219,
--0.810456,
--0.909167,
--0.085800,
-0.824589,
-0.898673,
-0.061322,
--0.838221,
--0.887638,
--0.036808,
-0.851353,
-0.876067,
-0.012271,
--0.863971,
-0.857729,
--0.049068,
--0.903989,
--0.803208,
-0.146730,
-0.941544,
-0.740951,
--0.242980,
--0.970031,
--0.671559,
-0.336890,
-0.989176,
-0.595699,
--0.427555,
--0.998795,
--0.514103,
-0.514104,
-0.998795,
-0.427556,
--0.595700,
--0.989177,
--0.336891,
-0.671559,
-0.970031,
-0.242980,
--0.740951,
--0.941544,
--0.146730,
-0.803207,
-0.903989,
-0.049066,
--0.857729,
--0.857728,
-0.049067,
-0.903989,
-0.803206,
--0.146732,
--0.941544,
--0.740951,
-0.242979,
-0.970031,
-0.671558,
--0.336890,
--0.989176,
--0.595700,
-0.427553,
-0.998796,
-0.514102,
--0.514103,
--0.998796,
--0.427557,
-0.595700,
-0.989176,
-0.336890,
--0.671558,
--0.970032,
--0.242979,
-0.740952,
-0.941544,
-0.146731,
--0.803209,
--0.903990,
--0.049067,
-0.857731,
-0.857729,
--0.049070,
--0.903988,
--0.803207,
-0.146734,
-0.941544,
-0.740950,
--0.242978,
--0.970031,
--0.671562,
-0.336889,
-0.989177,
-0.595701,
--0.427556,
--0.998795,
--0.514103,
-0.514105,
-0.998796,
-0.427554,
--0.595696,
--0.989177,
--0.336888,
-0.671557,
-0.970031,
-0.242984,
--0.740951,
--0.941543,
--0.146733,
-0.803208,
-0.903991,
-0.049068,
--0.857730,
--0.857730,
-0.049069,
-0.903988,
-0.803208,
--0.146733,
--0.941543,
--0.740950,
-0.242977,
-0.970031,
-0.671557,
--0.336888,
--0.989177,
--0.595702,
-0.427555,
-0.998796,
-0.514104,
--0.514104,
--0.998796,
--0.427555,
-0.595702,
-0.989177,
-0.336889,
--0.671557,
--0.970031,
--0.242977,
-0.740955,
-0.941546,
-0.146734,
--0.803207,
--0.903988,
--0.049062,
-0.857725,
-0.851355,
--0.085797,
--0.928506,
--0.749136,
-0.254865,
-0.978317,
-0.624860,
--0.416429,
--0.999322,
--0.482184,
-0.565732,
-0.990903,
-0.325310,
--0.698376,
--0.953306,
--0.158857,
-0.810457,
-0.887640,
--0.012272,
--0.898674,
--0.795837,
-0.183040,
-0.960430,
-0.680602,
--0.348419,
--0.993907,
--0.545326,
-0.503539,
-0.998118,
-0.393991,
--0.643832,
--0.972940,
--0.231059,
-0.765166,
-0.919113,
-0.061320,
--0.863973,
--0.838225,
-0.110221,
-0.937340,
-0.732654,
--0.278520,
--0.983105,
--0.605512,
-0.438615,
-0.999925,
-0.460538,
--0.585798,
--0.987302,
--0.302007,
-0.715732,
-0.945607,
-0.134580,
--0.824589,
--0.876071,
-0.036806,
-0.909169,
-0.780737,
--0.207108,
--0.966976,
--0.662414,
-0.371315,
-0.996313,
-0.524592,
--0.524590,
--0.996312,
--0.371319,
-0.662417,
-0.966977,
-0.207111,
--0.780739,
--0.909168,
--0.036805,
-0.876069,
-0.824589,
--0.134584,
--0.945607,
--0.715729,
-0.302004,
-0.987302,
-0.585801,
--0.460538,
--0.999925,
--0.438618,
-0.605512,
-0.983106,
-0.278520,
--0.732656,
--0.937339,
--0.110220,
-0.838223,
-0.863973,
--0.061324,
--0.919114,
--0.765166,
-0.231056,
-0.972940,
-0.643834,
--0.393992,
--0.998118,
--0.503540,
-0.545326,
-0.993907,
-0.348419,
--0.680603,
--0.960431,
--0.183038,
-0.795835,
-0.898674,
-0.012268,
--0.887639,
--0.810456,
-0.158856,
-0.953306,
-0.698379,
--0.325310,
--0.990902,
--0.565727,
-0.482185,
-0.999323,
-0.416423,
--0.624862,
--0.978318,
--0.254872,
-0.749139,
-0.928506,
-0.085802,
--0.851359,
-0.844854,
--0.122411,
--0.949528,
--0.689541,
-0.359895,
-0.997290,
-0.492898,
--0.575808,
--0.985278,
--0.266713,
-0.757209,
-0.914210,
-0.024541,
--0.893224,
--0.788346,
-0.219101,
-0.975702,
-0.615231,
--0.449611,
--0.999699,
--0.405241,
-0.653173,
-0.963776,
-0.170961,
--0.817585,
--0.870087,
-0.073565,
-0.932993,
-0.724247,
--0.313681,
--0.992479,
--0.534996,
-0.534999,
-0.992479,
-0.313682,
--0.724247,
--0.932993,
--0.073563,
-0.870088,
-0.817584,
--0.170962,
--0.963776,
--0.653174,
-0.405240,
-0.999699,
-0.449611,
--0.615232,
--0.975702,
--0.219102,
-0.788345,
-0.893224,
--0.024542,
--0.914210,
--0.757209,
-0.266712,
-0.985277,
-0.575807,
--0.492899,
--0.997291,
--0.359895,
-0.689543,
-0.949529,
-0.122409,
--0.844852,
--0.844853,
-0.122414,
-0.949528,
-0.689539,
--0.359893,
--0.997291,
--0.492901,
-0.575808,
-0.985277,
-0.266714,
--0.757210,
--0.914211,
--0.024540,
-0.893223,
-0.788347,
--0.219104,
--0.975702,
--0.615230,
-0.449609,
-0.999699,
-0.405238,
--0.653172,
--0.963775,
--0.170964,
-0.817585,
-0.870089,
--0.073564,
--0.932994,
--0.724248,
-0.313683,
-0.992479,
-0.534997,
--0.535001,
--0.992480,
--0.313679,
-0.724246,
-0.932992,
-0.073568,
--0.870087,
--0.817583,
-0.170961,
-0.963777,
-0.653175,
--0.405242,
--0.999699,
--0.449612,
-0.615234,
-0.975702,
-0.219100,
--0.788349,
--0.893228,
-0.024537,
-0.914209,
-0.757207,
--0.266718,
--0.985277,
--0.575811,
-0.492898,
-0.997290,
-0.359889,
--0.689536,
--0.949529,
--0.122410,
-0.844856,
-0.838225,
--0.158858,
--0.966976,
--0.624859,
-0.460539,
-0.998118,
-0.348419,
--0.715731,
--0.928506,
--0.036808,
-0.898674,
-0.765167,
--0.278520,
--0.990903,
--0.524590,
-0.565731,
-0.983105,
-0.231058,
--0.795837,
--0.876070,
-0.085798,
-0.945607,
-0.680602,
--0.393993,
--0.999925,
--0.416430,
-0.662416,
-0.953306,
-0.110221,
--0.863973,
--0.810457,
-0.207111,
-0.978317,
-0.585799,
--0.503537,
--0.993907,
--0.302005,
-0.749137,
-0.909168,
--0.012271,
--0.919113,
--0.732655,
-0.325312,
-0.996313,
-0.482183,
--0.605511,
--0.972940,
--0.183041,
-0.824588,
-0.851354,
--0.134582,
--0.960431,
--0.643831,
-0.438616,
-0.999322,
-0.371315,
--0.698375,
--0.937339,
--0.061324,
-0.887640,
-0.780735,
--0.254865,
--0.987302,
--0.545327,
-0.545326,
-0.987302,
-0.254866,
--0.780739,
--0.887640,
-0.061323,
-0.937338,
-0.698375,
--0.371314,
--0.999322,
--0.438613,
-0.643831,
-0.960430,
-0.134583,
--0.851356,
--0.824591,
-0.183040,
-0.972941,
-0.605512,
--0.482186,
--0.996313,
--0.325309,
-0.732652,
-0.919114,
-0.012268,
--0.909168,
--0.749135,
-0.302004,
-0.993907,
-0.503541,
--0.585798,
--0.978317,
--0.207112,
-0.810459,
-0.863974,
--0.110223,
--0.953305,
--0.662416,
-0.416433,
-0.999925,
-0.393990,
--0.680600,
--0.945607,
--0.085800,
-0.876070,
-0.795835,
--0.231057,
--0.983105,
--0.565727,
-0.524591,
-0.990903,
-0.278527,
--0.765169,
--0.898675,
-0.036802,
-0.928508,
-0.715730,
--0.348416,
--0.998118,
--0.460536,
-0.624859,
-0.966978,
-0.158853,
--0.838225,
-0.831470,
--0.195090,
--0.980785,
--0.555570,
-0.555570,
-0.980785,
-0.195091,
--0.831470,
--0.831470,
-0.195091,
-0.980785,
-0.555570,
--0.555570,
--0.980785,
--0.195090,
-0.831470,
-0.831470,
--0.195090,
--0.980785,
--0.555570,
-0.555570,
-0.980785,
-0.195090,
--0.831470,
--0.831470,
-0.195090,
-0.980785,
-0.555570,
--0.555570,
--0.980785,
--0.195091,
-0.831469,
-0.831469,
--0.195092,
--0.980785,
--0.555570,
-0.555570,
-0.980785,
-0.195091,
--0.831469,
--0.831469,
-0.195092,
-0.980785,
-0.555570,
--0.555570,
--0.980785,
--0.195091,
-0.831469,
-0.831469,
--0.195092,
--0.980785,
--0.555570,
-0.555570,
-0.980785,
-0.195091,
--0.831471,
--0.831471,
-0.195092,
-0.980785,
-0.555570,
--0.555573,
--0.980785,
--0.195088,
-0.831469,
-0.831469,
--0.195088,
--0.980785,
--0.555573,
-0.555570,
-0.980785,
-0.195091,
--0.831471,
--0.831471,
-0.195092,
-0.980785,
-0.555570,
--0.555573,
--0.980785,
--0.195088,
-0.831469,
-0.831469,
--0.195088,
--0.980785,
--0.555573,
-0.555570,
-0.980785,
-0.195091,
--0.831471,
--0.831471,
-0.195092,
-0.980785,
-0.555570,
--0.555567,
--0.980785,
--0.195087,
-0.831469,
-0.831469,
--0.195088,
--0.980785,
--0.555573,
-0.555570,
-0.980785,
-0.195091,
--0.831471,
--0.831471,
-0.195092,
-0.980785,
-0.555570,
--0.555567,
--0.980785,
--0.195087,
-0.831473,
-0.831473,
--0.195088,
--0.980785,
--0.555567,
-0.555564,
-0.980786,
-0.195091,
--0.831471,
--0.831466,
-0.195084,
-0.980785,
-0.555570,
--0.555574,
--0.980784,
--0.195095,
-0.831469,
-0.824589,
--0.231058,
--0.990903,
--0.482184,
-0.643832,
-0.945607,
-0.036807,
--0.919114,
--0.698376,
-0.416430,
-0.998118,
-0.302006,
--0.780737,
--0.863973,
-0.158858,
-0.978317,
-0.545326,
--0.585798,
--0.966976,
--0.110222,
-0.887639,
-0.749136,
--0.348419,
--0.999925,
--0.371318,
-0.732654,
-0.898674,
--0.085796,
--0.960431,
--0.605510,
-0.524591,
-0.983105,
-0.183040,
--0.851355,
--0.795837,
-0.278519,
-0.996312,
-0.438618,
--0.680602,
--0.928506,
-0.012272,
-0.937339,
-0.662416,
--0.460538,
--0.993907,
--0.254867,
-0.810456,
-0.838224,
--0.207113,
--0.987302,
--0.503538,
-0.624860,
-0.953306,
-0.061318,
--0.909168,
--0.715729,
-0.393990,
-0.999322,
-0.325313,
--0.765168,
--0.876072,
-0.134581,
-0.972941,
-0.565733,
--0.565734,
--0.972940,
--0.134579,
-0.876069,
-0.765167,
--0.325307,
--0.999322,
--0.393989,
-0.715730,
-0.909167,
--0.061319,
--0.953307,
--0.624861,
-0.503539,
-0.987302,
-0.207111,
--0.838227,
--0.810458,
-0.254868,
-0.993907,
-0.460537,
--0.662414,
--0.937339,
--0.012274,
-0.928506,
-0.680604,
--0.438616,
--0.996312,
--0.278521,
-0.795838,
-0.851356,
--0.183041,
--0.983105,
--0.524589,
-0.605508,
-0.960431,
-0.085794,
--0.898674,
--0.732653,
-0.371316,
-0.999925,
-0.348421,
--0.749132,
--0.887638,
-0.110222,
-0.966975,
-0.585792,
--0.545327,
--0.978318,
--0.158864,
-0.863975,
-0.780737,
--0.302003,
--0.998118,
--0.416426,
-0.698376,
-0.919116,
--0.036813,
--0.945608,
--0.643833,
-0.482178,
-0.990902,
-0.231058,
--0.824587,
-0.817585,
--0.266713,
--0.997290,
--0.405242,
-0.724247,
-0.893224,
--0.122411,
--0.975702,
--0.534998,
-0.615231,
-0.949528,
-0.024541,
--0.932993,
--0.653173,
-0.492899,
-0.985278,
-0.170962,
--0.870087,
--0.757209,
-0.359894,
-0.999699,
-0.313681,
--0.788346,
--0.844854,
-0.219101,
-0.992479,
-0.449611,
--0.689541,
--0.914210,
-0.073564,
-0.963776,
-0.575809,
--0.575807,
--0.963777,
--0.073563,
-0.914210,
-0.689540,
--0.449612,
--0.992479,
--0.219101,
-0.844853,
-0.788347,
--0.313681,
--0.999699,
--0.359896,
-0.757208,
-0.870086,
--0.170963,
--0.985278,
--0.492898,
-0.653173,
-0.932993,
--0.024541,
--0.949529,
--0.615232,
-0.535000,
-0.975703,
-0.122409,
--0.893223,
--0.724246,
-0.405238,
-0.997290,
-0.266716,
--0.817585,
--0.817583,
-0.266712,
-0.997291,
-0.405243,
--0.724248,
--0.893225,
-0.122412,
-0.975701,
-0.534997,
--0.615229,
--0.949528,
--0.024538,
-0.932993,
-0.653171,
--0.492897,
--0.985277,
--0.170964,
-0.870088,
-0.757211,
--0.359896,
--0.999699,
--0.313682,
-0.788349,
-0.844854,
--0.219104,
--0.992479,
--0.449609,
-0.689539,
-0.914209,
--0.073562,
--0.963776,
--0.575811,
-0.575808,
-0.963775,
-0.073565,
--0.914211,
--0.689541,
-0.449613,
-0.992480,
-0.219100,
--0.844856,
--0.788351,
-0.313679,
-0.999699,
-0.359892,
--0.757214,
--0.870089,
-0.170961,
-0.985278,
-0.492893,
--0.653168,
--0.932994,
-0.024542,
-0.949530,
-0.615237,
--0.534994,
--0.975702,
--0.122407,
-0.893227,
-0.724251,
--0.405240,
--0.997290,
--0.266708,
-0.817581,
-0.810457,
--0.302006,
--0.999925,
--0.325310,
-0.795837,
-0.824589,
--0.278520,
--0.999322,
--0.348419,
-0.780737,
-0.838225,
--0.254865,
--0.998118,
--0.371317,
-0.765167,
-0.851355,
--0.231058,
--0.996313,
--0.393991,
-0.749137,
-0.863973,
--0.207111,
--0.993907,
--0.416430,
-0.732654,
-0.876070,
--0.183039,
--0.990902,
--0.438618,
-0.715732,
-0.887639,
--0.158859,
--0.987302,
--0.460538,
-0.698377,
-0.898674,
--0.134581,
--0.983105,
--0.482184,
-0.680600,
-0.909168,
--0.110221,
--0.978317,
--0.503537,
-0.662417,
-0.919113,
--0.085798,
--0.972940,
--0.524589,
-0.643832,
-0.928506,
--0.061324,
--0.966976,
--0.545322,
-0.624859,
-0.937338,
--0.036806,
--0.960431,
--0.565734,
-0.605512,
-0.945608,
--0.012272,
--0.953305,
--0.585798,
-0.585795,
-0.953306,
-0.012268,
--0.945607,
--0.605509,
-0.565731,
-0.960430,
-0.036809,
--0.937340,
--0.624861,
-0.545326,
-0.966977,
-0.061320,
--0.928505,
--0.643831,
-0.524593,
-0.972940,
-0.085794,
--0.919114,
--0.662414,
-0.503537,
-0.978317,
-0.110224,
--0.909169,
--0.680603,
-0.482185,
-0.983106,
-0.134580,
--0.898673,
--0.698376,
-0.460542,
-0.987302,
-0.158855,
--0.887639,
--0.715729,
-0.438615,
-0.990902,
-0.183042,
--0.876071,
--0.732656,
-0.416423,
-0.993906,
-0.207111,
--0.863971,
--0.749131,
-0.393995,
-0.996313,
-0.231063,
--0.851359,
--0.765166,
-0.371316,
-0.998118,
-0.254860,
--0.838225,
--0.780739,
-0.348412,
-0.999322,
-0.278519,
--0.824587,
--0.795832,
-0.325313,
-0.999925,
-0.302011,
--0.810461,
-0.803208,
--0.336890,
--0.998795,
--0.242980,
-0.857729,
-0.740951,
--0.427555,
--0.989176,
--0.146730,
-0.903989,
-0.671559,
--0.514102,
--0.970031,
--0.049068,
-0.941544,
-0.595699,
--0.595700,
--0.941544,
-0.049068,
-0.970031,
-0.514103,
--0.671559,
--0.903990,
-0.146730,
-0.989177,
-0.427554,
--0.740951,
--0.857728,
-0.242980,
-0.998795,
-0.336890,
--0.803207,
--0.803208,
-0.336889,
-0.998796,
-0.242981,
--0.857728,
--0.740952,
-0.427553,
-0.989176,
-0.146729,
--0.903990,
--0.671558,
-0.514104,
-0.970031,
-0.049067,
--0.941544,
--0.595699,
-0.595699,
-0.941544,
--0.049067,
--0.970032,
--0.514103,
-0.671561,
-0.903990,
--0.146733,
--0.989176,
--0.427553,
-0.740950,
-0.857728,
--0.242978,
--0.998796,
--0.336892,
-0.803208,
-0.803209,
--0.336890,
--0.998796,
--0.242980,
-0.857731,
-0.740951,
--0.427558,
--0.989177,
--0.146728,
-0.903989,
-0.671557,
--0.514102,
--0.970031,
--0.049069,
-0.941545,
-0.595701,
--0.595700,
--0.941545,
-0.049069,
-0.970031,
-0.514102,
--0.671556,
--0.903989,
-0.146727,
-0.989176,
-0.427552,
--0.740951,
--0.857727,
-0.242979,
-0.998796,
-0.336891,
--0.803209,
--0.803209,
-0.336892,
-0.998796,
-0.242979,
--0.857727,
--0.740950,
-0.427559,
-0.989178,
-0.146734,
--0.903989,
--0.671556,
-0.514109,
-0.970032,
-0.049068,
--0.941545,
--0.595694,
-0.595695,
-0.941544,
--0.049070,
--0.970033,
--0.514108,
-0.671557,
-0.903989,
--0.146736,
--0.989176,
--0.427558,
-0.740952,
-0.857726,
--0.242973,
--0.998795,
--0.336890,
-0.803210,
-0.795837,
--0.371317,
--0.993907,
--0.158858,
-0.909168,
-0.643832,
--0.565732,
--0.945607,
-0.061321,
-0.978317,
-0.460539,
--0.732655,
--0.851355,
-0.278520,
-0.999925,
-0.254866,
--0.863973,
--0.715731,
-0.482183,
-0.972940,
-0.036808,
--0.953306,
--0.545326,
-0.662416,
-0.898674,
--0.183039,
--0.996312,
--0.348420,
-0.810456,
-0.780738,
--0.393994,
--0.990902,
--0.134579,
-0.919114,
-0.624858,
--0.585799,
--0.937339,
-0.085798,
-0.983106,
-0.438616,
--0.749137,
--0.838224,
-0.302006,
-0.999322,
-0.231058,
--0.876070,
--0.698376,
-0.503538,
-0.966977,
-0.012268,
--0.960430,
--0.524587,
-0.680600,
-0.887638,
--0.207110,
--0.998118,
--0.325312,
-0.824591,
-0.765168,
--0.416431,
--0.987302,
--0.110220,
-0.928505,
-0.605510,
--0.605509,
--0.928506,
-0.110220,
-0.987302,
-0.416432,
--0.765168,
--0.824591,
-0.325311,
-0.998118,
-0.207111,
--0.887638,
--0.680601,
-0.524593,
-0.960431,
--0.012275,
--0.966976,
--0.503536,
-0.698376,
-0.876069,
--0.231057,
--0.999322,
--0.302007,
-0.838226,
-0.749137,
--0.438618,
--0.983106,
--0.085795,
-0.937338,
-0.585796,
--0.624858,
--0.919113,
-0.134578,
-0.990903,
-0.393995,
--0.780733,
--0.810454,
-0.348419,
-0.996313,
-0.183047,
--0.898676,
--0.662416,
-0.545322,
-0.953304,
--0.036811,
--0.972940,
--0.482187,
-0.715736,
-0.863971,
--0.254865,
--0.999925,
--0.278513,
-0.851357,
-0.732655,
--0.460534,
--0.978316,
--0.061319,
-0.945607,
-0.565737,
--0.643836,
--0.909167,
-0.158856,
-0.993906,
-0.371312,
--0.795838,
-0.788346,
--0.405241,
--0.985278,
--0.073565,
-0.949528,
-0.534997,
--0.689540,
--0.870087,
-0.266713,
-0.999699,
-0.219101,
--0.893224,
--0.653173,
-0.575808,
-0.932993,
--0.122410,
--0.992479,
--0.359894,
-0.817585,
-0.757208,
--0.449612,
--0.975702,
--0.024541,
-0.963776,
-0.492898,
--0.724247,
--0.844853,
-0.313682,
-0.997290,
-0.170962,
--0.914210,
--0.615231,
-0.615232,
-0.914210,
--0.170962,
--0.997290,
--0.313682,
-0.844853,
-0.724247,
--0.492898,
--0.963776,
-0.024541,
-0.975702,
-0.449612,
--0.757208,
--0.817585,
-0.359894,
-0.992480,
-0.122411,
--0.932994,
--0.575809,
-0.653175,
-0.893225,
--0.219104,
--0.999699,
--0.266710,
-0.870086,
-0.689539,
--0.534996,
--0.949527,
-0.073563,
-0.985278,
-0.405243,
--0.788348,
--0.788347,
-0.405243,
-0.985278,
-0.073563,
--0.949528,
--0.534996,
-0.689539,
-0.870086,
--0.266711,
--0.999699,
--0.219103,
-0.893225,
-0.653175,
--0.575809,
--0.932994,
-0.122412,
-0.992479,
-0.359894,
--0.817583,
--0.757208,
-0.449609,
-0.975702,
-0.024544,
--0.963776,
--0.492901,
-0.724248,
-0.844855,
--0.313682,
--0.997291,
--0.170961,
-0.914208,
-0.615231,
--0.615229,
--0.914213,
-0.170958,
-0.997290,
-0.313678,
--0.844849,
--0.724250,
-0.492898,
-0.963775,
--0.024549,
--0.975701,
--0.449612,
-0.757211,
-0.817581,
--0.359891,
--0.992480,
--0.122407,
-0.932995,
-0.575812,
--0.653172,
--0.893223,
-0.219108,
-0.999699,
-0.266714,
--0.870088,
--0.689536,
-0.534993,
-0.949529,
--0.073567,
--0.985279,
--0.405246,
-0.788346,
-0.780737,
--0.438616,
--0.972940,
-0.012272,
-0.978317,
-0.416429,
--0.795837,
--0.765167,
-0.460539,
-0.966976,
--0.036807,
--0.983106,
--0.393992,
-0.810457,
-0.749136,
--0.482184,
--0.960430,
-0.061321,
-0.987301,
-0.371317,
--0.824589,
--0.732654,
-0.503539,
-0.953306,
--0.085796,
--0.990902,
--0.348420,
-0.838224,
-0.715732,
--0.524588,
--0.945608,
-0.110221,
-0.993907,
-0.325312,
--0.851354,
--0.698377,
-0.545324,
-0.937340,
--0.134579,
--0.996312,
--0.302007,
-0.863972,
-0.680602,
--0.565731,
--0.928507,
-0.158857,
-0.998118,
-0.278517,
--0.876069,
--0.662414,
-0.585797,
-0.919113,
--0.183039,
--0.999322,
--0.254867,
-0.887641,
-0.643832,
--0.605513,
--0.909168,
-0.207114,
-0.999925,
-0.231055,
--0.898674,
--0.624857,
-0.624859,
-0.898673,
--0.231057,
--0.999925,
--0.207112,
-0.909169,
-0.605512,
--0.643834,
--0.887640,
-0.254868,
-0.999322,
-0.183037,
--0.919114,
--0.585795,
-0.662415,
-0.876069,
--0.278519,
--0.998118,
--0.158859,
-0.928507,
-0.565732,
--0.680603,
--0.863973,
-0.302009,
-0.996313,
-0.134578,
--0.937339,
--0.545322,
-0.698376,
-0.851354,
--0.325310,
--0.993907,
--0.110215,
-0.945608,
-0.524590,
--0.715728,
--0.838221,
-0.348422,
-0.990903,
-0.085802,
--0.953308,
--0.503536,
-0.732654,
-0.824592,
--0.371324,
--0.987301,
--0.061321,
-0.960429,
-0.482177,
--0.749139,
--0.810457,
-0.393988,
-0.983104,
-0.036804,
--0.966976,
--0.460542,
-0.765172,
-0.795835,
--0.416429,
--0.978318,
--0.012264,
-0.972941,
-0.438616,
--0.780735,
-0.773010,
--0.471397,
--0.956940,
-0.098017,
-0.995185,
-0.290285,
--0.881921,
--0.634394,
-0.634393,
-0.881921,
--0.290285,
--0.995185,
--0.098018,
-0.956940,
-0.471397,
--0.773010,
--0.773011,
-0.471396,
-0.956940,
--0.098017,
--0.995185,
--0.290285,
-0.881921,
-0.634393,
--0.634393,
--0.881921,
-0.290285,
-0.995185,
-0.098017,
--0.956940,
--0.471396,
-0.773011,
-0.773010,
--0.471398,
--0.956940,
-0.098018,
-0.995185,
-0.290284,
--0.881922,
--0.634392,
-0.634394,
-0.881921,
--0.290286,
--0.995185,
--0.098015,
-0.956941,
-0.471398,
--0.773012,
--0.773012,
-0.471399,
-0.956941,
--0.098019,
--0.995185,
--0.290282,
-0.881921,
-0.634391,
--0.634392,
--0.881920,
-0.290284,
-0.995184,
-0.098018,
--0.956941,
--0.471397,
-0.773013,
-0.773011,
--0.471400,
--0.956940,
-0.098021,
-0.995185,
-0.290288,
--0.881921,
--0.634396,
-0.634394,
-0.881923,
--0.290285,
--0.995185,
--0.098017,
-0.956939,
-0.471396,
--0.773009,
--0.773010,
-0.471394,
-0.956940,
--0.098015,
--0.995185,
--0.290287,
-0.881922,
-0.634395,
--0.634395,
--0.881922,
-0.290286,
-0.995185,
-0.098015,
--0.956940,
--0.471395,
-0.773014,
-0.773014,
--0.471395,
--0.956940,
-0.098023,
-0.995184,
-0.290286,
--0.881923,
--0.634388,
-0.634390,
-0.881922,
--0.290288,
--0.995184,
--0.098021,
-0.956940,
-0.471394,
--0.773015,
--0.773013,
-0.471397,
-0.956939,
--0.098010,
--0.995184,
--0.290284,
-0.881923,
-0.634399,
--0.634391,
--0.881921,
-0.290289,
-0.995185,
-0.098020,
--0.956941,
--0.471393,
-0.773006,
-0.765167,
--0.503538,
--0.937339,
-0.183040,
-0.999925,
-0.158858,
--0.945607,
--0.482184,
-0.780737,
-0.749137,
--0.524589,
--0.928506,
-0.207111,
-0.999322,
-0.134580,
--0.953306,
--0.460538,
-0.795837,
-0.732654,
--0.545324,
--0.919114,
-0.231058,
-0.998118,
-0.110221,
--0.960431,
--0.438618,
-0.810456,
-0.715732,
--0.565731,
--0.909168,
-0.254865,
-0.996313,
-0.085798,
--0.966976,
--0.416430,
-0.824589,
-0.698376,
--0.585798,
--0.898674,
-0.278520,
-0.993907,
-0.061320,
--0.972940,
--0.393991,
-0.838225,
-0.680600,
--0.605509,
--0.887639,
-0.302004,
-0.990902,
-0.036809,
--0.978318,
--0.371319,
-0.851356,
-0.662417,
--0.624862,
--0.876071,
-0.325313,
-0.987302,
-0.012268,
--0.983105,
--0.348415,
-0.863973,
-0.643834,
--0.643832,
--0.863975,
-0.348419,
-0.983106,
--0.012272,
--0.987301,
--0.325309,
-0.876069,
-0.624858,
--0.662414,
--0.851354,
-0.371315,
-0.978317,
--0.036806,
--0.990903,
--0.302007,
-0.887641,
-0.605512,
--0.680603,
--0.838225,
-0.393995,
-0.972940,
--0.061324,
--0.993907,
--0.278523,
-0.898675,
-0.585801,
--0.698377,
--0.824591,
-0.416423,
-0.966975,
--0.085799,
--0.996312,
--0.254872,
-0.909170,
-0.565730,
--0.715730,
--0.810460,
-0.438622,
-0.960430,
--0.110221,
--0.998118,
--0.231052,
-0.919115,
-0.545326,
--0.732651,
--0.795832,
-0.460542,
-0.953306,
--0.134577,
--0.999322,
--0.207107,
-0.928506,
-0.524592,
--0.749132,
--0.780734,
-0.482185,
-0.945608,
--0.158852,
--0.999925,
--0.183038,
-0.937338,
-0.503543,
--0.765171,
-0.757209,
--0.534998,
--0.914210,
-0.266713,
-0.992480,
-0.024541,
--0.985278,
--0.313682,
-0.893224,
-0.575808,
--0.724247,
--0.788346,
-0.492899,
-0.932993,
--0.219101,
--0.997290,
--0.073565,
-0.975702,
-0.359895,
--0.870087,
--0.615231,
-0.689540,
-0.817585,
--0.449611,
--0.949528,
-0.170962,
-0.999699,
-0.122410,
--0.963776,
--0.405241,
-0.844854,
-0.653172,
--0.653174,
--0.844853,
-0.405240,
-0.963777,
--0.122409,
--0.999699,
--0.170963,
-0.949528,
-0.449612,
--0.817585,
--0.689541,
-0.615232,
-0.870087,
--0.359896,
--0.975703,
-0.073566,
-0.997290,
-0.219100,
--0.932992,
--0.492897,
-0.788345,
-0.724245,
--0.575807,
--0.893223,
-0.313681,
-0.985277,
--0.024541,
--0.992480,
--0.266713,
-0.914208,
-0.534997,
--0.757207,
--0.757208,
-0.534995,
-0.914209,
--0.266711,
--0.992479,
--0.024543,
-0.985278,
-0.313683,
--0.893226,
--0.575809,
-0.724249,
-0.788347,
--0.492901,
--0.932993,
-0.219098,
-0.997290,
-0.073568,
--0.975702,
--0.359898,
-0.870088,
-0.615233,
--0.689542,
--0.817586,
-0.449613,
-0.949529,
--0.170965,
--0.999699,
--0.122415,
-0.963776,
-0.405238,
--0.844849,
--0.653176,
-0.653173,
-0.844851,
--0.405235,
--0.963777,
-0.122412,
-0.999699,
-0.170968,
--0.949528,
--0.449609,
-0.817588,
-0.689544,
--0.615231,
--0.870085,
-0.359902,
-0.975703,
--0.073565,
--0.997291,
--0.219108,
-0.932992,
-0.492897,
--0.788349,
--0.724251,
-0.575806,
-0.893224,
--0.313687,
--0.985279,
-0.024540,
-0.992480,
-0.266706,
--0.914208,
--0.534998,
-0.757211,
-0.749136,
--0.565732,
--0.887640,
-0.348419,
-0.972940,
--0.110222,
--0.999925,
--0.134580,
-0.966976,
-0.371317,
--0.876070,
--0.585798,
-0.732654,
-0.765167,
--0.545325,
--0.898674,
-0.325309,
-0.978317,
--0.085797,
--0.999322,
--0.158858,
-0.960431,
-0.393991,
--0.863973,
--0.605510,
-0.715732,
-0.780738,
--0.524588,
--0.909168,
-0.302005,
-0.983106,
--0.061320,
--0.998118,
--0.183040,
-0.953306,
-0.416429,
--0.851356,
--0.624858,
-0.698377,
-0.795838,
--0.503537,
--0.919114,
-0.278519,
-0.987302,
--0.036811,
--0.996313,
--0.207115,
-0.945607,
-0.438619,
--0.838225,
--0.643833,
-0.680602,
-0.810458,
--0.482186,
--0.928507,
-0.254868,
-0.990903,
--0.012275,
--0.993907,
--0.231062,
-0.937339,
-0.460541,
--0.824590,
--0.662418,
-0.662417,
-0.824590,
--0.460541,
--0.937339,
-0.231061,
-0.993907,
-0.012268,
--0.990903,
--0.254869,
-0.928506,
-0.482186,
--0.810458,
--0.680603,
-0.643833,
-0.838226,
--0.438618,
--0.945608,
-0.207114,
-0.996313,
-0.036804,
--0.987301,
--0.278523,
-0.919114,
-0.503541,
--0.795838,
--0.698378,
-0.624855,
-0.851352,
--0.416432,
--0.953306,
-0.183035,
-0.998118,
-0.061317,
--0.983105,
--0.302009,
-0.909165,
-0.524586,
--0.780738,
--0.715733,
-0.605506,
-0.863970,
--0.393994,
--0.960431,
-0.158853,
-0.999322,
-0.085794,
--0.978317,
--0.325314,
-0.898671,
-0.545321,
--0.765168,
--0.732656,
-0.585793,
-0.876067,
--0.371319,
--0.966977,
-0.134576,
-0.999925,
-0.110219,
--0.972940,
--0.348422,
-0.887636,
-0.565728,
--0.749137,
-0.740951,
--0.595699,
--0.857729,
-0.427555,
-0.941544,
--0.242980,
--0.989176,
-0.049068,
-0.998795,
-0.146731,
--0.970031,
--0.336890,
-0.903990,
-0.514103,
--0.803207,
--0.671559,
-0.671559,
-0.803207,
--0.514102,
--0.903990,
-0.336890,
-0.970031,
--0.146729,
--0.998796,
--0.049068,
-0.989176,
-0.242980,
--0.941544,
--0.427554,
-0.857729,
-0.595698,
--0.740952,
--0.740952,
-0.595698,
-0.857729,
--0.427555,
--0.941544,
-0.242980,
-0.989176,
--0.049069,
--0.998796,
--0.146729,
-0.970031,
-0.336891,
--0.903990,
--0.514103,
-0.803210,
-0.671559,
--0.671556,
--0.803207,
-0.514100,
-0.903989,
--0.336888,
--0.970031,
-0.146729,
-0.998795,
-0.049068,
--0.989177,
--0.242980,
-0.941543,
-0.427554,
--0.857727,
--0.595698,
-0.740950,
-0.740950,
--0.595698,
--0.857727,
-0.427555,
-0.941543,
--0.242980,
--0.989177,
-0.049069,
-0.998795,
-0.146729,
--0.970031,
--0.336888,
-0.903989,
-0.514100,
--0.803207,
--0.671562,
-0.671559,
-0.803209,
--0.514104,
--0.903990,
-0.336892,
-0.970032,
--0.146733,
--0.998795,
--0.049064,
-0.989178,
-0.242984,
--0.941544,
--0.427551,
-0.857725,
-0.595701,
--0.740953,
--0.740947,
-0.595695,
-0.857729,
--0.427558,
--0.941547,
-0.242977,
-0.989176,
--0.049073,
--0.998795,
--0.146732,
-0.970032,
-0.336884,
--0.903987,
--0.514103,
-0.803210,
-0.671564,
--0.671557,
--0.803207,
-0.514107,
-0.903992,
--0.336888,
--0.970031,
-0.146737,
-0.998796,
-0.049068,
--0.989177,
--0.242987,
-0.941543,
-0.427554,
--0.857731,
--0.595704,
-0.740950,
-0.732654,
--0.624859,
--0.824589,
-0.503538,
-0.898674,
--0.371318,
--0.953306,
-0.231058,
-0.987301,
--0.085798,
--0.999925,
--0.061322,
-0.990903,
-0.207111,
--0.960431,
--0.348420,
-0.909168,
-0.482184,
--0.838225,
--0.605510,
-0.749136,
-0.715731,
--0.643832,
--0.810457,
-0.524591,
-0.887639,
--0.393994,
--0.945608,
-0.254865,
-0.983106,
--0.110222,
--0.999322,
--0.036807,
-0.993907,
-0.183038,
--0.966976,
--0.325312,
-0.919113,
-0.460539,
--0.851355,
--0.585798,
-0.765168,
-0.698375,
--0.662414,
--0.795836,
-0.545324,
-0.876069,
--0.416429,
--0.937338,
-0.278520,
-0.978318,
--0.134582,
--0.998118,
--0.012269,
-0.996312,
-0.158855,
--0.972940,
--0.302002,
-0.928506,
-0.438619,
--0.863973,
--0.565734,
-0.780739,
-0.680602,
--0.680603,
--0.780737,
-0.565729,
-0.863973,
--0.438614,
--0.928506,
-0.302004,
-0.972939,
--0.158857,
--0.996312,
-0.012271,
-0.998118,
-0.134580,
--0.978317,
--0.278518,
-0.937338,
-0.416427,
--0.876070,
--0.545322,
-0.795837,
-0.662419,
--0.698377,
--0.765169,
-0.585793,
-0.851352,
--0.460541,
--0.919114,
-0.325306,
-0.966975,
--0.183044,
--0.993907,
-0.036805,
-0.999322,
-0.110216,
--0.983106,
--0.254867,
-0.945606,
-0.393985,
--0.887642,
--0.524589,
-0.810456,
-0.643836,
--0.715735,
--0.749135,
-0.605510,
-0.838227,
--0.482190,
--0.909166,
-0.348419,
-0.960431,
--0.207106,
--0.990902,
-0.061323,
-0.999925,
-0.085802,
--0.987300,
--0.231054,
-0.953306,
-0.371320,
--0.898672,
--0.503533,
-0.824591,
-0.624860,
--0.732651,
-0.724247,
--0.653173,
--0.788346,
-0.575808,
-0.844854,
--0.492898,
--0.893224,
-0.405241,
-0.932993,
--0.313682,
--0.963776,
-0.219101,
-0.985278,
--0.122410,
--0.997290,
-0.024541,
-0.999699,
-0.073565,
--0.992480,
--0.170962,
-0.975702,
-0.266712,
--0.949529,
--0.359897,
-0.914209,
-0.449612,
--0.870087,
--0.534997,
-0.817585,
-0.615230,
--0.757208,
--0.689542,
-0.689540,
-0.757209,
--0.615232,
--0.817584,
-0.534999,
-0.870086,
--0.449610,
--0.914210,
-0.359894,
-0.949528,
--0.266713,
--0.975703,
-0.170963,
-0.992480,
--0.073567,
--0.999699,
--0.024538,
-0.997290,
-0.122414,
--0.985278,
--0.219104,
-0.963777,
-0.313683,
--0.932994,
--0.405242,
-0.893223,
-0.492898,
--0.844852,
--0.575807,
-0.788345,
-0.653171,
--0.724247,
--0.724245,
-0.653173,
-0.788348,
--0.575809,
--0.844855,
-0.492900,
-0.893225,
--0.405244,
--0.932993,
-0.313679,
-0.963776,
--0.219099,
--0.985277,
-0.122409,
-0.997290,
--0.024541,
--0.999699,
--0.073564,
-0.992479,
-0.170960,
--0.975703,
--0.266717,
-0.949528,
-0.359892,
--0.914207,
--0.449614,
-0.870088,
-0.534993,
--0.817582,
--0.615232,
-0.757211,
-0.689546,
--0.689538,
--0.757208,
-0.615236,
-0.817588,
--0.534997,
--0.870085,
-0.449618,
-0.914211,
--0.359896,
--0.949527,
-0.266707,
-0.975702,
--0.170965,
--0.992479,
-0.073561,
-0.999699,
-0.024536,
--0.997290,
--0.122412,
-0.985278,
-0.219095,
--0.963775,
--0.313682,
-0.932994,
-0.405247,
--0.893223,
--0.492896,
-0.844857,
-0.575812,
--0.788346,
--0.653170,
-0.724242,
-0.715731,
--0.680601,
--0.749136,
-0.643832,
-0.780737,
--0.605511,
--0.810457,
-0.565732,
-0.838225,
--0.524589,
--0.863973,
-0.482185,
-0.887640,
--0.438616,
--0.909168,
-0.393991,
-0.928506,
--0.348419,
--0.945608,
-0.302006,
-0.960430,
--0.254865,
--0.972940,
-0.207111,
-0.983105,
--0.158859,
--0.990902,
-0.110221,
-0.996313,
--0.061320,
--0.999322,
-0.012272,
-0.999925,
-0.036809,
--0.998118,
--0.085798,
-0.993907,
-0.134580,
--0.987302,
--0.183038,
-0.978317,
-0.231056,
--0.966976,
--0.278523,
-0.953306,
-0.325313,
--0.937340,
--0.371319,
-0.919115,
-0.416430,
--0.898673,
--0.460538,
-0.876069,
-0.503537,
--0.851354,
--0.545322,
-0.824589,
-0.585801,
--0.795837,
--0.624861,
-0.765169,
-0.662417,
--0.732656,
--0.698376,
-0.698374,
-0.732654,
--0.662414,
--0.765166,
-0.624859,
-0.795835,
--0.585798,
--0.824591,
-0.545326,
-0.851356,
--0.503540,
--0.876070,
-0.460542,
-0.898674,
--0.416427,
--0.919113,
-0.371316,
-0.937338,
--0.325310,
--0.953307,
-0.278513,
-0.966975,
--0.231060,
--0.978318,
-0.183035,
-0.987300,
--0.134585,
--0.993907,
-0.085795,
-0.998118,
--0.036813,
--0.999925,
--0.012272,
-0.999322,
-0.061328,
--0.996313,
--0.110220,
-0.990902,
-0.158863,
--0.983107,
--0.207107,
-0.972940,
-0.254868,
--0.960429,
--0.302000,
-0.945608,
-0.348419,
--0.928505,
--0.393998,
-0.909170,
-0.438614,
--0.887639,
--0.482187,
-0.863969,
-0.524586,
--0.838225,
--0.565733,
-0.810454,
-0.605506,
--0.780740,
--0.643831,
-0.749135,
-0.680605,
--0.715735,
-0.707107,
--0.707107,
--0.707107,
-0.707107,
-0.707107,
--0.707107,
--0.707107,
-0.707107,
-0.707107,
--0.707107,
--0.707107,
-0.707107,
-0.707107,
--0.707106,
--0.707107,
-0.707107,
-0.707107,
--0.707107,
--0.707107,
-0.707106,
-0.707107,
--0.707107,
--0.707106,
-0.707108,
-0.707108,
--0.707106,
--0.707107,
-0.707107,
-0.707106,
--0.707108,
--0.707108,
-0.707106,
-0.707107,
--0.707107,
--0.707106,
-0.707108,
-0.707108,
--0.707106,
--0.707107,
-0.707107,
-0.707106,
--0.707108,
--0.707108,
-0.707109,
-0.707107,
--0.707104,
--0.707106,
-0.707105,
-0.707105,
--0.707106,
--0.707104,
-0.707107,
-0.707109,
--0.707108,
--0.707108,
-0.707109,
-0.707107,
--0.707104,
--0.707106,
-0.707105,
-0.707105,
--0.707106,
--0.707104,
-0.707107,
-0.707109,
--0.707108,
--0.707108,
-0.707109,
-0.707107,
--0.707105,
--0.707106,
-0.707105,
-0.707105,
--0.707106,
--0.707104,
-0.707107,
-0.707109,
--0.707108,
--0.707108,
-0.707109,
-0.707107,
--0.707105,
--0.707106,
-0.707111,
-0.707110,
--0.707106,
--0.707104,
-0.707102,
-0.707109,
--0.707108,
--0.707102,
-0.707104,
-0.707107,
--0.707110,
--0.707111,
-0.707105,
-0.707105,
--0.707112,
--0.707109,
-0.707107,
-0.707103,
--0.707103,
--0.707108,
-0.707109,
-0.707112,
--0.707105,
--0.707106,
-0.707111,
-0.707110,
--0.707106,
--0.707104,
-0.707102,
-0.707108,
--0.707108,
--0.707102,
-0.707104,
-0.707107,
--0.707110,
--0.707111,
-0.707106,
-0.707105,
--0.707112,
--0.707109,
-0.707107,
-0.707103,
--0.707103,
--0.707108,
-0.707109,
-0.698376,
--0.732654,
--0.662416,
-0.765167,
-0.624860,
--0.795837,
--0.585798,
-0.824589,
-0.545325,
--0.851355,
--0.503539,
-0.876070,
-0.460539,
--0.898674,
--0.416429,
-0.919114,
-0.371317,
--0.937339,
--0.325311,
-0.953306,
-0.278519,
--0.966977,
--0.231059,
-0.978317,
-0.183040,
--0.987302,
--0.134579,
-0.993907,
-0.085798,
--0.998118,
--0.036807,
-0.999925,
--0.012270,
--0.999322,
-0.061320,
-0.996313,
--0.110223,
--0.990902,
-0.158857,
-0.983106,
--0.207108,
--0.972940,
-0.254863,
-0.960430,
--0.302005,
--0.945606,
-0.348419,
-0.928507,
--0.393994,
--0.909168,
-0.438619,
-0.887639,
--0.482181,
--0.863972,
-0.524588,
-0.838223,
--0.565732,
--0.810459,
-0.605512,
-0.780738,
--0.643834,
--0.749137,
-0.680599,
-0.715730,
--0.715729,
--0.680599,
-0.749136,
-0.643834,
--0.780738,
--0.605513,
-0.810459,
-0.565732,
--0.838227,
--0.524589,
-0.863972,
-0.482182,
--0.887639,
--0.438613,
-0.909168,
-0.393995,
--0.928504,
--0.348413,
-0.945608,
-0.302006,
--0.960430,
--0.254872,
-0.972941,
-0.207108,
--0.983105,
--0.158861,
-0.990902,
-0.110216,
--0.996313,
--0.061321,
-0.999322,
-0.012278,
--0.999925,
-0.036810,
-0.998118,
--0.085794,
--0.993908,
-0.134586,
-0.987301,
--0.183039,
--0.978318,
-0.231051,
-0.966975,
--0.278521,
--0.953306,
-0.325306,
-0.937342,
--0.371322,
--0.919113,
-0.416428,
-0.898676,
--0.460545,
--0.876068,
-0.503540,
-0.851356,
--0.545321,
--0.824585,
-0.585801,
-0.795836,
--0.624858,
--0.765171,
-0.662421,
-0.732652,
--0.698377,
-0.689541,
--0.757209,
--0.615232,
-0.817585,
-0.534997,
--0.870087,
--0.449611,
-0.914210,
-0.359895,
--0.949528,
--0.266712,
-0.975702,
-0.170962,
--0.992479,
--0.073565,
-0.999699,
--0.024541,
--0.997290,
-0.122410,
-0.985278,
--0.219100,
--0.963776,
-0.313682,
-0.932992,
--0.405240,
--0.893225,
-0.492898,
-0.844853,
--0.575809,
--0.788348,
-0.653172,
-0.724247,
--0.724247,
--0.653172,
-0.788345,
-0.575809,
--0.844853,
--0.492898,
-0.893225,
-0.405243,
--0.932994,
--0.313682,
-0.963775,
-0.219100,
--0.985277,
--0.122408,
-0.997290,
-0.024544,
--0.999699,
-0.073563,
-0.992479,
--0.170962,
--0.975703,
-0.266714,
-0.949529,
--0.359898,
--0.914210,
-0.449609,
-0.870086,
--0.534996,
--0.817583,
-0.615232,
-0.757211,
--0.689542,
--0.689541,
-0.757211,
-0.615231,
--0.817583,
--0.534996,
-0.870086,
-0.449608,
--0.914210,
--0.359898,
-0.949529,
-0.266714,
--0.975703,
--0.170961,
-0.992479,
-0.073563,
--0.999699,
-0.024537,
-0.997290,
--0.122416,
--0.985279,
-0.219100,
-0.963775,
--0.313675,
--0.932994,
-0.405243,
-0.893221,
--0.492895,
--0.844853,
-0.575813,
-0.788350,
--0.653172,
--0.724244,
-0.724242,
-0.653175,
--0.788348,
--0.575803,
-0.844852,
-0.492897,
--0.893227,
--0.405246,
-0.932993,
-0.313678,
--0.963774,
--0.219103,
-0.985278,
-0.122404,
--0.997290,
--0.024540,
-0.999699,
--0.073560,
--0.992480,
-0.170966,
-0.975704,
--0.266711,
--0.949527,
-0.359902,
-0.914211,
--0.449612,
--0.870084,
-0.534993,
-0.817585,
--0.615235,
--0.757213,
-0.689539,
-0.680601,
--0.780737,
--0.565732,
-0.863973,
-0.438616,
--0.928506,
--0.302006,
-0.972940,
-0.158859,
--0.996313,
--0.012272,
-0.998118,
--0.134580,
--0.978317,
-0.278521,
-0.937339,
--0.416430,
--0.876070,
-0.545325,
-0.795837,
--0.662416,
--0.698375,
-0.765166,
-0.585799,
--0.851355,
--0.460538,
-0.919114,
-0.325312,
--0.966976,
--0.183040,
-0.993907,
-0.036809,
--0.999322,
-0.110222,
-0.983105,
--0.254867,
--0.945608,
-0.393991,
-0.887640,
--0.524587,
--0.810456,
-0.643831,
-0.715728,
--0.749137,
--0.605513,
-0.838226,
-0.482184,
--0.909166,
--0.348418,
-0.960430,
-0.207109,
--0.990903,
--0.061324,
-0.999925,
--0.085796,
--0.987301,
-0.231058,
-0.953307,
--0.371319,
--0.898675,
-0.503542,
-0.824589,
--0.624858,
--0.732653,
-0.732654,
-0.624862,
--0.824590,
--0.503540,
-0.898676,
-0.371317,
--0.953305,
--0.231057,
-0.987301,
-0.085794,
--0.999925,
-0.061318,
-0.990902,
--0.207110,
--0.960429,
-0.348419,
-0.909169,
--0.482179,
--0.838221,
-0.605514,
-0.749136,
--0.715730,
--0.643835,
-0.810462,
-0.524586,
--0.887640,
--0.393993,
-0.945606,
-0.254873,
--0.983106,
--0.110220,
-0.999322,
--0.036803,
--0.993908,
-0.183045,
-0.966976,
--0.325310,
--0.919115,
-0.460533,
-0.851352,
--0.585800,
--0.765167,
-0.698374,
-0.662420,
--0.795841,
--0.545322,
-0.876070,
-0.416432,
--0.937337,
--0.278513,
-0.978318,
-0.134580,
--0.998118,
-0.012266,
-0.996312,
--0.158862,
--0.972940,
-0.302004,
-0.928508,
--0.438623,
--0.863971,
-0.565733,
-0.780738,
--0.680598,
-0.671559,
--0.803207,
--0.514103,
-0.903989,
-0.336890,
--0.970031,
--0.146730,
-0.998795,
--0.049068,
--0.989176,
-0.242980,
-0.941544,
--0.427555,
--0.857728,
-0.595699,
-0.740951,
--0.740951,
--0.595699,
-0.857729,
-0.427554,
--0.941545,
--0.242981,
-0.989176,
-0.049067,
--0.998795,
-0.146729,
-0.970031,
--0.336890,
--0.903989,
-0.514101,
-0.803208,
--0.671559,
--0.671558,
-0.803207,
-0.514103,
--0.903989,
--0.336889,
-0.970031,
-0.146731,
--0.998795,
-0.049069,
-0.989177,
--0.242983,
--0.941544,
-0.427552,
-0.857728,
--0.595698,
--0.740949,
-0.740952,
-0.595701,
--0.857730,
--0.427555,
-0.941543,
-0.242979,
--0.989176,
--0.049064,
-0.998795,
--0.146728,
--0.970031,
-0.336889,
-0.903991,
--0.514104,
--0.803209,
-0.671561,
-0.671559,
--0.803206,
--0.514101,
-0.903989,
-0.336886,
--0.970031,
--0.146732,
-0.998796,
--0.049067,
--0.989177,
-0.242982,
-0.941544,
--0.427558,
--0.857728,
-0.595704,
-0.740955,
--0.740951,
--0.595696,
-0.857725,
-0.427556,
--0.941545,
--0.242987,
-0.989176,
-0.049066,
--0.998795,
-0.146727,
-0.970031,
--0.336895,
--0.903991,
-0.514103,
-0.803205,
--0.671555,
--0.671560,
-0.803210,
-0.514109,
--0.903988,
--0.336887,
-0.970033,
-0.146734,
--0.998796,
-0.049074,
-0.989177,
--0.242981,
--0.941542,
-0.427550,
-0.857729,
--0.595703,
--0.740955,
-0.740950,
-0.595697,
--0.857725,
--0.427558,
-0.941545,
-0.242974,
--0.989176,
--0.049067,
-0.998795,
--0.146726,
--0.970031,
-0.336894,
-0.903992,
--0.514102,
--0.803205,
-0.671554,
-0.662416,
--0.824589,
--0.460539,
-0.937339,
-0.231058,
--0.993907,
-0.012271,
-0.990903,
--0.254865,
--0.928506,
-0.482185,
-0.810457,
--0.680602,
--0.643832,
-0.838224,
-0.438616,
--0.945607,
--0.207111,
-0.996313,
--0.036806,
--0.987302,
-0.278520,
-0.919113,
--0.503537,
--0.795837,
-0.698377,
-0.624858,
--0.851354,
--0.416430,
-0.953306,
-0.183038,
--0.998118,
-0.061320,
-0.983105,
--0.302008,
--0.909168,
-0.524590,
-0.780737,
--0.715729,
--0.605509,
-0.863973,
-0.393995,
--0.960431,
--0.158859,
-0.999322,
--0.085798,
--0.978318,
-0.325313,
-0.898674,
--0.545323,
--0.765166,
-0.732654,
-0.585801,
--0.876071,
--0.371319,
-0.966977,
-0.134580,
--0.999925,
-0.110225,
-0.972940,
--0.348416,
--0.887639,
-0.565731,
-0.749134,
--0.749137,
--0.565734,
-0.887641,
-0.348419,
--0.972939,
--0.110220,
-0.999925,
--0.134577,
--0.966976,
-0.371316,
-0.876069,
--0.585798,
--0.732656,
-0.765164,
-0.545319,
--0.898676,
--0.325309,
-0.978317,
-0.085802,
--0.999323,
-0.158863,
-0.960430,
--0.393992,
--0.863974,
-0.605506,
-0.715726,
--0.780739,
--0.524589,
-0.909167,
-0.302011,
--0.983107,
--0.061316,
-0.998118,
--0.183039,
--0.953307,
-0.416424,
-0.851352,
--0.624862,
--0.698376,
-0.795835,
-0.503543,
--0.919117,
--0.278516,
-0.987302,
-0.036809,
--0.996313,
-0.207104,
-0.945606,
--0.438618,
--0.838225,
-0.643829,
-0.680605,
--0.810461,
--0.482181,
-0.928506,
-0.254868,
--0.990902,
--0.012264,
-0.993906,
--0.231060,
--0.937339,
-0.460535,
-0.824593,
--0.662420,
-0.653173,
--0.844854,
--0.405242,
-0.963776,
-0.122411,
--0.999699,
-0.170962,
-0.949528,
--0.449612,
--0.817585,
-0.689540,
-0.615231,
--0.870087,
--0.359894,
-0.975702,
-0.073565,
--0.997290,
-0.219101,
-0.932993,
--0.492898,
--0.788346,
-0.724248,
-0.575809,
--0.893224,
--0.313681,
-0.985277,
-0.024542,
--0.992479,
-0.266714,
-0.914210,
--0.534997,
--0.757208,
-0.757208,
-0.534998,
--0.914210,
--0.266712,
-0.992479,
--0.024541,
--0.985278,
-0.313683,
-0.893225,
--0.575805,
--0.724246,
-0.788345,
-0.492895,
--0.932993,
--0.219104,
-0.997291,
--0.073564,
--0.975703,
-0.359897,
-0.870087,
--0.615229,
--0.689540,
-0.817584,
-0.449608,
--0.949528,
--0.170964,
-0.999699,
--0.122411,
--0.963777,
-0.405243,
-0.844854,
--0.653170,
--0.653172,
-0.844853,
-0.405238,
--0.963776,
--0.122413,
-0.999699,
--0.170962,
--0.949529,
-0.449613,
-0.817585,
--0.689538,
--0.615236,
-0.870086,
-0.359892,
--0.975701,
--0.073566,
-0.997290,
--0.219094,
--0.932994,
-0.492900,
-0.788342,
--0.724245,
--0.575807,
-0.893227,
-0.313685,
--0.985278,
--0.024535,
-0.992480,
--0.266713,
--0.914208,
-0.534993,
-0.757209,
--0.757212,
--0.535002,
-0.914209,
-0.266709,
--0.992479,
-0.024540,
-0.985277,
--0.313675,
--0.893225,
-0.575811,
-0.724252,
--0.788345,
--0.492896,
-0.932995,
-0.219104,
--0.997291,
-0.073571,
-0.975703,
--0.359896,
--0.870084,
-0.615228,
-0.689540,
--0.817588,
--0.449616,
-0.949528,
-0.170957,
--0.999699,
-0.122410,
-0.963775,
--0.405235,
--0.844854,
-0.653175,
-0.643832,
--0.863973,
--0.348419,
-0.983106,
-0.012272,
--0.987301,
-0.325310,
-0.876070,
--0.624860,
--0.662416,
-0.851355,
-0.371318,
--0.978318,
--0.036807,
-0.990903,
--0.302006,
--0.887640,
-0.605512,
-0.680601,
--0.838225,
--0.393994,
-0.972940,
-0.061320,
--0.993907,
-0.278519,
-0.898674,
--0.585799,
--0.698377,
-0.824589,
-0.416429,
--0.966976,
--0.085798,
-0.996313,
--0.254867,
--0.909168,
-0.565732,
-0.715730,
--0.810456,
--0.438613,
-0.960431,
-0.110224,
--0.998118,
-0.231058,
-0.919115,
--0.545327,
--0.732654,
-0.795835,
-0.460537,
--0.953306,
--0.134584,
-0.999322,
--0.207110,
--0.928507,
-0.524591,
-0.749137,
--0.780739,
--0.482183,
-0.945607,
-0.158855,
--0.999925,
-0.183038,
-0.937338,
--0.503538,
--0.765169,
-0.765169,
-0.503539,
--0.937338,
--0.183038,
-0.999925,
--0.158854,
--0.945607,
-0.482183,
-0.780735,
--0.749132,
--0.524585,
-0.928507,
-0.207111,
--0.999322,
-0.134576,
-0.953304,
--0.460543,
--0.795836,
-0.732654,
-0.545328,
--0.919112,
--0.231052,
-0.998118,
--0.110224,
--0.960431,
-0.438613,
-0.810461,
--0.715735,
--0.565729,
-0.909168,
-0.254868,
--0.996312,
-0.085790,
-0.966975,
--0.416432,
--0.824590,
-0.698374,
-0.585803,
--0.898677,
--0.278516,
-0.993907,
--0.061319,
--0.972941,
-0.393986,
-0.838221,
--0.680603,
--0.605511,
-0.887639,
-0.302011,
--0.990902,
-0.036812,
-0.978317,
--0.371317,
--0.851357,
-0.662412,
-0.624854,
--0.876072,
--0.325309,
-0.987301,
--0.012268,
--0.983107,
-0.348424,
-0.863971,
--0.643832,
-0.634393,
--0.881921,
--0.290285,
-0.995185,
--0.098017,
--0.956940,
-0.471397,
-0.773010,
--0.773010,
--0.471397,
-0.956940,
-0.098017,
--0.995185,
-0.290286,
-0.881921,
--0.634393,
--0.634393,
-0.881921,
-0.290284,
--0.995185,
-0.098017,
-0.956940,
--0.471395,
--0.773011,
-0.773011,
-0.471395,
--0.956940,
--0.098017,
-0.995185,
--0.290284,
--0.881921,
-0.634394,
-0.634394,
--0.881921,
--0.290284,
-0.995185,
--0.098017,
--0.956941,
-0.471399,
-0.773011,
--0.773009,
--0.471395,
-0.956940,
-0.098020,
--0.995185,
-0.290284,
-0.881923,
--0.634394,
--0.634394,
-0.881920,
-0.290283,
--0.995185,
-0.098021,
-0.956940,
--0.471395,
--0.773008,
-0.773011,
-0.471398,
--0.956941,
--0.098017,
-0.995185,
--0.290288,
--0.881921,
-0.634392,
-0.634391,
--0.881921,
--0.290287,
-0.995185,
--0.098017,
--0.956941,
-0.471399,
-0.773011,
--0.773009,
--0.471395,
-0.956942,
-0.098020,
--0.995185,
-0.290291,
-0.881923,
--0.634395,
--0.634388,
-0.881920,
-0.290283,
--0.995185,
-0.098013,
-0.956940,
--0.471402,
--0.773013,
-0.773011,
-0.471391,
--0.956939,
--0.098016,
-0.995184,
--0.290280,
--0.881921,
-0.634398,
-0.634397,
--0.881921,
--0.290280,
-0.995184,
--0.098017,
--0.956939,
-0.471392,
-0.773011,
--0.773014,
--0.471401,
-0.956940,
-0.098013,
--0.995185,
-0.290284,
-0.881919,
--0.634389,
--0.634394,
-0.881923,
-0.290290,
--0.995185,
-0.098021,
-0.956942,
--0.471396,
--0.773008,
-0.773006,
-0.471398,
--0.956941,
--0.098024,
-0.995185,
--0.290288,
--0.881925,
-0.634392,
-0.624860,
--0.898674,
--0.231058,
-0.999925,
--0.207111,
--0.909168,
-0.605511,
-0.643832,
--0.887640,
--0.254865,
-0.999322,
--0.183039,
--0.919114,
-0.585798,
-0.662416,
--0.876070,
--0.278520,
-0.998118,
--0.158857,
--0.928506,
-0.565733,
-0.680602,
--0.863973,
--0.302005,
-0.996312,
--0.134581,
--0.937339,
-0.545324,
-0.698376,
--0.851356,
--0.325312,
-0.993907,
--0.110223,
--0.945608,
-0.524590,
-0.715730,
--0.838224,
--0.348415,
-0.990903,
--0.085796,
--0.953305,
-0.503539,
-0.732655,
--0.824591,
--0.371316,
-0.987301,
--0.061324,
--0.960430,
-0.482182,
-0.749134,
--0.810458,
--0.393993,
-0.983106,
--0.036808,
--0.966977,
-0.460542,
-0.765167,
--0.795836,
--0.416426,
-0.978318,
--0.012270,
--0.972939,
-0.438617,
-0.780738,
--0.780739,
--0.438615,
-0.972940,
-0.012268,
--0.978317,
-0.416428,
-0.795835,
--0.765168,
--0.460540,
-0.966975,
-0.036814,
--0.983104,
-0.393995,
-0.810457,
--0.749135,
--0.482187,
-0.960429,
-0.061315,
--0.987301,
-0.371318,
-0.824590,
--0.732651,
--0.503544,
-0.953308,
-0.085794,
--0.990903,
-0.348417,
-0.838227,
--0.715726,
--0.524585,
-0.945608,
-0.110221,
--0.993907,
-0.325306,
-0.851359,
--0.698380,
--0.545322,
-0.937339,
-0.134583,
--0.996313,
-0.301999,
-0.863970,
--0.680603,
--0.565731,
-0.928505,
-0.158862,
--0.998119,
-0.278525,
-0.876069,
--0.662416,
--0.585799,
-0.919112,
-0.183047,
--0.999322,
-0.254869,
-0.887639,
--0.643830,
--0.605515,
-0.909165,
-0.207106,
--0.999925,
-0.231059,
-0.898675,
--0.624856,
-0.615232,
--0.914210,
--0.170962,
-0.997290,
--0.313682,
--0.844854,
-0.724247,
-0.492899,
--0.963776,
--0.024542,
-0.975702,
--0.449611,
--0.757209,
-0.817585,
-0.359895,
--0.992480,
-0.122410,
-0.932993,
--0.575808,
--0.653172,
-0.893224,
-0.219101,
--0.999699,
-0.266712,
-0.870087,
--0.689542,
--0.534998,
-0.949528,
-0.073563,
--0.985278,
-0.405242,
-0.788348,
--0.788346,
--0.405241,
-0.985277,
--0.073564,
--0.949529,
-0.535000,
-0.689541,
--0.870086,
--0.266710,
-0.999699,
--0.219099,
--0.893223,
-0.653173,
-0.575810,
--0.932994,
--0.122410,
-0.992480,
--0.359898,
--0.817584,
-0.757208,
-0.449608,
--0.975702,
-0.024540,
-0.963775,
--0.492899,
--0.724248,
-0.844856,
-0.313681,
--0.997290,
-0.170958,
-0.914209,
--0.615231,
--0.615234,
-0.914210,
-0.170963,
--0.997291,
-0.313684,
-0.844854,
--0.724250,
--0.492903,
-0.963776,
-0.024537,
--0.975703,
-0.449611,
-0.757206,
--0.817582,
--0.359895,
-0.992480,
--0.122406,
--0.932993,
-0.575813,
-0.653176,
--0.893224,
--0.219096,
-0.999699,
--0.266713,
--0.870084,
-0.689537,
-0.534997,
--0.949530,
--0.073569,
-0.985277,
--0.405247,
--0.788349,
-0.788347,
-0.405236,
--0.985277,
-0.073566,
-0.949526,
--0.534995,
--0.689539,
-0.870090,
-0.266716,
--0.999699,
-0.219108,
-0.893226,
--0.653174,
--0.575802,
-0.932992,
-0.122409,
--0.992479,
-0.359892,
-0.817584,
--0.757214,
--0.449614,
-0.975703,
--0.024549,
--0.963777,
-0.492900,
-0.724252,
--0.844852,
--0.313679,
-0.997290,
--0.170960,
--0.914209,
-0.615226,
-0.605511,
--0.928506,
--0.110222,
-0.987301,
--0.416429,
--0.765167,
-0.824589,
-0.325310,
--0.998118,
-0.207111,
-0.887640,
--0.680602,
--0.524589,
-0.960430,
-0.012272,
--0.966976,
-0.503539,
-0.698376,
--0.876071,
--0.231059,
-0.999322,
--0.302007,
--0.838225,
-0.749137,
-0.438618,
--0.983105,
-0.085798,
-0.937340,
--0.585798,
--0.624858,
-0.919113,
-0.134580,
--0.990902,
-0.393991,
-0.780737,
--0.810456,
--0.348415,
-0.996313,
--0.183039,
--0.898676,
-0.662417,
-0.545326,
--0.953305,
--0.036805,
-0.972940,
--0.482181,
--0.715729,
-0.863973,
-0.254868,
--0.999925,
-0.278520,
-0.851356,
--0.732656,
--0.460538,
-0.978317,
--0.061324,
--0.945607,
-0.565731,
-0.643834,
--0.909169,
--0.158859,
-0.993907,
--0.371319,
--0.795837,
-0.795835,
-0.371315,
--0.993907,
-0.158856,
-0.909167,
--0.643832,
--0.565727,
-0.945608,
-0.061320,
--0.978318,
-0.460535,
-0.732659,
--0.851359,
--0.278516,
-0.999925,
--0.254865,
--0.863974,
-0.715727,
-0.482177,
--0.972941,
-0.036810,
-0.953306,
--0.545323,
--0.662419,
-0.898671,
-0.183034,
--0.996312,
-0.348419,
-0.810458,
--0.780735,
--0.393998,
-0.990903,
--0.134585,
--0.919113,
-0.624859,
-0.585800,
--0.937337,
--0.085790,
-0.983105,
--0.438618,
--0.749136,
-0.838223,
-0.302011,
--0.999322,
-0.231064,
-0.876069,
--0.698377,
--0.503540,
-0.966975,
--0.012265,
--0.960429,
-0.524593,
-0.680600,
--0.887639,
--0.207115,
-0.998118,
--0.325317,
--0.824587,
-0.765169,
-0.416430,
--0.987301,
-0.110217,
-0.928509,
--0.605516,
-0.595699,
--0.941544,
--0.049068,
-0.970031,
--0.514103,
--0.671559,
-0.903989,
-0.146731,
--0.989176,
-0.427556,
-0.740951,
--0.857729,
--0.242981,
-0.998795,
--0.336890,
--0.803208,
-0.803207,
-0.336889,
--0.998795,
-0.242980,
-0.857728,
--0.740951,
--0.427554,
-0.989176,
--0.146730,
--0.903989,
-0.671558,
-0.514102,
--0.970031,
-0.049067,
-0.941544,
--0.595698,
--0.595699,
-0.941545,
-0.049068,
--0.970032,
-0.514105,
-0.671559,
--0.903988,
--0.146728,
-0.989176,
--0.427554,
--0.740949,
-0.857729,
-0.242981,
--0.998796,
-0.336892,
-0.803208,
--0.803206,
--0.336888,
-0.998795,
--0.242978,
--0.857727,
-0.740952,
-0.427557,
--0.989177,
-0.146732,
-0.903990,
--0.671556,
--0.514101,
-0.970031,
--0.049065,
--0.941543,
-0.595699,
-0.595701,
--0.941545,
--0.049067,
-0.970032,
--0.514106,
--0.671558,
-0.903992,
-0.146734,
--0.989176,
-0.427562,
-0.740953,
--0.857730,
--0.242987,
-0.998796,
--0.336893,
--0.803212,
-0.803207,
-0.336886,
--0.998795,
-0.242979,
-0.857726,
--0.740947,
--0.427555,
-0.989177,
--0.146726,
--0.903989,
-0.671563,
-0.514106,
--0.970031,
-0.049074,
-0.941545,
--0.595701,
--0.595694,
-0.941543,
-0.049065,
--0.970029,
-0.514101,
-0.671557,
--0.903986,
--0.146732,
-0.989176,
--0.427549,
--0.740952,
-0.857731,
-0.242986,
--0.998795,
-0.336894,
-0.803211,
--0.803208,
--0.336885,
-0.998795,
--0.242981,
--0.857726,
-0.740948,
-0.427554,
--0.989177,
-0.146727,
-0.903989,
--0.671564,
--0.514105,
-0.970032,
--0.049060,
--0.941545,
-0.595702,
-0.585798,
--0.953306,
-0.012272,
-0.945607,
--0.605511,
--0.565732,
-0.960430,
--0.036807,
--0.937339,
-0.624859,
-0.545326,
--0.966977,
-0.061321,
-0.928506,
--0.643831,
--0.524590,
-0.972940,
--0.085796,
--0.919114,
-0.662417,
-0.503539,
--0.978318,
-0.110221,
-0.909168,
--0.680602,
--0.482184,
-0.983106,
--0.134579,
--0.898674,
-0.698377,
-0.460539,
--0.987302,
-0.158857,
-0.887640,
--0.715729,
--0.438613,
-0.990903,
--0.183039,
--0.876072,
-0.732656,
-0.416430,
--0.993907,
-0.207114,
-0.863973,
--0.749135,
--0.393989,
-0.996313,
--0.231057,
--0.851357,
-0.765169,
-0.371317,
--0.998118,
-0.254868,
-0.838224,
--0.780736,
--0.348415,
-0.999322,
--0.278519,
--0.824591,
-0.795838,
-0.325310,
--0.999925,
-0.302009,
-0.810457,
--0.810456,
--0.302010,
-0.999925,
--0.325310,
--0.795839,
-0.824586,
-0.278527,
--0.999322,
-0.348422,
-0.780737,
--0.838224,
--0.254869,
-0.998118,
--0.371324,
--0.765164,
-0.851357,
-0.231058,
--0.996313,
-0.393988,
-0.749141,
--0.863976,
--0.207107,
-0.993907,
--0.416429,
--0.732656,
-0.876068,
-0.183047,
--0.990902,
-0.438620,
-0.715730,
--0.887639,
--0.158861,
-0.987302,
--0.460545,
--0.698372,
-0.898676,
-0.134580,
--0.983106,
-0.482180,
-0.680605,
--0.909171,
--0.110218,
-0.978317,
--0.503538,
--0.662417,
-0.919112,
-0.085804,
--0.972939,
-0.524593,
-0.643830,
--0.928506,
--0.061324,
-0.966978,
--0.545319,
--0.624855,
-0.937340,
-0.036806,
--0.960431,
-0.565729,
-0.605516,
--0.945610,
--0.012267,
-0.953305,
--0.585798,
-0.575808,
--0.963776,
-0.073565,
-0.914210,
--0.689540,
--0.449611,
-0.992480,
--0.219101,
--0.844853,
-0.788346,
-0.313682,
--0.999699,
-0.359894,
-0.757208,
--0.870087,
--0.170962,
-0.985278,
--0.492898,
--0.653172,
-0.932992,
-0.024541,
--0.949529,
-0.615232,
-0.534996,
--0.975702,
-0.122412,
-0.893225,
--0.724247,
--0.405243,
-0.997290,
--0.266714,
--0.817585,
-0.817585,
-0.266714,
--0.997291,
-0.405243,
-0.724247,
--0.893223,
--0.122408,
-0.975702,
--0.534996,
--0.615234,
-0.949529,
--0.024541,
--0.932994,
-0.653175,
-0.492898,
--0.985277,
-0.170958,
-0.870086,
--0.757209,
--0.359898,
-0.999699,
--0.313682,
--0.788347,
-0.844856,
-0.219100,
--0.992480,
-0.449609,
-0.689539,
--0.914210,
--0.073566,
-0.963775,
--0.575809,
--0.575809,
-0.963775,
--0.073567,
--0.914213,
-0.689539,
-0.449608,
--0.992479,
-0.219100,
-0.844851,
--0.788343,
--0.313682,
-0.999699,
--0.359891,
--0.757208,
-0.870090,
-0.170965,
--0.985277,
-0.492905,
-0.653175,
--0.932994,
--0.024548,
-0.949529,
--0.615235,
--0.535002,
-0.975702,
--0.122416,
--0.893226,
-0.724248,
-0.405236,
--0.997290,
-0.266715,
-0.817581,
--0.817583,
--0.266710,
-0.997291,
--0.405240,
--0.724244,
-0.893222,
-0.122411,
--0.975701,
-0.534993,
-0.615231,
--0.949530,
-0.024537,
-0.932992,
--0.653178,
--0.492901,
-0.985278,
--0.170955,
--0.870088,
-0.757211,
-0.359901,
--0.999699,
-0.313686,
-0.788350,
--0.844854,
--0.219096,
-0.992480,
--0.449612,
--0.689536,
-0.914208,
-0.073562,
--0.963778,
-0.575806,
-0.565732,
--0.972940,
-0.134581,
-0.876070,
--0.765167,
--0.325311,
-0.999322,
--0.393992,
--0.715731,
-0.909168,
-0.061320,
--0.953306,
-0.624860,
-0.503539,
--0.987301,
-0.207111,
-0.838225,
--0.810458,
--0.254867,
-0.993907,
--0.460537,
--0.662416,
-0.937340,
--0.012271,
--0.928506,
-0.680600,
-0.438616,
--0.996312,
-0.278520,
-0.795838,
--0.851355,
--0.183038,
-0.983106,
--0.524587,
--0.605509,
-0.960431,
--0.085796,
--0.898676,
-0.732656,
-0.371317,
--0.999925,
-0.348422,
-0.749136,
--0.887639,
--0.110225,
-0.966976,
--0.585798,
--0.545327,
-0.978318,
--0.158859,
--0.863973,
-0.780735,
-0.302004,
--0.998118,
-0.416428,
-0.698374,
--0.919115,
--0.036808,
-0.945608,
--0.643834,
--0.482183,
-0.990902,
--0.231055,
--0.824588,
-0.824589,
-0.231060,
--0.990902,
-0.482185,
-0.643832,
--0.945606,
-0.036802,
-0.919117,
--0.698380,
--0.416426,
-0.998118,
--0.302005,
--0.780739,
-0.863970,
-0.158865,
--0.978316,
-0.545328,
-0.585796,
--0.966976,
-0.110220,
-0.887642,
--0.749132,
--0.348413,
-0.999925,
--0.371319,
--0.732654,
-0.898674,
-0.085802,
--0.960432,
-0.605516,
-0.524586,
--0.983106,
-0.183040,
-0.851356,
--0.795835,
--0.278525,
-0.996312,
--0.438621,
--0.680599,
-0.928506,
-0.012273,
--0.937340,
-0.662412,
-0.460532,
--0.993908,
-0.254869,
-0.810457,
--0.838224,
--0.207115,
-0.987302,
--0.503532,
--0.624855,
-0.953307,
--0.061322,
--0.909168,
-0.715729,
-0.393997,
--0.999322,
-0.325316,
-0.765165,
--0.876071,
--0.134581,
-0.972941,
--0.565728,
-0.555570,
--0.980785,
-0.195090,
-0.831470,
--0.831470,
--0.195090,
-0.980785,
--0.555570,
--0.555571,
-0.980785,
--0.195090,
--0.831470,
-0.831470,
-0.195090,
--0.980785,
-0.555571,
-0.555570,
--0.980785,
-0.195090,
-0.831469,
--0.831469,
--0.195089,
-0.980785,
--0.555571,
--0.555571,
-0.980785,
--0.195089,
--0.831469,
-0.831469,
-0.195090,
--0.980786,
-0.555570,
-0.555569,
--0.980786,
-0.195092,
-0.831470,
--0.831468,
--0.195088,
-0.980785,
--0.555569,
--0.555573,
-0.980786,
--0.195090,
--0.831471,
-0.831472,
-0.195089,
--0.980785,
-0.555568,
-0.555568,
--0.980785,
-0.195089,
-0.831471,
--0.831471,
--0.195090,
-0.980786,
--0.555567,
--0.555569,
-0.980785,
--0.195088,
--0.831468,
-0.831470,
-0.195091,
--0.980786,
-0.555572,
-0.555570,
--0.980785,
-0.195094,
-0.831473,
--0.831470,
--0.195085,
-0.980786,
--0.555571,
--0.555564,
-0.980785,
--0.195093,
--0.831473,
-0.831469,
-0.195086,
--0.980786,
-0.555570,
-0.555565,
--0.980785,
-0.195092,
-0.831466,
--0.831468,
--0.195087,
-0.980787,
--0.555569,
--0.555566,
-0.980784,
--0.195091,
--0.831466,
-0.831468,
-0.195089,
--0.980784,
-0.555568,
-0.555568,
--0.980784,
-0.195089,
-0.831467,
--0.831467,
--0.195090,
-0.980784,
--0.555567,
--0.555569,
-0.980787,
--0.195088,
--0.831468,
-0.831466,
-0.195091,
--0.980784,
-0.555566,
-0.555570,
--0.980787,
-0.195087,
-0.831468,
--0.831465,
--0.195092,
-0.980785,
--0.555565,
--0.555571,
-0.980786,
--0.195086,
--0.831469,
-0.831473,
-0.195093,
--0.980785,
-0.555564,
-0.545325,
--0.987301,
-0.254865,
-0.780737,
--0.887639,
--0.061321,
-0.937339,
--0.698376,
--0.371317,
-0.999322,
--0.438616,
--0.643832,
-0.960430,
--0.134581,
--0.851355,
-0.824589,
-0.183038,
--0.972940,
-0.605512,
-0.482184,
--0.996313,
-0.325309,
-0.732654,
--0.919113,
-0.012272,
-0.909168,
--0.749137,
--0.302007,
-0.993907,
--0.503537,
--0.585798,
-0.978317,
--0.207108,
--0.810456,
-0.863973,
-0.110224,
--0.953305,
-0.662417,
-0.416430,
--0.999925,
-0.393995,
-0.680600,
--0.945607,
-0.085795,
-0.876069,
--0.795837,
--0.231059,
-0.983106,
--0.565734,
--0.524589,
-0.990902,
--0.278516,
--0.765166,
-0.898675,
-0.036809,
--0.928507,
-0.715732,
-0.348419,
--0.998118,
-0.460542,
-0.624858,
--0.966976,
-0.158856,
-0.838223,
--0.838221,
--0.158851,
-0.966975,
--0.624862,
--0.460538,
-0.998118,
--0.348416,
--0.715734,
-0.928503,
--0.036813,
--0.898673,
-0.765169,
-0.278519,
--0.990903,
-0.524586,
-0.565737,
--0.983107,
-0.231063,
-0.795835,
--0.876071,
--0.085798,
-0.945608,
--0.680598,
--0.393998,
-0.999925,
--0.416434,
--0.662414,
-0.953306,
--0.110221,
--0.863974,
-0.810454,
-0.207118,
--0.978316,
-0.585801,
-0.503537,
--0.993907,
-0.302004,
-0.749139,
--0.909166,
--0.012264,
-0.919112,
--0.732657,
--0.325309,
-0.996313,
--0.482182,
--0.605515,
-0.972938,
--0.183047,
--0.824587,
-0.851357,
-0.134580,
--0.960431,
-0.643829,
-0.438621,
--0.999322,
-0.371323,
-0.698373,
--0.937340,
-0.061321,
-0.887640,
--0.780735,
--0.254871,
-0.987300,
--0.545330,
-0.534998,
--0.992480,
-0.313682,
-0.724247,
--0.932993,
-0.073564,
-0.870087,
--0.817585,
--0.170961,
-0.963776,
--0.653173,
--0.405241,
-0.999699,
--0.449612,
--0.615231,
-0.975702,
--0.219100,
--0.788346,
-0.893224,
-0.024541,
--0.914210,
-0.757209,
-0.266714,
--0.985278,
-0.575807,
-0.492898,
--0.997290,
-0.359896,
-0.689542,
--0.949528,
-0.122409,
-0.844853,
--0.844855,
--0.122410,
-0.949529,
--0.689538,
--0.359893,
-0.997290,
--0.492897,
--0.575811,
-0.985278,
--0.266713,
--0.757210,
-0.914208,
--0.024543,
--0.893224,
-0.788345,
-0.219105,
--0.975702,
-0.615232,
-0.449613,
--0.999699,
-0.405243,
-0.653173,
--0.963776,
-0.170958,
-0.817584,
--0.870087,
--0.073566,
-0.932994,
--0.724248,
--0.313682,
-0.992480,
--0.534994,
--0.535002,
-0.992480,
--0.313687,
--0.724250,
-0.932993,
--0.073572,
--0.870088,
-0.817587,
-0.170968,
--0.963776,
-0.653177,
-0.405245,
--0.999699,
-0.449618,
-0.615233,
--0.975703,
-0.219095,
-0.788347,
--0.893227,
--0.024545,
-0.914209,
--0.757214,
--0.266715,
-0.985277,
--0.575803,
--0.492899,
-0.997291,
--0.359891,
--0.689539,
-0.949530,
--0.122408,
--0.844852,
-0.844850,
-0.122411,
--0.949527,
-0.689537,
-0.359894,
--0.997290,
-0.492896,
-0.575806,
--0.985277,
-0.266712,
-0.757206,
--0.914208,
-0.024542,
-0.893221,
--0.788345,
--0.219098,
-0.975704,
--0.615231,
--0.449607,
-0.999699,
--0.405242,
--0.653168,
-0.963775,
--0.170965,
--0.817589,
-0.870087,
-0.073560,
--0.932994,
-0.724248,
-0.313675,
--0.992480,
-0.535000,
-0.524590,
--0.996313,
-0.371317,
-0.662416,
--0.966977,
-0.207112,
-0.780737,
--0.909168,
-0.036807,
-0.876070,
--0.824589,
--0.134581,
-0.945607,
--0.715731,
--0.302006,
-0.987301,
--0.585798,
--0.460540,
-0.999925,
--0.438615,
--0.605511,
-0.983105,
--0.278520,
--0.732655,
-0.937339,
--0.110221,
--0.838224,
-0.863972,
-0.061320,
--0.919114,
-0.765168,
-0.231056,
--0.972940,
-0.643831,
-0.393995,
--0.998118,
-0.503539,
-0.545326,
--0.993907,
-0.348422,
-0.680600,
--0.960430,
-0.183037,
-0.795835,
--0.898675,
-0.012271,
-0.887641,
--0.810459,
--0.158856,
-0.953306,
--0.698375,
--0.325307,
-0.990902,
--0.565732,
--0.482185,
-0.999322,
--0.416432,
--0.624859,
-0.978317,
--0.254862,
--0.749135,
-0.928506,
--0.085796,
--0.851357,
-0.851353,
-0.085804,
--0.928504,
-0.749139,
-0.254863,
--0.978317,
-0.624859,
-0.416432,
--0.999323,
-0.482178,
-0.565726,
--0.990903,
-0.325313,
-0.698375,
--0.953306,
-0.158856,
-0.810460,
--0.887637,
--0.012264,
-0.898672,
--0.795839,
--0.183038,
-0.960431,
--0.680600,
--0.348422,
-0.993908,
--0.545319,
--0.503533,
-0.998118,
--0.393994,
--0.643831,
-0.972940,
--0.231055,
--0.765171,
-0.919111,
--0.061327,
--0.863971,
-0.838226,
-0.110221,
--0.937339,
-0.732652,
-0.278524,
--0.983107,
-0.605516,
-0.438612,
--0.999925,
-0.460540,
-0.585798,
--0.987301,
-0.302002,
-0.715735,
--0.945610,
-0.134586,
-0.824587,
--0.876071,
--0.036807,
-0.909169,
--0.780735,
--0.207117,
-0.966978,
--0.662420,
--0.371313,
-0.996312,
--0.524577,
-0.514103,
--0.998795,
-0.427555,
-0.595699,
--0.989176,
-0.336890,
-0.671559,
--0.970031,
-0.242980,
-0.740951,
--0.941544,
-0.146731,
-0.803207,
--0.903990,
-0.049069,
-0.857729,
--0.857729,
--0.049068,
-0.903989,
--0.803207,
--0.146729,
-0.941544,
--0.740952,
--0.242980,
-0.970032,
--0.671559,
--0.336891,
-0.989176,
--0.595698,
--0.427554,
-0.998796,
--0.514104,
--0.514103,
-0.998795,
--0.427558,
--0.595698,
-0.989176,
--0.336888,
--0.671562,
-0.970032,
--0.242980,
--0.740952,
-0.941543,
--0.146733,
--0.803207,
-0.903989,
--0.049065,
--0.857727,
-0.857729,
-0.049068,
--0.903990,
-0.803210,
-0.146729,
--0.941544,
-0.740950,
-0.242984,
--0.970031,
-0.671559,
-0.336891,
--0.989177,
-0.595702,
-0.427554,
--0.998795,
-0.514107,
-0.514106,
--0.998796,
-0.427562,
-0.595701,
--0.989177,
-0.336885,
-0.671559,
--0.970033,
-0.242977,
-0.740949,
--0.941542,
-0.146729,
-0.803205,
--0.903987,
-0.049069,
-0.857725,
--0.857727,
--0.049064,
-0.903992,
--0.803207,
--0.146725,
-0.941545,
--0.740953,
--0.242987,
-0.970032,
--0.671562,
--0.336895,
-0.989176,
--0.595705,
--0.427558,
-0.998795,
--0.514097,
--0.514103,
-0.998796,
--0.427552,
--0.595698,
-0.989175,
--0.336888,
--0.671556,
-0.970030,
--0.242981,
--0.740947,
-0.941543,
--0.146733,
--0.803211,
-0.903989,
--0.049073,
--0.857731,
-0.857729,
-0.049060,
--0.903990,
-0.803210,
-0.146736,
--0.941544,
-0.740955,
-0.242983,
--0.970031,
-0.671554,
-0.336891,
--0.989176,
-0.595708,
-0.427568,
--0.998796,
-0.514101,
-0.503538,
--0.999925,
-0.482184,
-0.524590,
--0.999322,
-0.460539,
-0.545325,
--0.998118,
-0.438617,
-0.565731,
--0.996313,
-0.416429,
-0.585798,
--0.993907,
-0.393992,
-0.605511,
--0.990902,
-0.371318,
-0.624860,
--0.987302,
-0.348418,
-0.643831,
--0.983105,
-0.325312,
-0.662416,
--0.978317,
-0.302006,
-0.680602,
--0.972940,
-0.278519,
-0.698375,
--0.966976,
-0.254863,
-0.715728,
--0.960431,
-0.231058,
-0.732655,
--0.953305,
-0.207114,
-0.749136,
--0.945607,
-0.183037,
-0.765165,
--0.937340,
-0.158858,
-0.780738,
--0.928505,
-0.134583,
-0.795836,
--0.919114,
-0.110220,
-0.810455,
--0.909169,
-0.085797,
-0.824590,
--0.898673,
-0.061323,
-0.838224,
--0.887639,
-0.036804,
-0.851354,
--0.876071,
-0.012271,
-0.863974,
--0.863971,
--0.012277,
-0.876074,
--0.851359,
--0.036803,
-0.887638,
--0.838225,
--0.061321,
-0.898675,
--0.824587,
--0.085803,
-0.909171,
--0.810461,
--0.110218,
-0.919113,
--0.795838,
--0.134581,
-0.928507,
--0.780735,
--0.158864,
-0.937342,
--0.765171,
--0.183036,
-0.945606,
--0.749137,
--0.207112,
-0.953307,
--0.732651,
--0.231064,
-0.960433,
--0.715735,
--0.254862,
-0.966976,
--0.698377,
--0.278521,
-0.972941,
--0.680598,
--0.302012,
-0.978316,
--0.662420,
--0.325306,
-0.983105,
--0.643832,
--0.348420,
-0.987302,
--0.624856,
--0.371323,
-0.990902,
--0.605516,
--0.393988,
-0.993907,
--0.585798,
--0.416431,
-0.996313,
--0.565728,
--0.438622,
-0.998118,
--0.545330,
--0.460535,
-0.999323,
--0.524577,
--0.482172,
-0.999925,
--0.503547,
-0.492898,
--0.999699,
-0.534998,
-0.449611,
--0.997290,
-0.575808,
-0.405241,
--0.992480,
-0.615231,
-0.359895,
--0.985278,
-0.653173,
-0.313681,
--0.975702,
-0.689540,
-0.266712,
--0.963776,
-0.724248,
-0.219101,
--0.949529,
-0.757209,
-0.170963,
--0.932992,
-0.788346,
-0.122409,
--0.914210,
-0.817584,
-0.073564,
--0.893225,
-0.844854,
-0.024542,
--0.870088,
-0.870089,
--0.024543,
--0.844853,
-0.893224,
--0.073562,
--0.817583,
-0.914210,
--0.122411,
--0.788347,
-0.932992,
--0.170964,
--0.757208,
-0.949528,
--0.219099,
--0.724245,
-0.963777,
--0.266713,
--0.689541,
-0.975701,
--0.313685,
--0.653172,
-0.985278,
--0.359893,
--0.615234,
-0.992480,
--0.405242,
--0.575809,
-0.997290,
--0.449615,
--0.535002,
-0.999699,
--0.492904,
--0.492901,
-0.999699,
--0.534992,
--0.449612,
-0.997290,
--0.575805,
--0.405239,
-0.992480,
--0.615231,
--0.359890,
-0.985278,
--0.653174,
--0.313689,
-0.975702,
--0.689544,
--0.266717,
-0.963776,
--0.724252,
--0.219103,
-0.949527,
--0.757205,
--0.170961,
-0.932990,
--0.788345,
--0.122407,
-0.914212,
--0.817585,
--0.073559,
-0.893226,
--0.844855,
--0.024548,
-0.870087,
--0.870090,
-0.024537,
-0.844852,
--0.893221,
-0.073563,
-0.817582,
--0.914208,
-0.122412,
-0.788342,
--0.932992,
-0.170966,
-0.757212,
--0.949528,
-0.219108,
-0.724249,
--0.963777,
-0.266707,
-0.689540,
--0.975704,
-0.313679,
-0.653171,
--0.985277,
-0.359895,
-0.615227,
--0.992479,
-0.405230,
-0.575801,
--0.997290,
-0.449602,
-0.534988,
--0.999699,
-0.492892,
-0.482184,
--0.998118,
-0.585798,
-0.371317,
--0.983106,
-0.680601,
-0.254865,
--0.953306,
-0.765167,
-0.134580,
--0.909168,
-0.838224,
-0.012272,
--0.851355,
-0.898674,
--0.110221,
--0.780737,
-0.945607,
--0.231059,
--0.698376,
-0.978317,
--0.348419,
--0.605512,
-0.996313,
--0.460538,
--0.503537,
-0.999322,
--0.565731,
--0.393991,
-0.987302,
--0.662414,
--0.278523,
-0.960430,
--0.749137,
--0.158859,
-0.919115,
--0.824591,
--0.036805,
-0.863973,
--0.887639,
-0.085795,
-0.795835,
--0.937340,
-0.207112,
-0.715732,
--0.972939,
-0.325313,
-0.624858,
--0.993907,
-0.438615,
-0.524592,
--0.999925,
-0.545326,
-0.416430,
--0.990903,
-0.643829,
-0.302003,
--0.966976,
-0.732654,
-0.183042,
--0.928505,
-0.810459,
-0.061320,
--0.876070,
-0.876069,
--0.061317,
--0.810460,
-0.928503,
--0.183046,
--0.732651,
-0.966977,
--0.302008,
--0.643831,
-0.990902,
--0.416427,
--0.545329,
-0.999925,
--0.524583,
--0.438611,
-0.993906,
--0.624862,
--0.325309,
-0.972940,
--0.715730,
--0.207115,
-0.937341,
--0.795833,
--0.085790,
-0.887637,
--0.863975,
-0.036810,
-0.824589,
--0.919114,
-0.158856,
-0.749139,
--0.960429,
-0.278513,
-0.662411,
--0.987302,
-0.393995,
-0.565730,
--0.999322,
-0.503537,
-0.460541,
--0.996313,
-0.605506,
-0.348426,
--0.978316,
-0.698380,
-0.231055,
--0.945607,
-0.780737,
-0.110224,
--0.898676,
-0.851353,
--0.012265,
--0.838221,
-0.909170,
--0.134585,
--0.765166,
-0.953306,
--0.254880,
--0.680603,
-0.983108,
--0.371312,
--0.585791,
-0.998118,
--0.482188,
-0.471397,
--0.995185,
-0.634393,
-0.290285,
--0.956940,
-0.773011,
-0.098017,
--0.881921,
-0.881922,
--0.098016,
--0.773011,
-0.956940,
--0.290285,
--0.634393,
-0.995185,
--0.471396,
--0.471395,
-0.995185,
--0.634392,
--0.290284,
-0.956940,
--0.773009,
--0.098017,
-0.881922,
--0.881922,
-0.098017,
-0.773012,
--0.956941,
-0.290284,
-0.634392,
--0.995185,
-0.471399,
-0.471396,
--0.995185,
-0.634391,
-0.290281,
--0.956940,
-0.773011,
-0.098018,
--0.881922,
-0.881920,
--0.098020,
--0.773010,
-0.956940,
--0.290283,
--0.634396,
-0.995185,
--0.471398,
--0.471397,
-0.995185,
--0.634391,
--0.290282,
-0.956940,
--0.773010,
--0.098019,
-0.881923,
--0.881923,
-0.098018,
-0.773011,
--0.956940,
-0.290289,
-0.634397,
--0.995185,
-0.471403,
-0.471398,
--0.995184,
-0.634390,
-0.290283,
--0.956938,
-0.773009,
-0.098013,
--0.881923,
-0.881922,
--0.098010,
--0.773011,
-0.956942,
--0.290280,
--0.634392,
-0.995184,
--0.471396,
--0.471393,
-0.995185,
--0.634395,
--0.290292,
-0.956941,
--0.773014,
--0.098021,
-0.881920,
--0.881918,
-0.098016,
-0.773007,
--0.956939,
-0.290287,
-0.634399,
--0.995185,
-0.471401,
-0.471400,
--0.995185,
-0.634388,
-0.290286,
--0.956939,
-0.773008,
-0.098015,
--0.881925,
-0.881921,
--0.098022,
--0.773013,
-0.956941,
--0.290278,
--0.634394,
-0.995185,
--0.471393,
--0.471395,
-0.995185,
--0.634393,
--0.290279,
-0.956941,
--0.773012,
--0.098024,
-0.881921,
--0.881924,
-0.098029,
-0.773018,
--0.956938,
-0.290284,
-0.634389,
--0.995186,
-0.471386,
-0.460539,
--0.990903,
-0.680601,
-0.207111,
--0.919114,
-0.851355,
--0.061321,
--0.780737,
-0.960430,
--0.325310,
--0.585798,
-0.999925,
--0.565731,
--0.348419,
-0.966976,
--0.765168,
--0.085798,
-0.863972,
--0.909168,
-0.183039,
-0.698375,
--0.987301,
-0.438615,
-0.482183,
--0.993907,
-0.662417,
-0.231058,
--0.928507,
-0.838225,
--0.036811,
--0.795836,
-0.953306,
--0.302005,
--0.605513,
-0.999322,
--0.545327,
--0.371316,
-0.972940,
--0.749135,
--0.110225,
-0.876069,
--0.898675,
-0.158858,
-0.715732,
--0.983105,
-0.416433,
-0.503537,
--0.996313,
-0.643831,
-0.254868,
--0.937340,
-0.824591,
--0.012272,
--0.810457,
-0.945607,
--0.278516,
--0.624857,
-0.998118,
--0.524590,
--0.393986,
-0.978316,
--0.732657,
--0.134579,
-0.887639,
--0.887639,
-0.134578,
-0.732657,
--0.978316,
-0.393986,
-0.524584,
--0.998118,
-0.624863,
-0.278517,
--0.945607,
-0.810457,
-0.012273,
--0.824591,
-0.937337,
--0.254860,
--0.643837,
-0.996313,
--0.503543,
--0.416426,
-0.983105,
--0.715731,
--0.158859,
-0.898675,
--0.876068,
-0.110217,
-0.749141,
--0.972942,
-0.371323,
-0.545321,
--0.999322,
-0.605512,
-0.302006,
--0.953306,
-0.795835,
-0.036811,
--0.838228,
-0.928504,
--0.231065,
--0.662412,
-0.993907,
--0.482186,
--0.438615,
-0.987301,
--0.698375,
--0.183043,
-0.909170,
--0.863970,
-0.085790,
-0.765163,
--0.966978,
-0.348422,
-0.565730,
--0.999925,
-0.585810,
-0.325298,
--0.960427,
-0.780744,
-0.061312,
--0.851351,
-0.919116,
--0.207116,
--0.680599,
-0.990903,
--0.460539,
-0.449611,
--0.985278,
-0.724247,
-0.122411,
--0.870087,
-0.914210,
--0.219101,
--0.653173,
-0.997290,
--0.534998,
--0.359894,
-0.963776,
--0.788346,
--0.024541,
-0.817585,
--0.949529,
-0.313682,
-0.575809,
--0.999699,
-0.615232,
-0.266714,
--0.932992,
-0.844853,
--0.073563,
--0.757208,
-0.975702,
--0.405240,
--0.492898,
-0.992480,
--0.689542,
--0.170962,
-0.893225,
--0.893223,
-0.170958,
-0.689539,
--0.992480,
-0.492898,
-0.405243,
--0.975703,
-0.757211,
-0.073563,
--0.844853,
-0.932993,
--0.266711,
--0.615234,
-0.999699,
--0.575809,
--0.313682,
-0.949529,
--0.817583,
-0.024545,
-0.788345,
--0.963776,
-0.359895,
-0.534999,
--0.997291,
-0.653175,
-0.219100,
--0.914213,
-0.870086,
--0.122416,
--0.724250,
-0.985278,
--0.449605,
--0.449612,
-0.985277,
--0.724245,
--0.122407,
-0.870090,
--0.914210,
-0.219108,
-0.653175,
--0.997291,
-0.534993,
-0.359894,
--0.963774,
-0.788346,
-0.024536,
--0.817587,
-0.949529,
--0.313675,
--0.575809,
-0.999699,
--0.615229,
--0.266710,
-0.932995,
--0.844854,
-0.073571,
-0.757211,
--0.975703,
-0.405236,
-0.492897,
--0.992479,
-0.689539,
-0.170957,
--0.893226,
-0.893225,
--0.170955,
--0.689541,
-0.992480,
--0.492895,
--0.405239,
-0.975704,
--0.757209,
--0.073558,
-0.844855,
--0.932994,
-0.266707,
-0.615231,
--0.999699,
-0.575806,
-0.313678,
--0.949530,
-0.817586,
--0.024534,
--0.788347,
-0.963773,
--0.359906,
--0.534996,
-0.997291,
--0.653184,
--0.219096,
-0.914211,
--0.870081,
-0.122420,
-0.724247,
--0.985276,
-0.449623,
-0.438616,
--0.978317,
-0.765167,
-0.036807,
--0.810457,
-0.960430,
--0.371317,
--0.503539,
-0.990903,
--0.715730,
--0.110222,
-0.851355,
--0.937339,
-0.302006,
-0.565732,
--0.998118,
-0.662417,
-0.183040,
--0.887640,
-0.909169,
--0.231058,
--0.624860,
-0.999925,
--0.605511,
--0.254867,
-0.919113,
--0.876070,
-0.158857,
-0.680600,
--0.996313,
-0.545324,
-0.325313,
--0.945606,
-0.838226,
--0.085798,
--0.732654,
-0.987301,
--0.482181,
--0.393989,
-0.966976,
--0.795837,
-0.012271,
-0.780738,
--0.972939,
-0.416433,
-0.460537,
--0.983105,
-0.749136,
-0.061323,
--0.824591,
-0.953307,
--0.348420,
--0.524589,
-0.993907,
--0.698375,
--0.134584,
-0.863971,
--0.928504,
-0.278513,
-0.585792,
--0.999322,
-0.643835,
-0.207108,
--0.898674,
-0.898675,
--0.207110,
--0.643833,
-0.999322,
--0.585794,
--0.278526,
-0.928509,
--0.863976,
-0.134586,
-0.698373,
--0.993907,
-0.524591,
-0.348419,
--0.953306,
-0.824588,
--0.061317,
--0.749140,
-0.983104,
--0.460545,
--0.416424,
-0.972939,
--0.780740,
--0.012269,
-0.795836,
--0.966976,
-0.393991,
-0.482186,
--0.987302,
-0.732651,
-0.085804,
--0.838221,
-0.945609,
--0.325315,
--0.545322,
-0.996312,
--0.680602,
--0.158859,
-0.876071,
--0.919113,
-0.254861,
-0.605516,
--0.999925,
-0.624865,
-0.231053,
--0.909166,
-0.887641,
--0.183042,
--0.662415,
-0.998118,
--0.565730,
--0.302009,
-0.937335,
--0.851352,
-0.110230,
-0.715737,
--0.990903,
-0.503529,
-0.371315,
--0.960434,
-0.810457,
--0.036821,
--0.765169,
-0.978320,
--0.438612,
-0.427555,
--0.970031,
-0.803207,
--0.049068,
--0.740951,
-0.989176,
--0.514102,
--0.336890,
-0.941544,
--0.857729,
-0.146731,
-0.671560,
--0.998795,
-0.595700,
-0.242979,
--0.903989,
-0.903989,
--0.242982,
--0.595699,
-0.998796,
--0.671560,
--0.146730,
-0.857729,
--0.941545,
-0.336890,
-0.514103,
--0.989176,
-0.740952,
-0.049068,
--0.803209,
-0.970031,
--0.427558,
--0.427553,
-0.970031,
--0.803207,
-0.049066,
-0.740953,
--0.989177,
-0.514105,
-0.336889,
--0.941544,
-0.857728,
--0.146728,
--0.671562,
-0.998796,
--0.595700,
--0.242980,
-0.903990,
--0.903988,
-0.242977,
-0.595697,
--0.998795,
-0.671559,
-0.146731,
--0.857730,
-0.941543,
--0.336893,
--0.514101,
-0.989178,
--0.740951,
--0.049062,
-0.803209,
--0.970032,
-0.427550,
-0.427554,
--0.970029,
-0.803207,
--0.049073,
--0.740954,
-0.989177,
--0.514097,
--0.336890,
-0.941542,
--0.857727,
-0.146734,
-0.671563,
--0.998796,
-0.595693,
-0.242981,
--0.903987,
-0.903988,
--0.242983,
--0.595704,
-0.998795,
--0.671564,
--0.146732,
-0.857726,
--0.941543,
-0.336892,
-0.514109,
--0.989177,
-0.740955,
-0.049070,
--0.803205,
-0.970030,
--0.427556,
--0.427548,
-0.970032,
--0.803211,
-0.049064,
-0.740949,
--0.989176,
-0.514103,
-0.336884,
--0.941545,
-0.857731,
--0.146726,
--0.671558,
-0.998795,
--0.595699,
--0.242975,
-0.903991,
--0.903991,
-0.242990,
-0.595711,
--0.998796,
-0.671558,
-0.146726,
--0.857723,
-0.941540,
--0.336884,
--0.514103,
-0.989176,
--0.740960,
--0.049079,
-0.803211,
--0.970032,
-0.427562,
-0.416430,
--0.960431,
-0.838225,
--0.134580,
--0.662416,
-0.999925,
--0.643832,
--0.158857,
-0.851355,
--0.953306,
-0.393991,
-0.438616,
--0.966976,
-0.824589,
--0.110221,
--0.680600,
-0.999322,
--0.624859,
--0.183038,
-0.863973,
--0.945607,
-0.371319,
-0.460538,
--0.972940,
-0.810456,
--0.085798,
--0.698376,
-0.998118,
--0.605509,
--0.207115,
-0.876069,
--0.937340,
-0.348419,
-0.482184,
--0.978318,
-0.795835,
--0.061324,
--0.715729,
-0.996313,
--0.585798,
--0.231059,
-0.887641,
--0.928505,
-0.325313,
-0.503537,
--0.983105,
-0.780737,
--0.036806,
--0.732656,
-0.993907,
--0.565734,
--0.254864,
-0.898674,
--0.919114,
-0.302004,
-0.524592,
--0.987302,
-0.765164,
--0.012265,
--0.749131,
-0.990903,
--0.545329,
--0.278516,
-0.909167,
--0.909169,
-0.278520,
-0.545326,
--0.990903,
-0.749134,
-0.012276,
--0.765171,
-0.987300,
--0.524583,
--0.302000,
-0.919112,
--0.898676,
-0.254869,
-0.565730,
--0.993907,
-0.732654,
-0.036809,
--0.780739,
-0.983105,
--0.503534,
--0.325316,
-0.928509,
--0.887643,
-0.231064,
-0.585794,
--0.996312,
-0.715732,
-0.061320,
--0.795837,
-0.978317,
--0.482182,
--0.348422,
-0.937341,
--0.876067,
-0.207104,
-0.605505,
--0.998118,
-0.698380,
-0.085794,
--0.810456,
-0.972940,
--0.460539,
--0.371318,
-0.945608,
--0.863971,
-0.183035,
-0.624864,
--0.999323,
-0.680606,
-0.110216,
--0.824587,
-0.966977,
--0.438619,
--0.393991,
-0.953306,
--0.851355,
-0.158856,
-0.643834,
--0.999925,
-0.662412,
-0.134587,
--0.838229,
-0.960428,
--0.416420,
-0.405241,
--0.949528,
-0.870087,
--0.219101,
--0.575808,
-0.992480,
--0.757209,
-0.024541,
-0.724247,
--0.997290,
-0.615232,
-0.170961,
--0.844854,
-0.963776,
--0.449611,
--0.359897,
-0.932992,
--0.893224,
-0.266712,
-0.534996,
--0.985278,
-0.788346,
--0.073563,
--0.689540,
-0.999699,
--0.653172,
--0.122409,
-0.817584,
--0.975703,
-0.492900,
-0.313681,
--0.914210,
-0.914209,
--0.313680,
--0.492901,
-0.975701,
--0.817586,
-0.122412,
-0.653173,
--0.999699,
-0.689539,
-0.073568,
--0.788344,
-0.985278,
--0.534999,
--0.266713,
-0.893225,
--0.932992,
-0.359892,
-0.449608,
--0.963775,
-0.844854,
--0.170962,
--0.615232,
-0.997291,
--0.724250,
--0.024545,
-0.757207,
--0.992479,
-0.575808,
-0.219095,
--0.870088,
-0.949530,
--0.405238,
--0.405239,
-0.949530,
--0.870087,
-0.219108,
-0.575810,
--0.992479,
-0.757206,
--0.024544,
--0.724251,
-0.997290,
--0.615237,
--0.170964,
-0.844851,
--0.963775,
-0.449613,
-0.359901,
--0.932993,
-0.893227,
--0.266711,
--0.534994,
-0.985278,
--0.788348,
-0.073558,
-0.689540,
--0.999699,
-0.653171,
-0.122406,
--0.817587,
-0.975703,
--0.492893,
--0.313681,
-0.914207,
--0.914209,
-0.313686,
-0.492902,
--0.975702,
-0.817581,
--0.122411,
--0.653168,
-0.999699,
--0.689544,
--0.073569,
-0.788345,
--0.985277,
-0.534998,
-0.266706,
--0.893225,
-0.932989,
--0.359906,
--0.449609,
-0.963778,
--0.844846,
-0.170969,
-0.615233,
--0.997291,
-0.724255,
-0.024539,
--0.757213,
-0.992478,
--0.575814,
--0.219103,
-0.870092,
--0.949532,
-0.405244,
-0.393992,
--0.937339,
-0.898674,
--0.302006,
--0.482184,
-0.966976,
--0.851355,
-0.207111,
-0.565731,
--0.987301,
-0.795837,
--0.110222,
--0.643831,
-0.998118,
--0.732655,
-0.012271,
-0.715732,
--0.999322,
-0.662416,
-0.085798,
--0.780738,
-0.990903,
--0.585798,
--0.183041,
-0.838224,
--0.972940,
-0.503538,
-0.278517,
--0.887639,
-0.945607,
--0.416429,
--0.371319,
-0.928507,
--0.909166,
-0.325313,
-0.460537,
--0.960430,
-0.863973,
--0.231057,
--0.545327,
-0.983106,
--0.810459,
-0.134583,
-0.624858,
--0.996313,
-0.749136,
--0.036806,
--0.698378,
-0.999925,
--0.680603,
--0.061319,
-0.765167,
--0.993907,
-0.605510,
-0.158860,
--0.824591,
-0.978317,
--0.524585,
--0.254872,
-0.876074,
--0.953308,
-0.438622,
-0.348414,
--0.919112,
-0.919115,
--0.348421,
--0.438615,
-0.953306,
--0.876070,
-0.254864,
-0.524592,
--0.978318,
-0.824586,
--0.158852,
--0.605517,
-0.993906,
--0.765171,
-0.061326,
-0.680598,
--0.999925,
-0.698378,
-0.036806,
--0.749136,
-0.996313,
--0.624858,
--0.134584,
-0.810460,
--0.983105,
-0.545320,
-0.231065,
--0.863969,
-0.960432,
--0.460543,
--0.325306,
-0.909167,
--0.928507,
-0.371318,
-0.416430,
--0.945608,
-0.887639,
--0.278517,
--0.503542,
-0.972941,
--0.838221,
-0.183033,
-0.585792,
--0.990902,
-0.780740,
--0.085801,
--0.662413,
-0.999323,
--0.715732,
--0.012256,
-0.732655,
--0.998119,
-0.643829,
-0.110211,
--0.795840,
-0.987303,
--0.565726,
--0.207104,
-0.851360,
--0.966978,
-0.482174,
-0.302003,
--0.898680,
-0.937339,
--0.394006,
-0.382683,
--0.923880,
-0.923880,
--0.382683,
--0.382684,
-0.923880,
--0.923879,
-0.382684,
-0.382684,
--0.923879,
-0.923879,
--0.382684,
--0.382684,
-0.923879,
--0.923880,
-0.382684,
-0.382684,
--0.923880,
-0.923880,
--0.382684,
--0.382684,
-0.923880,
--0.923880,
-0.382684,
-0.382684,
--0.923880,
-0.923880,
--0.382684,
--0.382684,
-0.923880,
--0.923879,
-0.382681,
-0.382680,
--0.923879,
-0.923880,
--0.382684,
--0.382684,
-0.923880,
--0.923879,
-0.382681,
-0.382680,
--0.923879,
-0.923880,
--0.382684,
--0.382684,
-0.923880,
--0.923879,
-0.382681,
-0.382680,
--0.923879,
-0.923880,
--0.382684,
--0.382684,
-0.923880,
--0.923879,
-0.382688,
-0.382687,
--0.923878,
-0.923877,
--0.382684,
--0.382676,
-0.923880,
--0.923882,
-0.382681,
-0.382680,
--0.923881,
-0.923880,
--0.382677,
--0.382683,
-0.923877,
--0.923879,
-0.382688,
-0.382687,
--0.923878,
-0.923877,
--0.382684,
--0.382676,
-0.923880,
--0.923882,
-0.382681,
-0.382680,
--0.923881,
-0.923880,
--0.382677,
--0.382683,
-0.923877,
--0.923879,
-0.382688,
-0.382687,
--0.923878,
-0.923877,
--0.382684,
--0.382690,
-0.923880,
--0.923882,
-0.382681,
-0.382680,
--0.923881,
-0.923880,
--0.382677,
--0.382683,
-0.923877,
--0.923879,
-0.382688,
-0.382687,
--0.923878,
-0.923877,
--0.382684,
--0.382690,
-0.923880,
--0.923882,
-0.382695,
-0.382694,
--0.923881,
-0.923880,
--0.382692,
--0.382697,
-0.923883,
--0.923879,
-0.382688,
-0.382673,
--0.923884,
-0.923877,
--0.382685,
--0.382676,
-0.923874,
--0.923876,
-0.382681,
-0.371317,
--0.909168,
-0.945607,
--0.460539,
--0.278520,
-0.863973,
--0.972940,
-0.545324,
-0.183040,
--0.810458,
-0.990903,
--0.624859,
--0.085797,
-0.749137,
--0.999322,
-0.698377,
--0.012272,
--0.680601,
-0.998118,
--0.765166,
-0.110223,
-0.605511,
--0.987302,
-0.824588,
--0.207113,
--0.524589,
-0.966977,
--0.876069,
-0.302004,
-0.438619,
--0.937338,
-0.919115,
--0.393994,
--0.348418,
-0.898674,
--0.953306,
-0.482182,
-0.254868,
--0.851357,
-0.978318,
--0.565734,
--0.158856,
-0.795836,
--0.993907,
-0.643831,
-0.061323,
--0.732656,
-0.999925,
--0.715733,
-0.036810,
-0.662415,
--0.996313,
-0.780737,
--0.134580,
--0.585800,
-0.983106,
--0.838223,
-0.231054,
-0.503543,
--0.960432,
-0.887636,
--0.325317,
--0.416424,
-0.928504,
--0.928508,
-0.416433,
-0.325308,
--0.887639,
-0.960431,
--0.503538,
--0.231059,
-0.838226,
--0.983105,
-0.585795,
-0.134585,
--0.780741,
-0.996312,
--0.662411,
--0.036800,
-0.715726,
--0.999925,
-0.732657,
--0.061325,
--0.643829,
-0.993907,
--0.795838,
-0.158858,
-0.565732,
--0.978318,
-0.851354,
--0.254863,
--0.482187,
-0.953308,
--0.898672,
-0.348412,
-0.393999,
--0.919111,
-0.937341,
--0.438621,
--0.302002,
-0.876069,
--0.966977,
-0.524591,
-0.207111,
--0.824589,
-0.987301,
--0.605509,
--0.110225,
-0.765170,
--0.998118,
-0.680597,
-0.012278,
--0.698381,
-0.999323,
--0.749130,
-0.085787,
-0.624868,
--0.990904,
-0.810450,
--0.183027,
--0.545337,
-0.972943,
--0.863980,
-0.278533,
-0.460527,
--0.945603,
-0.909173,
--0.371327,
-0.359895,
--0.893224,
-0.963776,
--0.534998,
--0.170962,
-0.788346,
--0.997290,
-0.689540,
--0.024542,
--0.653173,
-0.992480,
--0.817585,
-0.219101,
-0.492898,
--0.949528,
-0.914209,
--0.405240,
--0.313681,
-0.870087,
--0.975702,
-0.575807,
-0.122409,
--0.757208,
-0.999699,
--0.724247,
-0.073563,
-0.615230,
--0.985278,
-0.844856,
--0.266716,
--0.449610,
-0.932992,
--0.932993,
-0.449611,
-0.266714,
--0.844855,
-0.985277,
--0.615229,
--0.073561,
-0.724245,
--0.999699,
-0.757209,
--0.122411,
--0.575809,
-0.975702,
--0.870086,
-0.313679,
-0.405238,
--0.914209,
-0.949529,
--0.492899,
--0.219101,
-0.817585,
--0.992480,
-0.653171,
-0.024537,
--0.689543,
-0.997290,
--0.788343,
-0.170963,
-0.535003,
--0.963776,
-0.893227,
--0.359893,
--0.359890,
-0.893226,
--0.963777,
-0.534993,
-0.170960,
--0.788350,
-0.997290,
--0.689546,
-0.024540,
-0.653169,
--0.992480,
-0.817587,
--0.219097,
--0.492896,
-0.949530,
--0.914210,
-0.405248,
-0.313683,
--0.870084,
-0.975702,
--0.575812,
--0.122415,
-0.757207,
--0.999699,
-0.724248,
--0.073557,
--0.615232,
-0.985277,
--0.844852,
-0.266717,
-0.449615,
--0.932992,
-0.932991,
--0.449612,
--0.266720,
-0.844854,
--0.985279,
-0.615230,
-0.073560,
--0.724250,
-0.999699,
--0.757205,
-0.122397,
-0.575801,
--0.975702,
-0.870083,
--0.313695,
--0.405237,
-0.914211,
--0.949525,
-0.492907,
-0.219099,
--0.817589,
-0.992478,
--0.653178,
--0.024542,
-0.689548,
--0.997290,
-0.788349,
--0.170957,
--0.535009,
-0.963774,
--0.893225,
-0.359888,
-0.348419,
--0.876070,
-0.978317,
--0.605511,
--0.061321,
-0.698376,
--0.996313,
-0.810457,
--0.231058,
--0.460538,
-0.928506,
--0.945607,
-0.503539,
-0.183038,
--0.780737,
-0.999322,
--0.732654,
-0.110221,
-0.565731,
--0.966976,
-0.898675,
--0.393991,
--0.302007,
-0.851354,
--0.987302,
-0.643832,
-0.012268,
--0.662414,
-0.990902,
--0.838225,
-0.278520,
-0.416430,
--0.909168,
-0.960430,
--0.545323,
--0.134584,
-0.749134,
--0.999925,
-0.765169,
--0.158859,
--0.524589,
-0.953306,
--0.919114,
-0.438615,
-0.254868,
--0.824591,
-0.993907,
--0.680603,
-0.036810,
-0.624858,
--0.983105,
-0.863973,
--0.325310,
--0.371318,
-0.887641,
--0.972939,
-0.585795,
-0.085802,
--0.715734,
-0.998118,
--0.795833,
-0.207104,
-0.482177,
--0.937337,
-0.937341,
--0.482188,
--0.207107,
-0.795835,
--0.998118,
-0.715732,
--0.085799,
--0.585797,
-0.972940,
--0.887639,
-0.371316,
-0.325313,
--0.863974,
-0.983105,
--0.624856,
--0.036813,
-0.680605,
--0.993908,
-0.824585,
--0.254872,
--0.438611,
-0.919112,
--0.953307,
-0.524593,
-0.158855,
--0.765166,
-0.999925,
--0.749137,
-0.134581,
-0.545325,
--0.960431,
-0.909167,
--0.416427,
--0.278523,
-0.838227,
--0.990902,
-0.662412,
--0.012265,
--0.643837,
-0.987300,
--0.851359,
-0.301997,
-0.393987,
--0.898679,
-0.966977,
--0.565722,
--0.110220,
-0.732664,
--0.999322,
-0.780728,
--0.183039,
--0.503526,
-0.945608,
--0.928511,
-0.460535,
-0.231048,
--0.810460,
-0.996313,
--0.698372,
-0.061329,
-0.605517,
--0.978316,
-0.876065,
--0.348423,
-0.336890,
--0.857729,
-0.989177,
--0.671559,
-0.049068,
-0.595699,
--0.970031,
-0.903990,
--0.427555,
--0.242981,
-0.803207,
--0.998795,
-0.740951,
--0.146729,
--0.514101,
-0.941544,
--0.941544,
-0.514103,
-0.146731,
--0.740952,
-0.998795,
--0.803208,
-0.242980,
-0.427556,
--0.903990,
-0.970031,
--0.595700,
--0.049067,
-0.671559,
--0.989177,
-0.857728,
--0.336888,
--0.336892,
-0.857730,
--0.989177,
-0.671561,
--0.049070,
--0.595698,
-0.970031,
--0.903989,
-0.427555,
-0.242981,
--0.803209,
-0.998795,
--0.740949,
-0.146727,
-0.514100,
--0.941543,
-0.941545,
--0.514104,
--0.146730,
-0.740951,
--0.998795,
-0.803211,
--0.242978,
--0.427551,
-0.903991,
--0.970032,
-0.595695,
-0.049066,
--0.671564,
-0.989176,
--0.857725,
-0.336889,
-0.336884,
--0.857730,
-0.989177,
--0.671557,
-0.049071,
-0.595703,
--0.970031,
-0.903987,
--0.427556,
--0.242987,
-0.803208,
--0.998796,
-0.740950,
--0.146736,
--0.514105,
-0.941543,
--0.941543,
-0.514105,
-0.146736,
--0.740950,
-0.998796,
--0.803208,
-0.242987,
-0.427556,
--0.903987,
-0.970031,
--0.595703,
--0.049072,
-0.671557,
--0.989177,
-0.857729,
--0.336884,
--0.336890,
-0.857725,
--0.989176,
-0.671563,
--0.049065,
--0.595696,
-0.970032,
--0.903991,
-0.427564,
-0.242993,
--0.803211,
-0.998795,
--0.740956,
-0.146745,
-0.514111,
--0.941545,
-0.941546,
--0.514113,
--0.146742,
-0.740954,
--0.998795,
-0.803213,
--0.242966,
--0.427562,
-0.903990,
--0.970033,
-0.595710,
-0.049078,
--0.671561,
-0.989176,
--0.857734,
-0.336878,
-0.325310,
--0.838225,
-0.996313,
--0.732654,
-0.158858,
-0.482184,
--0.919114,
-0.966976,
--0.605512,
--0.012272,
-0.624860,
--0.972940,
-0.909168,
--0.460538,
--0.183041,
-0.749137,
--0.998118,
-0.824590,
--0.302006,
--0.348419,
-0.851356,
--0.993907,
-0.715732,
--0.134582,
--0.503538,
-0.928506,
--0.960430,
-0.585797,
-0.036809,
--0.643833,
-0.978318,
--0.898673,
-0.438619,
-0.207109,
--0.765166,
-0.999322,
--0.810458,
-0.278520,
-0.371317,
--0.863973,
-0.990902,
--0.698375,
-0.110220,
-0.524592,
--0.937340,
-0.953307,
--0.565734,
--0.061319,
-0.662415,
--0.983105,
-0.887640,
--0.416429,
--0.231059,
-0.780738,
--0.999925,
-0.795835,
--0.254862,
--0.393996,
-0.876072,
--0.987301,
-0.680597,
--0.085791,
--0.545331,
-0.945610,
--0.945610,
-0.545330,
-0.085791,
--0.680597,
-0.987301,
--0.876072,
-0.393995,
-0.254863,
--0.795836,
-0.999925,
--0.780738,
-0.231059,
-0.416430,
--0.887640,
-0.983105,
--0.662414,
-0.061318,
-0.565734,
--0.953307,
-0.937338,
--0.524586,
--0.110228,
-0.698381,
--0.990904,
-0.863969,
--0.371324,
--0.278513,
-0.810454,
--0.999323,
-0.765170,
--0.207116,
--0.438613,
-0.898673,
--0.978318,
-0.643833,
--0.036809,
--0.585797,
-0.960430,
--0.928506,
-0.503551,
-0.134567,
--0.715722,
-0.993906,
--0.851361,
-0.348429,
-0.301996,
--0.824584,
-0.998119,
--0.749142,
-0.183048,
-0.460532,
--0.909165,
-0.972941,
--0.624864,
-0.012277,
-0.605507,
--0.966975,
-0.919115,
--0.482186,
--0.158856,
-0.732653,
--0.996313,
-0.838225,
--0.325310,
-0.313682,
--0.817585,
-0.999699,
--0.788346,
-0.266713,
-0.359895,
--0.844853,
-0.997290,
--0.757208,
-0.219102,
-0.405241,
--0.870087,
-0.992479,
--0.724247,
-0.170962,
-0.449612,
--0.893225,
-0.985277,
--0.689542,
-0.122412,
-0.492898,
--0.914210,
-0.975702,
--0.653172,
-0.073563,
-0.534996,
--0.932994,
-0.963775,
--0.615229,
-0.024545,
-0.575806,
--0.949527,
-0.949529,
--0.575809,
--0.024540,
-0.615231,
--0.963776,
-0.932993,
--0.534996,
--0.073566,
-0.653175,
--0.975703,
-0.914208,
--0.492901,
--0.122408,
-0.689539,
--0.985277,
-0.893225,
--0.449612,
--0.170961,
-0.724247,
--0.992479,
-0.870086,
--0.405247,
--0.219103,
-0.757206,
--0.997291,
-0.844856,
--0.359891,
--0.266710,
-0.788350,
--0.999699,
-0.817581,
--0.313682,
--0.313689,
-0.817585,
--0.999699,
-0.788346,
--0.266718,
--0.359897,
-0.844851,
--0.997290,
-0.757211,
--0.219097,
--0.405239,
-0.870090,
--0.992480,
-0.724242,
--0.170962,
--0.449605,
-0.893225,
--0.985279,
-0.689539,
--0.122416,
--0.492901,
-0.914208,
--0.975701,
-0.653175,
--0.073560,
--0.534996,
-0.932995,
--0.963776,
-0.615226,
--0.024541,
--0.575802,
-0.949529,
--0.949530,
-0.575806,
-0.024536,
--0.615234,
-0.963775,
--0.932991,
-0.535000,
-0.073570,
--0.653183,
-0.975700,
--0.914210,
-0.492892,
-0.122396,
--0.689536,
-0.985278,
--0.893220,
-0.449623,
-0.170957,
--0.724249,
-0.992481,
--0.870092,
-0.405244,
-0.219107,
--0.757218,
-0.997290,
--0.844854,
-0.359888,
-0.266699,
--0.788342,
-0.999699,
--0.817579,
-0.313694,
-0.302006,
--0.795837,
-0.999322,
--0.838225,
-0.371317,
-0.231058,
--0.749136,
-0.993907,
--0.876070,
-0.438616,
-0.158857,
--0.698376,
-0.983105,
--0.909169,
-0.503539,
-0.085797,
--0.643832,
-0.966977,
--0.937339,
-0.565731,
-0.012273,
--0.585797,
-0.945607,
--0.960431,
-0.624860,
--0.061324,
--0.524587,
-0.919113,
--0.978318,
-0.680602,
--0.134582,
--0.460538,
-0.887639,
--0.990903,
-0.732654,
--0.207110,
--0.393993,
-0.851356,
--0.998118,
-0.780735,
--0.278516,
--0.325307,
-0.810455,
--0.999925,
-0.824591,
--0.348420,
--0.254864,
-0.765167,
--0.996313,
-0.863973,
--0.416429,
--0.183041,
-0.715732,
--0.987302,
-0.898673,
--0.482181,
--0.110225,
-0.662418,
--0.972941,
-0.928504,
--0.545321,
--0.036813,
-0.605516,
--0.953308,
-0.953304,
--0.605505,
-0.036815,
-0.545319,
--0.928504,
-0.972941,
--0.662420,
-0.110227,
-0.482180,
--0.898673,
-0.987302,
--0.715733,
-0.183043,
-0.416427,
--0.863972,
-0.996313,
--0.765168,
-0.254866,
-0.348419,
--0.824589,
-0.999925,
--0.810456,
-0.325309,
-0.278522,
--0.780739,
-0.998118,
--0.851353,
-0.393988,
-0.207116,
--0.732658,
-0.990903,
--0.887637,
-0.460533,
-0.134587,
--0.680606,
-0.978316,
--0.919117,
-0.524595,
-0.061330,
--0.624855,
-0.960433,
--0.945609,
-0.585789,
--0.012275,
--0.565742,
-0.937338,
--0.966973,
-0.643833,
--0.085784,
--0.503537,
-0.909174,
--0.983106,
-0.698387,
--0.158857,
--0.438604,
-0.876071,
--0.993908,
-0.749135,
--0.231070,
--0.371320,
-0.838219,
--0.999322,
-0.795843,
--0.302001,
-0.290285,
--0.773011,
-0.995185,
--0.881921,
-0.471397,
-0.098017,
--0.634394,
-0.956940,
--0.956940,
-0.634393,
--0.098017,
--0.471397,
-0.881921,
--0.995185,
-0.773009,
--0.290286,
--0.290284,
-0.773010,
--0.995185,
-0.881921,
--0.471396,
--0.098018,
-0.634394,
--0.956941,
-0.956941,
--0.634394,
-0.098018,
-0.471396,
--0.881921,
-0.995185,
--0.773010,
-0.290284,
-0.290286,
--0.773012,
-0.995185,
--0.881920,
-0.471394,
-0.098020,
--0.634396,
-0.956939,
--0.956941,
-0.634395,
--0.098020,
--0.471395,
-0.881920,
--0.995185,
-0.773011,
--0.290285,
--0.290285,
-0.773011,
--0.995185,
-0.881924,
--0.471395,
--0.098011,
-0.634395,
--0.956939,
-0.956939,
--0.634397,
-0.098013,
-0.471394,
--0.881923,
-0.995185,
--0.773007,
-0.290286,
-0.290291,
--0.773010,
-0.995185,
--0.881921,
-0.471403,
-0.098018,
--0.634388,
-0.956941,
--0.956942,
-0.634392,
--0.098022,
--0.471399,
-0.881919,
--0.995184,
-0.773013,
--0.290280,
--0.290282,
-0.773014,
--0.995185,
-0.881918,
--0.471398,
--0.098024,
-0.634393,
--0.956943,
-0.956940,
--0.634399,
-0.098016,
-0.471391,
--0.881922,
-0.995185,
--0.773009,
-0.290289,
-0.290288,
--0.773008,
-0.995185,
--0.881923,
-0.471392,
-0.098015,
--0.634386,
-0.956944,
--0.956938,
-0.634394,
--0.098025,
--0.471383,
-0.881925,
--0.995185,
-0.773015,
--0.290298,
--0.290294,
-0.773012,
--0.995184,
-0.881927,
--0.471387,
--0.098021,
-0.634391,
--0.956937,
-0.956937,
--0.634389,
-0.098019,
-0.471389,
--0.881928,
-0.995184,
--0.773011,
-0.290292,
-0.278520,
--0.749136,
-0.987301,
--0.919114,
-0.565732,
--0.036807,
--0.503539,
-0.887640,
--0.996313,
-0.795837,
--0.348419,
--0.207111,
-0.698376,
--0.972940,
-0.945607,
--0.624859,
-0.110221,
-0.438618,
--0.851354,
-0.999925,
--0.838225,
-0.416430,
-0.134580,
--0.643831,
-0.953306,
--0.966976,
-0.680600,
--0.183039,
--0.371319,
-0.810458,
--0.998118,
-0.876069,
--0.482181,
--0.061324,
-0.585801,
--0.928507,
-0.983106,
--0.732656,
-0.254868,
-0.302004,
--0.765166,
-0.990902,
--0.909169,
-0.545326,
--0.012272,
--0.524589,
-0.898674,
--0.993907,
-0.780737,
--0.325310,
--0.231059,
-0.715732,
--0.978318,
-0.937338,
--0.605509,
-0.085795,
-0.460541,
--0.863974,
-0.999322,
--0.824587,
-0.393988,
-0.158863,
--0.662419,
-0.960432,
--0.960429,
-0.662411,
--0.158852,
--0.393998,
-0.824593,
--0.999323,
-0.863969,
--0.460545,
--0.085790,
-0.605506,
--0.937337,
-0.978319,
--0.715735,
-0.231064,
-0.325305,
--0.780734,
-0.993906,
--0.898676,
-0.524593,
-0.012268,
--0.545322,
-0.909167,
--0.990903,
-0.765169,
--0.302008,
--0.254864,
-0.732653,
--0.983105,
-0.928506,
--0.585798,
-0.061321,
-0.482184,
--0.876070,
-0.998118,
--0.810457,
-0.371316,
-0.183042,
--0.680603,
-0.966977,
--0.953305,
-0.643829,
--0.134577,
--0.416433,
-0.838227,
--0.999925,
-0.851353,
--0.438612,
--0.110227,
-0.624864,
--0.945609,
-0.972939,
--0.698372,
-0.207105,
-0.348425,
--0.795841,
-0.996313,
--0.887636,
-0.503531,
-0.036816,
--0.565739,
-0.919118,
--0.987300,
-0.749130,
--0.278510,
-0.266713,
--0.724247,
-0.975702,
--0.949528,
-0.653173,
--0.170961,
--0.359895,
-0.788346,
--0.992480,
-0.914210,
--0.575808,
-0.073565,
-0.449611,
--0.844853,
-0.999699,
--0.870087,
-0.492898,
-0.024542,
--0.534998,
-0.893225,
--0.997290,
-0.817584,
--0.405240,
--0.122409,
-0.615230,
--0.932994,
-0.985277,
--0.757207,
-0.313679,
-0.219105,
--0.689538,
-0.963775,
--0.963777,
-0.689543,
--0.219104,
--0.313679,
-0.757207,
--0.985277,
-0.932993,
--0.615233,
-0.122412,
-0.405240,
--0.817584,
-0.997290,
--0.893224,
-0.534998,
--0.024541,
--0.492899,
-0.870087,
--0.999699,
-0.844853,
--0.449617,
--0.073566,
-0.575804,
--0.914211,
-0.992480,
--0.788345,
-0.359899,
-0.170965,
--0.653170,
-0.949529,
--0.975703,
-0.724244,
--0.266716,
--0.266717,
-0.724245,
--0.975703,
-0.949529,
--0.653168,
-0.170963,
-0.359901,
--0.788346,
-0.992480,
--0.914210,
-0.575802,
--0.073565,
--0.449605,
-0.844854,
--0.999699,
-0.870087,
--0.492904,
--0.024543,
-0.534993,
--0.893225,
-0.997291,
--0.817583,
-0.405246,
-0.122414,
--0.615228,
-0.932994,
--0.985278,
-0.757206,
--0.313685,
--0.219106,
-0.689538,
--0.963777,
-0.963777,
--0.689537,
-0.219088,
-0.313673,
--0.757208,
-0.985279,
--0.932988,
-0.615238,
--0.122411,
--0.405248,
-0.817576,
--0.997290,
-0.893224,
--0.534990,
-0.024555,
-0.492893,
--0.870088,
-0.999699,
--0.844861,
-0.449616,
-0.073567,
--0.575817,
-0.914205,
--0.992480,
-0.788344,
--0.359884,
--0.170951,
-0.653170,
--0.949530,
-0.975699,
--0.724254,
-0.266715,
-0.254866,
--0.698376,
-0.960431,
--0.972940,
-0.732654,
--0.302006,
--0.207111,
-0.662415,
--0.945607,
-0.983106,
--0.765167,
-0.348419,
-0.158857,
--0.624858,
-0.928506,
--0.990903,
-0.795837,
--0.393993,
--0.110222,
-0.585798,
--0.909168,
-0.996313,
--0.824589,
-0.438616,
-0.061318,
--0.545322,
-0.887638,
--0.999322,
-0.851356,
--0.482186,
--0.012269,
-0.503537,
--0.863972,
-0.999925,
--0.876071,
-0.524591,
--0.036808,
--0.460538,
-0.838224,
--0.998118,
-0.898675,
--0.565732,
-0.085797,
-0.416430,
--0.810457,
-0.993907,
--0.919114,
-0.605510,
--0.134580,
--0.371318,
-0.780738,
--0.987302,
-0.937338,
--0.643830,
-0.183038,
-0.325313,
--0.749138,
-0.978318,
--0.953305,
-0.680599,
--0.231055,
--0.278523,
-0.715733,
--0.966977,
-0.966975,
--0.715728,
-0.278515,
-0.231063,
--0.680605,
-0.953308,
--0.978316,
-0.749133,
--0.325305,
--0.183046,
-0.643836,
--0.937341,
-0.987300,
--0.780733,
-0.371311,
-0.134587,
--0.605517,
-0.919117,
--0.993906,
-0.810453,
--0.416436,
--0.085790,
-0.565726,
--0.898671,
-0.998119,
--0.838228,
-0.460544,
-0.036801,
--0.524585,
-0.876067,
--0.999925,
-0.863976,
--0.503543,
-0.012261,
-0.482179,
--0.851361,
-0.999322,
--0.887635,
-0.545329,
--0.061310,
--0.438613,
-0.824596,
--0.996312,
-0.909163,
--0.585800,
-0.110210,
-0.393989,
--0.795845,
-0.990902,
--0.928501,
-0.624861,
--0.158845,
--0.348417,
-0.765176,
--0.983105,
-0.945603,
--0.662416,
-0.207097,
-0.302005,
--0.732664,
-0.972940,
--0.960426,
-0.698376,
--0.254880,
-0.242980,
--0.671559,
-0.941544,
--0.989176,
-0.803208,
--0.427555,
--0.049068,
-0.514103,
--0.857728,
-0.998795,
--0.903990,
-0.595700,
--0.146729,
--0.336891,
-0.740952,
--0.970032,
-0.970031,
--0.740952,
-0.336891,
-0.146729,
--0.595698,
-0.903989,
--0.998796,
-0.857729,
--0.514104,
-0.049069,
-0.427554,
--0.803207,
-0.989176,
--0.941544,
-0.671559,
--0.242980,
--0.242980,
-0.671559,
--0.941544,
-0.989176,
--0.803207,
-0.427555,
-0.049068,
--0.514103,
-0.857729,
--0.998795,
-0.903989,
--0.595698,
-0.146729,
-0.336891,
--0.740952,
-0.970032,
--0.970031,
-0.740955,
--0.336888,
--0.146725,
-0.595701,
--0.903987,
-0.998795,
--0.857731,
-0.514101,
--0.049073,
--0.427558,
-0.803205,
--0.989177,
-0.941546,
--0.671557,
-0.242984,
-0.242984,
--0.671556,
-0.941545,
--0.989177,
-0.803205,
--0.427558,
--0.049072,
-0.514100,
--0.857731,
-0.998795,
--0.903987,
-0.595702,
--0.146726,
--0.336887,
-0.740954,
--0.970031,
-0.970030,
--0.740953,
-0.336885,
-0.146728,
--0.595704,
-0.903989,
--0.998795,
-0.857729,
--0.514097,
-0.049069,
-0.427561,
--0.803207,
-0.989177,
--0.941544,
-0.671554,
--0.242981,
--0.242987,
-0.671570,
--0.941547,
-0.989177,
--0.803212,
-0.427541,
-0.049075,
--0.514103,
-0.857725,
--0.998795,
-0.903986,
--0.595699,
-0.146737,
-0.336876,
--0.740957,
-0.970032,
--0.970033,
-0.740960,
--0.336881,
--0.146732,
-0.595695,
--0.903984,
-0.998795,
--0.857728,
-0.514107,
--0.049081,
--0.427564,
-0.803209,
--0.989176,
-0.941548,
--0.671551,
-0.242977,
-0.231058,
--0.643832,
-0.919114,
--0.998118,
-0.863973,
--0.545325,
-0.110222,
-0.348419,
--0.732655,
-0.960431,
--0.983105,
-0.795837,
--0.438616,
--0.012272,
-0.460539,
--0.810458,
-0.987302,
--0.953306,
-0.715730,
--0.325310,
--0.134582,
-0.565733,
--0.876071,
-0.999322,
--0.909168,
-0.624859,
--0.207110,
--0.254867,
-0.662417,
--0.928507,
-0.996312,
--0.851354,
-0.524588,
--0.085796,
--0.371319,
-0.749137,
--0.966977,
-0.978317,
--0.780736,
-0.416428,
-0.036809,
--0.482185,
-0.824590,
--0.990903,
-0.945607,
--0.698375,
-0.302004,
-0.158860,
--0.585800,
-0.887641,
--0.999925,
-0.898673,
--0.605509,
-0.183038,
-0.278522,
--0.680603,
-0.937340,
--0.993907,
-0.838223,
--0.503536,
-0.061318,
-0.393994,
--0.765169,
-0.972941,
--0.972939,
-0.765165,
--0.393989,
--0.061324,
-0.503541,
--0.838226,
-0.993907,
--0.937338,
-0.680599,
--0.278517,
--0.183043,
-0.605514,
--0.898676,
-0.999925,
--0.887638,
-0.585795,
--0.158855,
--0.302009,
-0.698379,
--0.945608,
-0.990902,
--0.824587,
-0.482181,
--0.036803,
--0.416433,
-0.780740,
--0.978318,
-0.966975,
--0.749134,
-0.371313,
-0.085801,
--0.524593,
-0.851349,
--0.996312,
-0.928510,
--0.662424,
-0.254876,
-0.207101,
--0.624851,
-0.909163,
--0.999323,
-0.876075,
--0.565741,
-0.134591,
-0.325300,
--0.715723,
-0.953303,
--0.987303,
-0.810463,
--0.460548,
-0.012282,
-0.438607,
--0.795831,
-0.983104,
--0.960433,
-0.732661,
--0.348428,
--0.110212,
-0.545317,
--0.863968,
-0.998118,
--0.919118,
-0.643839,
--0.231068,
-0.219101,
--0.615232,
-0.893224,
--0.999699,
-0.914210,
--0.653173,
-0.266713,
-0.170962,
--0.575808,
-0.870087,
--0.997290,
-0.932993,
--0.689541,
-0.313682,
-0.122410,
--0.534997,
-0.844853,
--0.992479,
-0.949528,
--0.724247,
-0.359896,
-0.073564,
--0.492898,
-0.817584,
--0.985278,
-0.963775,
--0.757207,
-0.405238,
-0.024544,
--0.449614,
-0.788348,
--0.975703,
-0.975701,
--0.788345,
-0.449609,
--0.024538,
--0.405244,
-0.757211,
--0.963777,
-0.985277,
--0.817583,
-0.492896,
--0.073562,
--0.359898,
-0.724249,
--0.949529,
-0.992479,
--0.844856,
-0.534995,
--0.122416,
--0.313684,
-0.689537,
--0.932994,
-0.997291,
--0.870086,
-0.575813,
--0.170960,
--0.266708,
-0.653175,
--0.914208,
-0.999699,
--0.893227,
-0.615230,
--0.219107,
--0.219103,
-0.615227,
--0.893225,
-0.999699,
--0.914209,
-0.653177,
--0.266711,
--0.170956,
-0.575810,
--0.870084,
-0.997291,
--0.932995,
-0.689539,
--0.313687,
--0.122412,
-0.534993,
--0.844854,
-0.992479,
--0.949528,
-0.724251,
--0.359894,
--0.073558,
-0.492900,
--0.817581,
-0.985278,
--0.963778,
-0.757208,
--0.405247,
--0.024543,
-0.449606,
--0.788347,
-0.975704,
--0.975705,
-0.788350,
--0.449610,
-0.024532,
-0.405228,
--0.757205,
-0.963776,
--0.985276,
-0.817593,
--0.492904,
-0.073564,
-0.359903,
--0.724237,
-0.949526,
--0.992479,
-0.844849,
--0.535010,
-0.122417,
-0.313682,
--0.689547,
-0.932988,
--0.997291,
-0.870087,
--0.575801,
-0.170976,
-0.266706,
--0.653173,
-0.914213,
--0.999699,
-0.893228,
--0.615231,
-0.219093,
-0.207111,
--0.585798,
-0.863973,
--0.993907,
-0.953306,
--0.749136,
-0.416430,
--0.012272,
--0.393991,
-0.732654,
--0.945608,
-0.996313,
--0.876071,
-0.605512,
--0.231059,
--0.183038,
-0.565731,
--0.851354,
-0.990902,
--0.960431,
-0.765166,
--0.438615,
-0.036806,
-0.371315,
--0.715729,
-0.937338,
--0.998118,
-0.887641,
--0.624862,
-0.254868,
-0.158855,
--0.545322,
-0.838223,
--0.987301,
-0.966977,
--0.780739,
-0.460542,
--0.061324,
--0.348415,
-0.698374,
--0.928507,
-0.999322,
--0.898673,
-0.643829,
--0.278516,
--0.134584,
-0.524592,
--0.824591,
-0.983106,
--0.972939,
-0.795835,
--0.482181,
-0.085795,
-0.325313,
--0.680603,
-0.919115,
--0.999925,
-0.909167,
--0.662414,
-0.302004,
-0.110224,
--0.503540,
-0.810458,
--0.978318,
-0.978317,
--0.810456,
-0.503537,
--0.110221,
--0.302007,
-0.662416,
--0.909168,
-0.999925,
--0.919114,
-0.680601,
--0.325310,
--0.085798,
-0.482184,
--0.795837,
-0.972940,
--0.983105,
-0.824589,
--0.524590,
-0.134581,
-0.278519,
--0.643831,
-0.898674,
--0.999322,
-0.928506,
--0.698377,
-0.348420,
-0.061320,
--0.460538,
-0.780736,
--0.966976,
-0.987299,
--0.838226,
-0.545314,
--0.158860,
--0.254879,
-0.624858,
--0.887646,
-0.998118,
--0.937334,
-0.715732,
--0.371305,
--0.036805,
-0.438628,
--0.765166,
-0.960434,
--0.990903,
-0.851349,
--0.565734,
-0.183028,
-0.231055,
--0.605520,
-0.876068,
--0.996314,
-0.945609,
--0.732646,
-0.393996,
-0.012283,
--0.416426,
-0.749144,
--0.953305,
-0.993906,
--0.863975,
-0.585789,
--0.207116,
-0.195090,
--0.555570,
-0.831470,
--0.980785,
-0.980785,
--0.831470,
-0.555570,
--0.195090,
--0.195091,
-0.555571,
--0.831470,
-0.980785,
--0.980785,
-0.831469,
--0.555569,
-0.195089,
-0.195091,
--0.555571,
-0.831470,
--0.980785,
-0.980785,
--0.831469,
-0.555570,
--0.195090,
--0.195090,
-0.555570,
--0.831469,
-0.980785,
--0.980785,
-0.831470,
--0.555571,
-0.195092,
-0.195089,
--0.555569,
-0.831469,
--0.980785,
-0.980786,
--0.831471,
-0.555572,
--0.195093,
--0.195087,
-0.555568,
--0.831468,
-0.980785,
--0.980786,
-0.831472,
--0.555567,
-0.195094,
-0.195094,
--0.555567,
-0.831471,
--0.980784,
-0.980785,
--0.831472,
-0.555568,
--0.195096,
--0.195092,
-0.555565,
--0.831471,
-0.980784,
--0.980785,
-0.831473,
--0.555569,
-0.195097,
-0.195091,
--0.555564,
-0.831470,
--0.980784,
-0.980785,
--0.831465,
-0.555570,
--0.195083,
--0.195090,
-0.555576,
--0.831469,
-0.980787,
--0.980786,
-0.831466,
--0.555572,
-0.195085,
-0.195088,
--0.555575,
-0.831468,
--0.980786,
-0.980786,
--0.831467,
-0.555573,
--0.195086,
--0.195087,
-0.555574,
--0.831468,
-0.980786,
--0.980786,
-0.831468,
--0.555574,
-0.195102,
-0.195101,
--0.555573,
-0.831467,
--0.980783,
-0.980783,
--0.831468,
-0.555575,
--0.195103,
--0.195100,
-0.555572,
--0.831466,
-0.980783,
--0.980784,
-0.831469,
--0.555576,
-0.195105,
-0.195098,
--0.555570,
-0.831465,
--0.980788,
-0.980784,
--0.831470,
-0.555577,
--0.195076,
--0.195097,
-0.555569,
--0.831465,
-0.980788,
--0.980784,
-0.831471,
--0.555578,
-0.195077,
-0.183040,
--0.524590,
-0.795837,
--0.960431,
-0.996313,
--0.898675,
-0.680601,
--0.371317,
-0.012272,
-0.348418,
--0.662415,
-0.887639,
--0.993907,
-0.966976,
--0.810457,
-0.545325,
--0.207111,
--0.158858,
-0.503538,
--0.780737,
-0.953306,
--0.998118,
-0.909169,
--0.698375,
-0.393990,
--0.036806,
--0.325312,
-0.643832,
--0.876071,
-0.990903,
--0.972940,
-0.824589,
--0.565732,
-0.231058,
-0.134580,
--0.482183,
-0.765167,
--0.945607,
-0.999322,
--0.919115,
-0.715732,
--0.416432,
-0.061323,
-0.302003,
--0.624857,
-0.863971,
--0.987302,
-0.978317,
--0.838223,
-0.585795,
--0.254862,
--0.110225,
-0.460541,
--0.749138,
-0.937340,
--0.999925,
-0.928505,
--0.732653,
-0.438615,
--0.085796,
--0.278521,
-0.605512,
--0.851355,
-0.983106,
--0.983105,
-0.851355,
--0.605511,
-0.278520,
-0.085796,
--0.438615,
-0.732653,
--0.928505,
-0.999925,
--0.937340,
-0.749138,
--0.460541,
-0.110225,
-0.254863,
--0.585795,
-0.838223,
--0.978317,
-0.987302,
--0.863975,
-0.624863,
--0.302010,
--0.061316,
-0.416425,
--0.715727,
-0.919112,
--0.999322,
-0.945609,
--0.765171,
-0.482176,
--0.134572,
--0.231066,
-0.565738,
--0.824594,
-0.972942,
--0.990902,
-0.876067,
--0.643826,
-0.325304,
-0.036814,
--0.393998,
-0.698380,
--0.909170,
-0.998118,
--0.953304,
-0.780734,
--0.503534,
-0.158854,
-0.207116,
--0.545328,
-0.810459,
--0.966977,
-0.993907,
--0.887638,
-0.662414,
--0.348416,
--0.012274,
-0.371319,
--0.680602,
-0.898675,
--0.996313,
-0.960430,
--0.795836,
-0.524589,
--0.183039,
-0.170962,
--0.492898,
-0.757209,
--0.932993,
-0.999699,
--0.949528,
-0.788346,
--0.534998,
-0.219102,
-0.122412,
--0.449612,
-0.724247,
--0.914210,
-0.997290,
--0.963776,
-0.817585,
--0.575809,
-0.266714,
-0.073563,
--0.405243,
-0.689542,
--0.893225,
-0.992480,
--0.975703,
-0.844856,
--0.615229,
-0.313679,
-0.024544,
--0.359898,
-0.653175,
--0.870088,
-0.985278,
--0.985277,
-0.870086,
--0.653172,
-0.359894,
--0.024541,
--0.313682,
-0.615231,
--0.844853,
-0.975702,
--0.992480,
-0.893225,
--0.689542,
-0.405243,
--0.073567,
--0.266717,
-0.575806,
--0.817587,
-0.963775,
--0.997290,
-0.914211,
--0.724245,
-0.449616,
--0.122408,
--0.219096,
-0.534999,
--0.788343,
-0.949529,
--0.999699,
-0.932993,
--0.757214,
-0.492898,
--0.170955,
--0.170961,
-0.492904,
--0.757208,
-0.932995,
--0.999699,
-0.949526,
--0.788348,
-0.534993,
--0.219104,
--0.122415,
-0.449608,
--0.724250,
-0.914208,
--0.997291,
-0.963777,
--0.817583,
-0.575813,
--0.266711,
--0.073558,
-0.405242,
--0.689536,
-0.893225,
--0.992479,
-0.975702,
--0.844850,
-0.615232,
--0.313675,
--0.024540,
-0.359901,
--0.653183,
-0.870082,
--0.985277,
-0.985277,
--0.870081,
-0.653181,
--0.359898,
-0.024538,
-0.313692,
--0.615222,
-0.844851,
--0.975703,
-0.992478,
--0.893230,
-0.689545,
--0.405240,
-0.073556,
-0.266699,
--0.575802,
-0.817585,
--0.963778,
-0.997289,
--0.914213,
-0.724248,
--0.449606,
-0.122397,
-0.219092,
--0.534996,
-0.788349,
--0.949532,
-0.999699,
--0.932994,
-0.757206,
--0.492889,
-0.170974,
-0.158858,
--0.460539,
-0.715731,
--0.898674,
-0.990903,
--0.983106,
-0.876070,
--0.680602,
-0.416429,
--0.110222,
--0.207111,
-0.503538,
--0.749136,
-0.919113,
--0.996312,
-0.972940,
--0.851354,
-0.643831,
--0.371317,
-0.061320,
-0.254866,
--0.545325,
-0.780737,
--0.937339,
-0.999322,
--0.960431,
-0.824591,
--0.605513,
-0.325313,
--0.012275,
--0.302002,
-0.585801,
--0.810459,
-0.953307,
--0.999925,
-0.945607,
--0.795836,
-0.565731,
--0.278519,
--0.036808,
-0.348419,
--0.624859,
-0.838224,
--0.966976,
-0.998118,
--0.928504,
-0.765164,
--0.524585,
-0.231054,
-0.085802,
--0.393996,
-0.662418,
--0.863974,
-0.978318,
--0.993907,
-0.909167,
--0.732653,
-0.482183,
--0.183039,
--0.134581,
-0.438616,
--0.698376,
-0.887639,
--0.987301,
-0.987302,
--0.887640,
-0.698378,
--0.438618,
-0.134583,
-0.183037,
--0.482181,
-0.732652,
--0.909166,
-0.993906,
--0.978318,
-0.863976,
--0.662420,
-0.393998,
--0.085804,
--0.231051,
-0.524583,
--0.765172,
-0.928509,
--0.998119,
-0.966975,
--0.838221,
-0.624855,
--0.348414,
-0.036802,
-0.278524,
--0.565735,
-0.795830,
--0.945608,
-0.999925,
--0.953305,
-0.810465,
--0.585796,
-0.302019,
-0.012273,
--0.325297,
-0.605511,
--0.824581,
-0.960430,
--0.999322,
-0.937339,
--0.780729,
-0.545326,
--0.254853,
--0.061318,
-0.371329,
--0.643829,
-0.851361,
--0.972939,
-0.996312,
--0.919116,
-0.749130,
--0.503543,
-0.207102,
-0.110216,
--0.416437,
-0.680596,
--0.876074,
-0.983104,
--0.990902,
-0.898678,
--0.715726,
-0.460547,
--0.158853,
-0.146730,
--0.427555,
-0.671559,
--0.857729,
-0.970031,
--0.998795,
-0.941544,
--0.803207,
-0.595699,
--0.336890,
-0.049069,
-0.242979,
--0.514101,
-0.740952,
--0.903990,
-0.989177,
--0.989176,
-0.903989,
--0.740952,
-0.514104,
--0.242982,
--0.049070,
-0.336891,
--0.595700,
-0.803208,
--0.941544,
-0.998795,
--0.970031,
-0.857729,
--0.671560,
-0.427557,
--0.146733,
--0.146728,
-0.427552,
--0.671562,
-0.857730,
--0.970032,
-0.998795,
--0.941543,
-0.803207,
--0.595698,
-0.336889,
--0.049067,
--0.242980,
-0.514102,
--0.740950,
-0.903992,
--0.989176,
-0.989176,
--0.903991,
-0.740948,
--0.514106,
-0.242977,
-0.049063,
--0.336892,
-0.595695,
--0.803208,
-0.941542,
--0.998795,
-0.970033,
--0.857729,
-0.671554,
--0.427556,
-0.146724,
-0.146729,
--0.427560,
-0.671557,
--0.857731,
-0.970030,
--0.998795,
-0.941546,
--0.803206,
-0.595704,
--0.336888,
-0.049074,
-0.242981,
--0.514096,
-0.740951,
--0.903992,
-0.989176,
--0.989176,
-0.903990,
--0.740948,
-0.514105,
--0.242976,
--0.049064,
-0.336893,
--0.595696,
-0.803209,
--0.941542,
-0.998795,
--0.970029,
-0.857728,
--0.671564,
-0.427541,
--0.146723,
--0.146730,
-0.427547,
--0.671569,
-0.857731,
--0.970031,
-0.998796,
--0.941540,
-0.803205,
--0.595703,
-0.336902,
--0.049058,
--0.242982,
-0.514097,
--0.740942,
-0.903993,
--0.989177,
-0.989178,
--0.903983,
-0.740947,
--0.514104,
-0.242990,
-0.049080,
--0.336894,
-0.595696,
--0.803201,
-0.941548,
--0.998796,
-0.970033,
--0.857735,
-0.671552,
--0.427554,
-0.146737,
-0.134581,
--0.393992,
-0.624860,
--0.810457,
-0.937339,
--0.996313,
-0.983105,
--0.898674,
-0.749137,
--0.545324,
-0.302006,
--0.036806,
--0.231059,
-0.482184,
--0.698376,
-0.863973,
--0.966976,
-0.999925,
--0.960431,
-0.851354,
--0.680600,
-0.460538,
--0.207108,
--0.061324,
-0.325313,
--0.565734,
-0.765168,
--0.909168,
-0.987302,
--0.993907,
-0.928506,
--0.795837,
-0.605512,
--0.371319,
-0.110225,
-0.158855,
--0.416426,
-0.643834,
--0.824591,
-0.945608,
--0.998118,
-0.978317,
--0.887639,
-0.732654,
--0.524590,
-0.278513,
--0.012265,
--0.254872,
-0.503543,
--0.715734,
-0.876072,
--0.972941,
-0.999322,
--0.953305,
-0.838223,
--0.662414,
-0.438615,
--0.183039,
--0.085798,
-0.348419,
--0.585797,
-0.780737,
--0.919113,
-0.990902,
--0.990903,
-0.919115,
--0.780740,
-0.585801,
--0.348423,
-0.085802,
-0.183034,
--0.438611,
-0.662411,
--0.838221,
-0.953308,
--0.999323,
-0.972938,
--0.876067,
-0.715727,
--0.503534,
-0.254861,
-0.012275,
--0.278523,
-0.524592,
--0.732656,
-0.887640,
--0.978318,
-0.998118,
--0.945607,
-0.824589,
--0.643832,
-0.416431,
--0.158860,
--0.110220,
-0.371315,
--0.605508,
-0.795835,
--0.928504,
-0.993906,
--0.987302,
-0.909170,
--0.765171,
-0.565737,
--0.325317,
-0.061329,
-0.207103,
--0.460531,
-0.680594,
--0.851350,
-0.960428,
--0.999925,
-0.966979,
--0.863979,
-0.698385,
--0.482195,
-0.231071,
-0.036793,
--0.301992,
-0.545312,
--0.749146,
-0.898681,
--0.983108,
-0.996311,
--0.937335,
-0.810450,
--0.624850,
-0.393982,
--0.134570,
-0.122411,
--0.359895,
-0.575808,
--0.757209,
-0.893224,
--0.975702,
-0.999699,
--0.963776,
-0.870087,
--0.724247,
-0.534998,
--0.313681,
-0.073564,
-0.170962,
--0.405241,
-0.615230,
--0.788348,
-0.914210,
--0.985278,
-0.997290,
--0.949528,
-0.844854,
--0.689542,
-0.492900,
--0.266716,
-0.024545,
-0.219105,
--0.449614,
-0.653175,
--0.817586,
-0.932993,
--0.992480,
-0.992480,
--0.932993,
-0.817585,
--0.653174,
-0.449613,
--0.219104,
--0.024538,
-0.266716,
--0.492901,
-0.689542,
--0.844855,
-0.949529,
--0.997290,
-0.985278,
--0.914207,
-0.788347,
--0.615227,
-0.405243,
--0.170957,
--0.073561,
-0.313685,
--0.534994,
-0.724249,
--0.870084,
-0.963776,
--0.999699,
-0.975702,
--0.893221,
-0.757209,
--0.575803,
-0.359897,
--0.122406,
--0.122407,
-0.359899,
--0.575805,
-0.757211,
--0.893222,
-0.975702,
--0.999699,
-0.963776,
--0.870083,
-0.724248,
--0.534992,
-0.313684,
--0.073560,
--0.170959,
-0.405245,
--0.615228,
-0.788348,
--0.914207,
-0.985278,
--0.997291,
-0.949528,
--0.844850,
-0.689541,
--0.492893,
-0.266715,
--0.024536,
--0.219113,
-0.449601,
--0.653170,
-0.817586,
--0.932996,
-0.992478,
--0.992480,
-0.932993,
--0.817581,
-0.653162,
--0.449619,
-0.219103,
-0.024546,
--0.266724,
-0.492888,
--0.689537,
-0.844855,
--0.949531,
-0.997289,
--0.985279,
-0.914210,
--0.788342,
-0.615220,
--0.405250,
-0.170964,
-0.073570,
--0.313693,
-0.534988,
--0.724244,
-0.870088,
--0.963779,
-0.999698,
--0.975704,
-0.893224,
--0.757204,
-0.575796,
--0.359903,
-0.122413,
-0.110222,
--0.325310,
-0.524590,
--0.698376,
-0.838225,
--0.937339,
-0.990903,
--0.996313,
-0.953306,
--0.863973,
-0.732654,
--0.565732,
-0.371318,
--0.158859,
--0.061319,
-0.278521,
--0.482184,
-0.662416,
--0.810457,
-0.919113,
--0.983106,
-0.999322,
--0.966976,
-0.887640,
--0.765168,
-0.605512,
--0.416431,
-0.207114,
-0.012268,
--0.231062,
-0.438619,
--0.624861,
-0.780738,
--0.898675,
-0.972940,
--0.999925,
-0.978318,
--0.909169,
-0.795838,
--0.643834,
-0.460542,
--0.254862,
-0.036804,
-0.183042,
--0.393986,
-0.585792,
--0.749131,
-0.876074,
--0.960432,
-0.998118,
--0.987301,
-0.928504,
--0.824587,
-0.680599,
--0.503536,
-0.302004,
--0.085796,
--0.134581,
-0.348419,
--0.545324,
-0.715730,
--0.851354,
-0.945606,
--0.993907,
-0.993907,
--0.945609,
-0.851358,
--0.715735,
-0.545331,
--0.348425,
-0.134573,
-0.085804,
--0.302012,
-0.503543,
--0.680604,
-0.824592,
--0.928507,
-0.987302,
--0.998118,
-0.960430,
--0.876070,
-0.749136,
--0.585798,
-0.393993,
--0.183042,
--0.036805,
-0.254863,
--0.460535,
-0.643828,
--0.795843,
-0.909166,
--0.978319,
-0.999925,
--0.972938,
-0.898678,
--0.780733,
-0.624867,
--0.438612,
-0.231069,
--0.012268,
--0.207099,
-0.416432,
--0.605500,
-0.765168,
--0.887633,
-0.966976,
--0.999323,
-0.983106,
--0.919109,
-0.810459,
--0.662407,
-0.482187,
--0.278510,
-0.061326,
-0.158867,
--0.371311,
-0.565738,
--0.732649,
-0.863976,
--0.953303,
-0.996313,
--0.990904,
-0.937338,
--0.838231,
-0.698374,
--0.524601,
-0.325309,
--0.110237,
-0.098017,
--0.290285,
-0.471397,
--0.634394,
-0.773010,
--0.881921,
-0.956940,
--0.995185,
-0.995185,
--0.956940,
-0.881921,
--0.773011,
-0.634394,
--0.471395,
-0.290284,
--0.098017,
--0.098017,
-0.290284,
--0.471398,
-0.634394,
--0.773011,
-0.881921,
--0.956941,
-0.995185,
--0.995185,
-0.956940,
--0.881921,
-0.773011,
--0.634394,
-0.471399,
--0.290288,
-0.098021,
-0.098020,
--0.290287,
-0.471398,
--0.634394,
-0.773011,
--0.881921,
-0.956940,
--0.995185,
-0.995185,
--0.956941,
-0.881920,
--0.773009,
-0.634398,
--0.471395,
-0.290291,
--0.098017,
--0.098024,
-0.290283,
--0.471402,
-0.634391,
--0.773013,
-0.881919,
--0.956941,
-0.995184,
--0.995185,
-0.956942,
--0.881921,
-0.773006,
--0.634395,
-0.471392,
--0.290288,
-0.098013,
-0.098013,
--0.290287,
-0.471391,
--0.634394,
-0.773006,
--0.881921,
-0.956942,
--0.995185,
-0.995184,
--0.956941,
-0.881920,
--0.773014,
-0.634392,
--0.471402,
-0.290284,
--0.098010,
--0.098016,
-0.290290,
--0.471395,
-0.634397,
--0.773008,
-0.881923,
--0.956939,
-0.995185,
--0.995185,
-0.956945,
--0.881918,
-0.773011,
--0.634401,
-0.471386,
--0.290281,
-0.098021,
-0.098005,
--0.290294,
-0.471398,
--0.634388,
-0.773020,
--0.881924,
-0.956940,
--0.995184,
-0.995184,
--0.956939,
-0.881923,
--0.773019,
-0.634386,
--0.471396,
-0.290292,
--0.098002,
--0.098024,
-0.290283,
--0.471388,
-0.634402,
--0.773013,
-0.881919,
--0.956937,
-0.995186,
--0.995185,
-0.956943,
--0.881914,
-0.773007,
--0.634395,
-0.471406,
--0.290274,
-0.098014,
-0.085797,
--0.254865,
-0.416429,
--0.565732,
-0.698376,
--0.810457,
-0.898675,
--0.960430,
-0.993907,
--0.998118,
-0.972940,
--0.919114,
-0.838224,
--0.732654,
-0.605511,
--0.460539,
-0.302008,
--0.134579,
--0.036808,
-0.207111,
--0.371316,
-0.524588,
--0.662414,
-0.780735,
--0.876072,
-0.945608,
--0.987302,
-0.999925,
--0.983105,
-0.937339,
--0.863973,
-0.765169,
--0.643834,
-0.503542,
--0.348416,
-0.183038,
--0.012270,
--0.158859,
-0.325310,
--0.482183,
-0.624858,
--0.749135,
-0.851354,
--0.928505,
-0.978316,
--0.999322,
-0.990903,
--0.953308,
-0.887636,
--0.795833,
-0.680597,
--0.545321,
-0.393988,
--0.231055,
-0.061318,
-0.110224,
--0.278521,
-0.438616,
--0.585797,
-0.715730,
--0.824588,
-0.909167,
--0.966976,
-0.996312,
--0.996313,
-0.966978,
--0.909171,
-0.824585,
--0.715726,
-0.585793,
--0.438612,
-0.278515,
--0.110219,
--0.061324,
-0.231060,
--0.393993,
-0.545325,
--0.680601,
-0.795836,
--0.887639,
-0.953305,
--0.990902,
-0.999323,
--0.978318,
-0.928508,
--0.851359,
-0.749141,
--0.624866,
-0.482192,
--0.325320,
-0.158869,
-0.012260,
--0.183028,
-0.348406,
--0.503526,
-0.643820,
--0.765177,
-0.863980,
--0.937344,
-0.983108,
--0.999925,
-0.987300,
--0.945604,
-0.876065,
--0.780732,
-0.662410,
--0.524584,
-0.371311,
--0.207106,
-0.036802,
-0.134585,
--0.302009,
-0.460541,
--0.605512,
-0.732655,
--0.838225,
-0.919114,
--0.972940,
-0.998118,
--0.993907,
-0.960432,
--0.898677,
-0.810460,
--0.698381,
-0.565738,
--0.416437,
-0.254874,
--0.085807,
-0.073565,
--0.219101,
-0.359895,
--0.492898,
-0.615232,
--0.724246,
-0.817585,
--0.893224,
-0.949528,
--0.985278,
-0.999699,
--0.992479,
-0.963776,
--0.914210,
-0.844854,
--0.757208,
-0.653172,
--0.534997,
-0.405242,
--0.266714,
-0.122409,
-0.024542,
--0.170962,
-0.313681,
--0.449610,
-0.575806,
--0.689538,
-0.788348,
--0.870088,
-0.932993,
--0.975702,
-0.997290,
--0.997291,
-0.975703,
--0.932994,
-0.870085,
--0.788345,
-0.689539,
--0.575807,
-0.449611,
--0.313682,
-0.170963,
--0.024544,
--0.122415,
-0.266709,
--0.405244,
-0.534993,
--0.653174,
-0.757204,
--0.844853,
-0.914212,
--0.963775,
-0.992480,
--0.999699,
-0.985277,
--0.949530,
-0.893224,
--0.817589,
-0.724248,
--0.615227,
-0.492900,
--0.359891,
-0.219105,
--0.073562,
--0.073559,
-0.219102,
--0.359902,
-0.492897,
--0.615236,
-0.724245,
--0.817587,
-0.893222,
--0.949529,
-0.985277,
--0.999699,
-0.992479,
--0.963776,
-0.914207,
--0.844855,
-0.757206,
--0.653176,
-0.534996,
--0.405247,
-0.266712,
--0.122403,
--0.024540,
-0.170967,
--0.313693,
-0.449601,
--0.575804,
-0.689542,
--0.788352,
-0.870080,
--0.932990,
-0.975702,
--0.997291,
-0.997290,
--0.975705,
-0.932995,
--0.870086,
-0.788341,
--0.689551,
-0.575815,
--0.449613,
-0.313677,
--0.170950,
-0.024553,
-0.122406,
--0.266715,
-0.405249,
--0.534985,
-0.653167,
--0.757208,
-0.844856,
--0.914215,
-0.963773,
--0.992479,
-0.999699,
--0.985276,
-0.949523,
--0.893228,
-0.817586,
--0.724244,
-0.615222,
--0.492909,
-0.359900,
--0.219100,
-0.073556,
-0.061321,
--0.183040,
-0.302006,
--0.416429,
-0.524589,
--0.624860,
-0.715731,
--0.795837,
-0.863973,
--0.919114,
-0.960430,
--0.987302,
-0.999322,
--0.996313,
-0.978317,
--0.945607,
-0.898675,
--0.838225,
-0.765166,
--0.680600,
-0.585798,
--0.482181,
-0.371315,
--0.254865,
-0.134581,
--0.012272,
--0.110220,
-0.231055,
--0.348415,
-0.460541,
--0.565734,
-0.662417,
--0.749137,
-0.824589,
--0.887639,
-0.937338,
--0.972939,
-0.993907,
--0.999925,
-0.990902,
--0.966976,
-0.928506,
--0.876071,
-0.810459,
--0.732657,
-0.643835,
--0.545329,
-0.438622,
--0.325317,
-0.207104,
--0.085791,
--0.036813,
-0.158863,
--0.278523,
-0.393994,
--0.503540,
-0.605512,
--0.698376,
-0.780737,
--0.851354,
-0.909167,
--0.953305,
-0.983105,
--0.998118,
-0.998119,
--0.983107,
-0.953304,
--0.909166,
-0.851353,
--0.780735,
-0.698374,
--0.605509,
-0.503537,
--0.393992,
-0.278520,
--0.158860,
-0.036810,
-0.085794,
--0.207107,
-0.325305,
--0.438611,
-0.545319,
--0.643837,
-0.732658,
--0.810460,
-0.876072,
--0.928502,
-0.966977,
--0.990901,
-0.999925,
--0.993905,
-0.972940,
--0.937334,
-0.887641,
--0.824583,
-0.749140,
--0.662409,
-0.565737,
--0.460532,
-0.348427,
--0.231053,
-0.110233,
-0.012275,
--0.134568,
-0.254867,
--0.371304,
-0.482184,
--0.585809,
-0.680600,
--0.765175,
-0.838223,
--0.898679,
-0.945605,
--0.978319,
-0.996312,
--0.999322,
-0.987303,
--0.960429,
-0.919118,
--0.863971,
-0.795845,
--0.715730,
-0.624871,
--0.524590,
-0.416417,
--0.302008,
-0.183028,
--0.061325,
-0.049068,
--0.146730,
-0.242980,
--0.336890,
-0.427555,
--0.514103,
-0.595699,
--0.671559,
-0.740951,
--0.803208,
-0.857729,
--0.903989,
-0.941544,
--0.970032,
-0.989177,
--0.998795,
-0.998796,
--0.989176,
-0.970031,
--0.941544,
-0.903990,
--0.857730,
-0.803210,
--0.740949,
-0.671557,
--0.595698,
-0.514103,
--0.427556,
-0.336892,
--0.242983,
-0.146727,
--0.049065,
--0.049069,
-0.146731,
--0.242980,
-0.336889,
--0.427553,
-0.514100,
--0.595702,
-0.671561,
--0.740952,
-0.803208,
--0.857728,
-0.903992,
--0.941543,
-0.970032,
--0.989176,
-0.998796,
--0.998796,
-0.989177,
--0.970030,
-0.941545,
--0.903987,
-0.857731,
--0.803206,
-0.740955,
--0.671558,
-0.595693,
--0.514104,
-0.427550,
--0.336893,
-0.242977,
--0.146736,
-0.049066,
-0.049060,
--0.146730,
-0.242986,
--0.336887,
-0.427559,
--0.514099,
-0.595701,
--0.671554,
-0.740951,
--0.803211,
-0.857728,
--0.903991,
-0.941543,
--0.970032,
-0.989176,
--0.998795,
-0.998795,
--0.989177,
-0.970030,
--0.941545,
-0.903994,
--0.857724,
-0.803207,
--0.740956,
-0.671548,
--0.595695,
-0.514105,
--0.427565,
-0.336880,
--0.242978,
-0.146737,
--0.049053,
--0.049074,
-0.146728,
--0.242970,
-0.336900,
--0.427557,
-0.514097,
--0.595687,
-0.671564,
--0.740950,
-0.803201,
--0.857735,
-0.903991,
--0.941542,
-0.970028,
--0.989178,
-0.998795,
--0.998796,
-0.989175,
--0.970030,
-0.941546,
--0.903995,
-0.857724,
--0.803208,
-0.740957,
--0.671549,
-0.595696,
--0.514107,
-0.427567,
--0.336881,
-0.242980,
--0.146739,
-0.049054,
-0.036807,
--0.110222,
-0.183040,
--0.254866,
-0.325310,
--0.393992,
-0.460539,
--0.524589,
-0.585798,
--0.643831,
-0.698376,
--0.749136,
-0.795838,
--0.838225,
-0.876070,
--0.909167,
-0.937340,
--0.960431,
-0.978317,
--0.990902,
-0.998118,
--0.999925,
-0.996313,
--0.987302,
-0.972941,
--0.953305,
-0.928505,
--0.898674,
-0.863973,
--0.824590,
-0.780739,
--0.732656,
-0.680599,
--0.624858,
-0.565731,
--0.503538,
-0.438617,
--0.371319,
-0.302009,
--0.231055,
-0.158856,
--0.085796,
-0.012271,
-0.061320,
--0.134579,
-0.207108,
--0.278516,
-0.348414,
--0.416424,
-0.482177,
--0.545331,
-0.605516,
--0.662419,
-0.715733,
--0.765169,
-0.810458,
--0.851355,
-0.887639,
--0.919113,
-0.945606,
--0.966976,
-0.983105,
--0.993906,
-0.999322,
--0.999322,
-0.993906,
--0.983105,
-0.966975,
--0.945606,
-0.919113,
--0.887639,
-0.851355,
--0.810458,
-0.765169,
--0.715733,
-0.662419,
--0.605516,
-0.545331,
--0.482177,
-0.416424,
--0.348414,
-0.278516,
--0.207108,
-0.134594,
--0.061335,
--0.012256,
-0.085811,
--0.158871,
-0.231070,
--0.302016,
-0.371326,
--0.438624,
-0.503545,
--0.565737,
-0.624864,
--0.680604,
-0.732657,
--0.780739,
-0.824590,
--0.863973,
-0.898674,
--0.928505,
-0.953305,
--0.972939,
-0.987301,
--0.996312,
-0.999925,
--0.998119,
-0.990904,
--0.978320,
-0.960434,
--0.937343,
-0.909174,
--0.876077,
-0.838217,
--0.795829,
-0.749128,
--0.698368,
-0.643824,
--0.585790,
-0.524583,
--0.460532,
-0.393986,
--0.325305,
-0.254862,
--0.183037,
-0.110220,
--0.036806,
-0.024541,
--0.073565,
-0.122411,
--0.170962,
-0.219101,
--0.266712,
-0.313682,
--0.359894,
-0.405241,
--0.449612,
-0.492898,
--0.534996,
-0.575809,
--0.615231,
-0.653172,
--0.689542,
-0.724247,
--0.757208,
-0.788348,
--0.817585,
-0.844853,
--0.870088,
-0.893225,
--0.914210,
-0.932992,
--0.949527,
-0.963775,
--0.975703,
-0.985278,
--0.992480,
-0.997290,
--0.999699,
-0.999699,
--0.997290,
-0.992479,
--0.985277,
-0.975702,
--0.963776,
-0.949529,
--0.932994,
-0.914208,
--0.893227,
-0.870086,
--0.844849,
-0.817585,
--0.788343,
-0.757211,
--0.724245,
-0.689545,
--0.653172,
-0.615226,
--0.575809,
-0.534993,
--0.492901,
-0.449609,
--0.405247,
-0.359895,
--0.313675,
-0.266715,
--0.219097,
-0.170966,
--0.122408,
-0.073571,
--0.024541,
--0.024548,
-0.073562,
--0.122415,
-0.170957,
--0.219103,
-0.266706,
--0.313681,
-0.359901,
--0.405239,
-0.449615,
--0.492894,
-0.534999,
--0.575802,
-0.615231,
--0.653177,
-0.689538,
--0.724250,
-0.757205,
--0.788347,
-0.817589,
--0.844861,
-0.870082,
--0.893223,
-0.914211,
--0.932996,
-0.949524,
--0.963774,
-0.975702,
--0.985279,
-0.992481,
--0.997290,
-0.999699,
--0.999699,
-0.997290,
--0.992478,
-0.985279,
--0.975703,
-0.963775,
--0.949525,
-0.932998,
--0.914213,
-0.893225,
--0.870085,
-0.844848,
--0.817592,
-0.788350,
--0.757209,
-0.724243,
--0.689531,
-0.653181,
--0.615235,
-0.575807,
--0.534991,
-0.492885,
--0.449620,
-0.405244,
--0.359892,
-0.313672,
--0.266726,
-0.219108,
--0.170963,
-0.122405,
--0.073552,
-0.024553,
-0.012272,
--0.036807,
-0.061321,
--0.085797,
-0.110222,
--0.134580,
-0.158858,
--0.183040,
-0.207111,
--0.231058,
-0.254864,
--0.278521,
-0.302006,
--0.325309,
-0.348420,
--0.371317,
-0.393991,
--0.416431,
-0.438617,
--0.460538,
-0.482185,
--0.503536,
-0.524592,
--0.545327,
-0.565733,
--0.585798,
-0.605510,
--0.624857,
-0.643834,
--0.662418,
-0.680602,
--0.698376,
-0.715730,
--0.732653,
-0.749134,
--0.765169,
-0.780738,
--0.795837,
-0.810457,
--0.824588,
-0.838223,
--0.851357,
-0.863974,
--0.876070,
-0.887639,
--0.898674,
-0.909167,
--0.919112,
-0.928504,
--0.937337,
-0.945610,
--0.953308,
-0.960432,
--0.966977,
-0.972941,
--0.978318,
-0.983106,
--0.987301,
-0.990902,
--0.993907,
-0.996312,
--0.998118,
-0.999322,
--0.999925,
-0.999925,
--0.999322,
-0.998118,
--0.996312,
-0.993907,
--0.990903,
-0.987302,
--0.983106,
-0.978318,
--0.972941,
-0.966978,
--0.960433,
-0.953304,
--0.945606,
-0.937338,
--0.928505,
-0.919113,
--0.909168,
-0.898668,
--0.887640,
-0.876064,
--0.863975,
-0.851350,
--0.838228,
-0.824585,
--0.810463,
-0.795834,
--0.780744,
-0.765166,
--0.749146,
-0.732654,
--0.715721,
-0.698378,
--0.680592,
-0.662419,
--0.643824,
-0.624865,
--0.605506,
-0.585806,
--0.565728,
-0.545335,
--0.524588,
-0.503551,
--0.482184,
-0.460527,
--0.438619,
-0.416419,
--0.393997,
-0.371309,
--0.348426,
-0.325304,
--0.302016,
-0.278516,
--0.254878,
-0.231057,
--0.207126,
-0.183041,
--0.158845,
-0.134584,
--0.110211,
-0.085803,
--0.061312,
-0.036815,
--0.012266
+0.989176
 };
@@ -34,11 +34,12 @@
 #include <audio_features.h>
 #include <imu_features.h>
 #include <welch_psd.h>
+#include <mfcc_stream.h>
 
 
 void fft_based_features(const int8_t *features_selector, const float *sig, int16_t len, int16_t fs, float *feats);
 void periodogram_based_features(const int8_t *features_selector, const float *sig, int16_t len, int16_t fs, float *feats);
-void mfcc_features(const int8_t *features_selector, const float *sig, int16_t len, float *feats);
+void mfcc_features(const int8_t *features_selector, mfcc_stream_t *stream, int32_t position, const float *sig, int16_t len, float *feats);
 void mean_based_features(const int8_t *features_selector, const float *sig, int16_t len, float *feats);
 
 void imu_signal_features(const int8_t *features_selector, const float *sig, int16_t len, float *feats);
@@ -186,9 +187,10 @@ void periodogram_based_features(const int8_t *features_selector, const float *si
 
 
 /*
-    Computes the required MFCC features of the audio signal
+    Computes the required MFCC features of the audio signal.
+    With a stream, the window at position reuses the frames of the previous windows (mfcc_stream.h)
 */
-void mfcc_features(const int8_t *features_selector, const float *sig, int16_t len, float *feats){
+void mfcc_features(const int8_t *features_selector, mfcc_stream_t *stream, int32_t position, const float *sig, int16_t len, float *feats){
 
     // 13 : 38 for the MFCCs features
     if(is_required(features_selector, MEL_FREQUENCY_CEPSTRAL_COEFFICIENT, MEL_FREQUENCY_CEPSTRAL_COEFFICIENT + (N_MFCC * 2) - 1)){
@@ -196,7 +198,9 @@ void mfcc_features(const int8_t *features_selector, const float *sig, int16_t le
 
         float *mean_mfcc = (float*)malloc(N_MFCC * sizeof(float));
         float *std_mfcc = (float*)malloc(N_MFCC * sizeof(float));
-        get_mfcc_features(sig, len, mean_mfcc, std_mfcc);
+        if(stream == NULL || get_mfcc_features_stream(stream, position, sig, len, mean_mfcc, std_mfcc) == 0){
+            get_mfcc_features(sig, len, mean_mfcc, std_mfcc);
+        }
 
         // stores first the mean and then the std, one after the other
         for(int16_t i=0; i<N_MFCC; i++){
@@ -286,6 +290,17 @@ void eepd_features(const int8_t *features_selector, const float *sig, int16_t le
 */
 void audio_features(const int8_t *features_selector, const float *sig, int16_t len, int16_t fs, float *feats){
 
+    audio_features_stream(features_selector, NULL, 0, sig, len, fs, feats);
+}
+
+
+/*
+    Same as audio_features for the window that starts at sample position of an audio stream:
+    the MFCCs reuse the STFT frames that the previous windows of the stream share with it.
+    stream can be NULL, then the MFCCs are computed only from the window
+*/
+void audio_features_stream(const int8_t *features_selector, mfcc_stream_t *stream, int32_t position, const float *sig, int16_t len, int16_t fs, float *feats){
+
     /* FFT based features */
     fft_based_features(features_selector, sig, len, fs, feats);
 
@@ -293,7 +308,7 @@ void audio_features(const int8_t *features_selector, const float *sig, int16_t l
     periodogram_based_features(features_selector, sig, len, fs, feats);
 
     /* MFCCs features */
-    mfcc_features(features_selector, sig, len, feats);
+    mfcc_features(features_selector, stream, position, sig, len, feats);
 
     /* Mean-based features */
     mean_based_features(features_selector, sig, len, feats);
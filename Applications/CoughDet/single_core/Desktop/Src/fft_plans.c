@@ -0,0 +1,107 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Author:          Stefano Albini                  //
+// Contributions:   Dimitrios Samakovlis            //
+// Date:            September 2023                  //
+//////////////////////////////////////////////////////
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fft_plans.h>
+#include <welch_psd.h>
+#include <mfcc_module.h>
+
+
+static kiss_fftr_cfg plans[FFT_PLANS_MAX];
+static int16_t plan_sizes[FFT_PLANS_MAX];
+static int8_t n_plans = 0;
+
+
+/*
+    Allocates the plans of the RFFT of the audio windows (audio_len samples), of the Welch
+    segments and of the STFT frames. Returns 1 if all of them are available, 0 otherwise
+*/
+int8_t fft_plans_init(int16_t audio_len){
+
+    return fft_plan_get(audio_len) != NULL && fft_plan_get(NPERSEG) != NULL && fft_plan_get(N_FFT) != NULL;
+}
+
+
+/*
+    Returns the plan of size nfft. A size that was not initialized is allocated on its
+    first use and then kept. Returns NULL if the size is not supported or the cache is full
+*/
+kiss_fftr_cfg fft_plan_get(int16_t nfft){
+
+    for(int8_t i=0; i<n_plans; i++){
+        if(plan_sizes[i] == nfft){
+            return plans[i];
+        }
+    }
+
+    if(n_plans == FFT_PLANS_MAX){
+        printf("FFT plans cache full!\n");
+        return NULL;
+    }
+
+    kiss_fftr_cfg cfg = kiss_fftr_alloc(nfft, 0, 0, 0);
+    if(cfg != NULL){
+        plans[n_plans] = cfg;
+        plan_sizes[n_plans] = nfft;
+        n_plans++;
+    }
+    return cfg;
+}
+
+
+void fft_plans_free(void){
+
+    for(int8_t i=0; i<n_plans; i++){
+        kiss_fftr_free(plans[i]);
+    }
+    n_plans = 0;
+}
+
+
+/*
+    Computes the RFFT of the nfft samples of in (nfft/2 + 1 outputs).
+    The plan comes from the cache; when the cache is full, a plan is allocated and freed here.
+    If the size is not supported, the output is set to 0
+*/
+void fft_rfft(int16_t nfft, const float *in, kiss_fft_cpx *out){
+
+    kiss_fftr_cfg cfg = fft_plan_get(nfft);
+    if(cfg != NULL){
+        kiss_fftr(cfg, in, out);
+        return;
+    }
+
+    cfg = kiss_fftr_alloc(nfft, 0, 0, 0);
+    if(cfg == NULL){
+        printf("RFFT of size %d not supported!\n", nfft);
+        memset(out, 0, ((nfft / 2) + 1) * sizeof(kiss_fft_cpx));
+        return;
+    }
+    kiss_fftr(cfg, in, out);
+    kiss_fftr_free(cfg);
+}
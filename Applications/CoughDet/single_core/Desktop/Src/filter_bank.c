@@ -0,0 +1,194 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Author:          Stefano Albini                  //
+// Contributions:   Dimitrios Samakovlis            //
+// Date:            September 2023                  //
+//////////////////////////////////////////////////////
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <filter_bank.h>
+#include <filters_parameters.h>
+#include <audio_features.h>
+#include <helpers.h>
+
+
+// Coefficients of one filter for each lane: the lanes after N_EEPD have all zero coefficients
+typedef struct bank_filter {
+    float b[3][FILTER_BANK_LANES];
+    float a[3][FILTER_BANK_LANES];
+    float zi[2][FILTER_BANK_LANES];
+} bank_filter_t;
+
+static bank_filter_t band_filters;          // bandpass filter of each band
+static bank_filter_t envelope_filter;       // second filter, the same for every band
+
+static float *work = NULL;      // padded signals of all the bands, sample after sample
+static float *pad = NULL;       // padded input signal
+static int16_t work_len = 0;    // window length the workspace is allocated for
+
+
+/*
+    Allocates the workspace for windows of len samples and sets the coefficients of the lanes.
+    Returns 1 if the workspace is available, 0 otherwise
+*/
+int8_t filter_bank_init(int16_t len){
+
+    if(work != NULL && work_len >= len){
+        return 1;
+    }
+    filter_bank_free();
+
+    int padded_len = (2 * PADLEN) + len;
+    work = (float*)malloc((padded_len * FILTER_BANK_LANES) * sizeof(float));
+    pad = (float*)malloc(padded_len * sizeof(float));
+    if(work == NULL || pad == NULL){
+        printf("Filter bank workspace allocation failed!\n");
+        filter_bank_free();
+        return 0;
+    }
+    work_len = len;
+
+    memset(&band_filters, 0, sizeof(band_filters));
+    for(int16_t l=0; l<FILTER_BANK_LANES; l++){
+        for(int16_t k=0; k<3; k++){
+            if(l < N_EEPD){
+                band_filters.b[k][l] = filters_parameters.filters[l].b[k];
+                band_filters.a[k][l] = filters_parameters.filters[l].a[k];
+            }
+            envelope_filter.b[k][l] = b_second[k];
+            envelope_filter.a[k][l] = a_second[k];
+        }
+        for(int16_t k=0; k<2; k++){
+            if(l < N_EEPD){
+                band_filters.zi[k][l] = filters_parameters.filters[l].zi[k];
+            }
+            envelope_filter.zi[k][l] = zi_second[k];
+        }
+    }
+    return 1;
+}
+
+
+void filter_bank_free(void){
+
+    free(work);
+    free(pad);
+    work = NULL;
+    pad = NULL;
+    work_len = 0;
+}
+
+
+/*
+    Applies the filter of each lane to the n_samples padded signals of the workspace, in place.
+    The filter runs forward (dir = 1) or backward (dir = -1), starting from the state zi
+    scaled by the first sample it meets, like linear_filer called by filtfilt
+*/
+static void bank_linear_filter(float *w, int n_samples, int dir, const bank_filter_t *f){
+
+    float sig_1[FILTER_BANK_LANES], y_1[FILTER_BANK_LANES];
+    float s_1[FILTER_BANK_LANES], s_2[FILTER_BANK_LANES];
+
+    float *row = (dir > 0) ? w : &w[(n_samples - 1) * FILTER_BANK_LANES];
+    int step = dir * FILTER_BANK_LANES;
+
+    for(int16_t l=0; l<FILTER_BANK_LANES; l++){
+        s_1[l] = f->zi[0][l] * row[l];
+        s_2[l] = f->zi[1][l] * row[l];
+        sig_1[l] = row[l];
+        row[l] = f->b[0][l] * row[l] + s_1[l];
+        y_1[l] = row[l];
+    }
+
+    for(int i=1; i<n_samples; i++){
+        row += step;
+        for(int16_t l=0; l<FILTER_BANK_LANES; l++){
+            float x = row[l];
+            s_1[l] = f->b[1][l] * sig_1[l] - f->a[1][l] * y_1[l] + s_2[l];
+            float y = f->b[0][l] * x + s_1[l];
+            s_2[l] = f->b[2][l] * sig_1[l] - f->a[2][l] * y_1[l];
+
+            sig_1[l] = x;
+            y_1[l] = y;
+            row[l] = y;
+        }
+    }
+}
+
+
+/*
+    Rebuilds the padding of each lane around its len central samples, like padding()
+*/
+static void bank_padding(float *w, int16_t len){
+
+    float *left = &w[PADLEN * FILTER_BANK_LANES];
+    float *right = &w[(PADLEN + len - 1) * FILTER_BANK_LANES];
+
+    for(int16_t i=0; i<PADLEN; i++){
+        for(int16_t l=0; l<FILTER_BANK_LANES; l++){
+            w[(i * FILTER_BANK_LANES) + l] = (2 * left[l]) - left[((PADLEN - i) * FILTER_BANK_LANES) + l];
+            right[((i + 1) * FILTER_BANK_LANES) + l] = (2 * right[l]) - right[(-(i + 1) * FILTER_BANK_LANES) + l];
+        }
+    }
+}
+
+
+/*
+    Computes the energy envelopes of all the EEPD bands of sig: each band is bandpass
+    filtered with filtfilt, squared, and filtered with filtfilt by the envelope filter.
+    Returns the envelopes stored sample after sample: the sample i of band b is at
+    (i * FILTER_BANK_LANES) + b. They are valid until the next call.
+*/
+const float *filter_bank_eepd(const float *sig, int16_t len){
+
+    if(filter_bank_init(len) == 0){
+        return NULL;
+    }
+
+    int padded_len = (2 * PADLEN) + len;
+    float *env = &work[PADLEN * FILTER_BANK_LANES];
+
+    // the padded signal is the input of every band
+    padding(sig, len, PADLEN, pad);
+    for(int i=0; i<padded_len; i++){
+        for(int16_t l=0; l<FILTER_BANK_LANES; l++){
+            work[(i * FILTER_BANK_LANES) + l] = pad[i];
+        }
+    }
+
+    // BANDPASS FILTERS //
+    bank_linear_filter(work, padded_len, 1, &band_filters);
+    bank_linear_filter(work, padded_len, -1, &band_filters);
+
+    // SQUARE AND PAD AGAIN //
+    for(int i=0; i<(len * FILTER_BANK_LANES); i++){
+        env[i] = env[i] * env[i];
+    }
+    bank_padding(work, len);
+
+    // ENVELOPE FILTER //
+    bank_linear_filter(work, padded_len, 1, &envelope_filter);
+    bank_linear_filter(work, padded_len, -1, &envelope_filter);
+
+    return env;
+}
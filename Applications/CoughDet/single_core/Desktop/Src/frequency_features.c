@@ -39,10 +39,11 @@
 #include <audio_features.h>
 
 #include <kiss_fftr.h>
+#include <fft_plans.h>
 
 
 // Helper function for the RFFT
-void _rfft(const float *sig, int16_t len, float *real, float *imag);
+void _rfft(const float *sig, int16_t len, kiss_fft_cpx *out);
 
 
 /*
@@ -53,14 +54,13 @@ void _rfft(const float *sig, int16_t len, float *real, float *imag);
 */
 void compute_rfft(const float *sig, int16_t len, int16_t fs, float *mags, float *freqs, float *sum_mags){
 
-    float *re = (float*)malloc(len * sizeof(float));
-    float *im = (float*)malloc(len * sizeof(float));
+    kiss_fft_cpx *cx_out = (kiss_fft_cpx*)malloc(((len/2)+1) * sizeof(kiss_fft_cpx));
 
-    _rfft(sig, len, re, im);
+    _rfft(sig, len, cx_out);
 
     // Compute the magnitude of each FFT output
     for(int16_t i=0; i<(len/2)+1 ; i++){
-        mags[i] = sqrtf((re[i] * re[i]) + (im[i] * im[i]));
+        mags[i] = sqrtf((cx_out[i].r * cx_out[i].r) + (cx_out[i].i * cx_out[i].i));
         *sum_mags += mags[i];
     }
 
@@ -69,30 +69,18 @@ void compute_rfft(const float *sig, int16_t len, int16_t fs, float *mags, float
         freqs[i] = (float)(i * fs) / len;
     }
 
-    free(re);
-    free(im);
+    free(cx_out);
 }
 
 
 /*
     Helper function not callable externally.
-    This just computes the RFFT of the input signal and 
-    stores the Real and Imaginary parts in two separate arrays
+    This just computes the RFFT of the input signal, with the cached plan of its length,
+    and stores the (len/2)+1 complex outputs in out
 */
-void _rfft(const float *sig, int16_t len, float *real, float *imag){
-
-    kiss_fftr_cfg cfg = kiss_fftr_alloc(len, 0, 0, 0);
-    kiss_fft_cpx *cx_out = (kiss_fft_cpx *) malloc(len * sizeof(kiss_fft_cpx));
-
-    kiss_fftr(cfg, sig, cx_out);
-
-    for(int16_t i=0; i<len; i++){
-        real[i] = cx_out[i].r;
-        imag[i] = cx_out[i].i;
-    }
+void _rfft(const float *sig, int16_t len, kiss_fft_cpx *out){
 
-    free(cfg);
-    free(cx_out);
+    fft_rfft(len, sig, out);
 }
 
 
@@ -106,9 +94,8 @@ void compute_periodogram(const float *sig, int16_t len, int16_t fs, float *psd,
     float *cumul_sums = (float*)malloc(NPERSEG * sizeof(float));  // To store the cumulative sum of the FFT of each frequency bin
     memset(cumul_sums, 0, NPERSEG * sizeof(float));
 
-    // To store the real and imaginary parts of each FFT
-    float *re = (float*)malloc(NPERSEG * sizeof(float));
-    float *im = (float*)malloc(NPERSEG * sizeof(float));
+    // To store the output of each FFT
+    kiss_fft_cpx *cx_out = (kiss_fft_cpx*)malloc(((NPERSEG/2)+1) * sizeof(kiss_fft_cpx));
 
     // To store the magnitudes squared after the FFT
     float *mags_squared = (float*)malloc(((NPERSEG/2)+1) * sizeof(float));
@@ -143,10 +130,10 @@ void compute_periodogram(const float *sig, int16_t len, int16_t fs, float *psd,
         }  
 
 
-        _rfft(win, NPERSEG, re, im);    // Actual Real FFT computation
+        _rfft(win, NPERSEG, cx_out);    // Actual Real FFT computation
 
         for(int16_t i=0; i<(NPERSEG/2)+1; i++){
-            mags_squared[i] = (re[i] * re[i]) + (im[i] * im[i]);
+            mags_squared[i] = (cx_out[i].r * cx_out[i].r) + (cx_out[i].i * cx_out[i].i);
             mags_squared[i] *= scale;
 
             if(i != 0 && i != (NPERSEG/2)){
@@ -167,8 +154,7 @@ void compute_periodogram(const float *sig, int16_t len, int16_t fs, float *psd,
 
     free(win);
     free(cumul_sums);
-    free(re);
-    free(im);
+    free(cx_out);
     free(mags_squared);
 }
 
@@ -406,7 +392,7 @@ void mfcc_computation(const float *x, int16_t len, int16_t n_frames, float *coef
     power_to_dB(db_power, (MEL_ROWS * n_frames), db_power);
 
     // Apply the DCT
-    dct_matrix(db_power, MEL_ROWS, n_frames, db_power);
+    dct_matrix(db_power, MEL_ROWS, n_frames, N_MFCC, db_power);
 
     for(int16_t i=0; i<N_MFCC; i++){
         for(int16_t j=0; j<n_frames; j++){
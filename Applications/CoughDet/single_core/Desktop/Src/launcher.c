@@ -34,6 +34,9 @@
 #include <imu_features.h>
 
 #include <randomForest.h>
+#include <fft_plans.h>
+#include <filter_bank.h>
+#include <mfcc_stream.h>
 
 /* This is for testing more different widnows of data */
 // #include <input_data/audio_input_55502.h>
@@ -64,6 +67,26 @@ void print_features(float *feats, int16_t len, int8_t *select);
 
 void launch(){
 
+    // Plans of all the FFT sizes, shared by the windows
+    if(fft_plans_init(WINDOW_SAMP_AUDIO) == 0){
+        printf("ERROR FFT PLANS INIT!\n");
+    }
+    // Workspace of the EEPD filter bank, shared by the windows
+    if(filter_bank_init(WINDOW_SAMP_AUDIO) == 0){
+        printf("ERROR FILTER BANK INIT!\n");
+    }
+#ifdef FLAT_RANDOM_FOREST
+    // Flat layout of the forest, predict_c is used if it cannot be built
+    int8_t flat_forest = rf_flat_init();
+    if(flat_forest == 0){
+        printf("ERROR FLAT RANDOM FOREST INIT!\n");
+    }
+#endif
+#ifdef STREAMING_MFCC
+    mfcc_stream_t *mfcc_stream = (mfcc_stream_t*)malloc(sizeof(mfcc_stream_t));
+    mfcc_stream_init(mfcc_stream);
+#endif
+
     // These two arrays contain the indexes of the features that are going to be extracted
     int8_t *indexes_audio_f = (int8_t*)malloc(N_AUDIO_FEAT_RF * sizeof(int8_t));
     int8_t *indexes_imu_f = (int8_t*)malloc(N_IMU_FEAT_RF * sizeof(int8_t));
@@ -108,7 +131,12 @@ void launch(){
     float *model_out = (float*)malloc(n_runs * sizeof(float));
 
     for(int16_t i=0; i<n_runs; i++){
+#ifdef STREAMING_MFCC
+        // the frames of the windows are found by their position in the audio
+        audio_features_stream(audio_features_selector, mfcc_stream, i*AUDIO_STEP, &audio_in.air[i*AUDIO_STEP], WINDOW_SAMP_AUDIO, AUDIO_FS, audio_feature_array);
+#else
         audio_features(audio_features_selector, &audio_in.air[i*AUDIO_STEP], WINDOW_SAMP_AUDIO, AUDIO_FS, audio_feature_array);
+#endif
         imu_features(imu_features_selector, &imu_in[i*IMU_STEP], WINDOW_SAMP_IMU, imu_feature_array);
 
         // Save all the features in the same array
@@ -129,7 +157,15 @@ void launch(){
         probs[0] = 0.0;
         probs[1] = 0.0;
 
+#ifdef FLAT_RANDOM_FOREST
+        if(flat_forest){
+            predict_c_flat(ensamble_feats, 1, probs);
+        } else {
+            predict_c(ensamble_feats, probs);
+        }
+#else
         predict_c(ensamble_feats, probs);
+#endif
 
         #ifdef PRINTING_ON
         printf("[%d]\t[%f\t%f]\n", i, probs[0], probs[1]);
@@ -149,4 +185,12 @@ void launch(){
     free(probs);
     free(model_out);
 
+#ifdef STREAMING_MFCC
+    free(mfcc_stream);
+#endif
+    fft_plans_free();
+    filter_bank_free();
+#ifdef FLAT_RANDOM_FOREST
+    rf_flat_free();
+#endif
 }
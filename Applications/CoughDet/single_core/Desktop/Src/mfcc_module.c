@@ -38,6 +38,7 @@
 #include <helpers.h>
 
 #include <kiss_fftr.h>
+#include <fft_plans.h>
 
 #include <dct_lin.h>
 
@@ -46,7 +47,7 @@
 void _cmplx_mag(kiss_fft_cpx *x, int16_t len, float *res);
 
 // internal use function to compute the dct on a linear array
-void _dct_linear(const float *x, int16_t len, float *y);
+void _dct_linear(const float *x, int16_t len, int16_t n_coeffs, float *y);
 
 /*
     Computes the complex magnitude of the input RFFT result and put
@@ -58,6 +59,24 @@ void _cmplx_mag(kiss_fft_cpx *x, int16_t len, float *res){
     }
 }
 
+/*
+    Computes the power spectrum (FFT_RES_LEN bins) of the N_FFT samples of frame,
+    after the hann window, into column. cx_out holds the FFT_RES_LEN RFFT outputs
+*/
+void stft_column(const float *frame, float *column, kiss_fft_cpx *cx_out){
+
+    for(int16_t j=0; j<N_FFT; j++){
+        column[j] = frame[j];
+    }
+
+    // apply the window
+    vect_mult(column, hann_mfcc_wind, N_FFT, column);
+
+    fft_rfft(N_FFT, column, cx_out);
+    _cmplx_mag(cx_out, FFT_RES_LEN, column);
+    vect_mult(column, column, FFT_RES_LEN, column); // element-wise power of 2
+}
+
 /*
     Computes the power of the signal using the STFT method.
 
@@ -73,11 +92,9 @@ void stft(const float *x, int16_t len, int16_t n_frames, float *res){
     zero_padding(x, len, PAD_LEN, padded);
 
     float *column = (float*)malloc(N_FFT * sizeof(float));
-    float *fft_res = (float*)malloc(FFT_RES_LEN * sizeof(float));
 
-    // initialize RFFT structures
-    kiss_fftr_cfg cfg = kiss_fftr_alloc(N_FFT, 0, 0, 0);
-    kiss_fft_cpx *cx_out = (kiss_fft_cpx*)malloc(N_FFT *sizeof(kiss_fft_cpx));
+    // RFFT output (the plan is the cached one)
+    kiss_fft_cpx *cx_out = (kiss_fft_cpx*)malloc(FFT_RES_LEN *sizeof(kiss_fft_cpx));
 
     for(int16_t i=0; i<n_frames; i++){
 
@@ -85,16 +102,7 @@ void stft(const float *x, int16_t len, int16_t n_frames, float *res){
         // Basically the framing is considered to produce a matrix, each
         // column is a frame to process. It's done like this in order to
         // be compliant with the python code
-        for(int16_t j=0; j<N_FFT; j++){
-            column[j] = padded[j + (i*HOP_LEN)];
-        }
-
-        // apply the window
-        vect_mult(column, hann_mfcc_wind, N_FFT, column);
-
-        kiss_fftr(cfg, column, cx_out);
-        _cmplx_mag(cx_out, FFT_RES_LEN, column);
-        vect_mult(column, column, FFT_RES_LEN, column); // element-wise power of 2
+        stft_column(&padded[i*HOP_LEN], column, cx_out);
         
         // stores the current column result into the result array
         // Note that the each column is stored sequentially
@@ -106,11 +114,40 @@ void stft(const float *x, int16_t len, int16_t n_frames, float *res){
 
     }
 
-    free(cfg);
     free(cx_out);
     free(padded);
     free(column);
-    free(fft_res);
+}
+
+/*
+    Multiplies one power column of the STFT by the mel basis: mel has MEL_ROWS values
+    The basis is stored row by row with only its non zero band (mel_offsets / mel_values),
+    and each band is accumulated over MEL_LANES independent sums so the compiler can vectorize it
+*/
+void mel_column(const float *power, float *mel){
+
+    for(int16_t i=0; i<MEL_ROWS; i++){
+        const float *w = &mel_values[mel_offsets[i]];
+        const float *p = &power[mel_nz_indexes[i][0]];
+        int16_t n = mel_offsets[i + 1] - mel_offsets[i];
+
+        float acc[MEL_LANES] = {0.0};
+        int16_t k = 0;
+        for(; k + MEL_LANES <= n; k += MEL_LANES){
+            for(int16_t l=0; l<MEL_LANES; l++){
+                acc[l] += w[k + l] * p[k + l];
+            }
+        }
+        for(; k<n; k++){
+            acc[0] += w[k] * p[k];
+        }
+
+        float sum = 0.0;
+        for(int16_t l=0; l<MEL_LANES; l++){
+            sum += acc[l];
+        }
+        mel[i] = sum;
+    }
 }
 
 /*
@@ -124,16 +161,17 @@ void mel_spectrogram(const float *x, int16_t len, int16_t n_frames, float *res){
     stft(x, len, n_frames, frames_power);
 
     // MULT BY MEL BASIS (matrix multiplication)
-    // frames_power is saved one column after the other
+    // frames_power is saved one column after the other, so it is walked frame by frame
     // the result matrix is saved one row after the other
-    for(int16_t i=0; i<MEL_ROWS; i++){              // rows in the mel basis
-        for(int16_t j=0; j<n_frames; j++){          // columns for frames_powers and raws for mel_basis
-            for(int16_t k=mel_nz_indexes[i][0]; k<=mel_nz_indexes[i][1]; k++){   // columns in the mel basis
-                    res[(i*n_frames) + j] += mel_basis[i][k - mel_nz_indexes[i][0]] * frames_power[(j*MEL_COLUMNS) + k];
-            }
+    float *mel = (float*)malloc(MEL_ROWS * sizeof(float));
+    for(int16_t j=0; j<n_frames; j++){
+        mel_column(&frames_power[j*MEL_COLUMNS], mel);
+        for(int16_t i=0; i<MEL_ROWS; i++){
+            res[(i*n_frames) + j] = mel[i];
         }
     }
 
+    free(mel);
     free(frames_power);
 }
 
@@ -162,16 +200,17 @@ void power_to_dB(const float *x, int16_t len, float *res){
 }
 
 /*
-    Computes the DCT on a single dimentional array
+    Computes the first n_coeffs DCT coefficients of a single dimentional array
+    (n_coeffs <= DCT_N_COEFFS, the rows kept in dct_cos)
 */
-void _dct_linear(const float *x, int16_t len, float *y){
+void _dct_linear(const float *x, int16_t len, int16_t n_coeffs, float *y){
 
     float sum = 0.0;
     float scaling = sqrtf(1.0 / (2 * len));
 
     float cos_v = 0.0;
 
-    for(int16_t k=0; k<len; k++){
+    for(int16_t k=0; k<n_coeffs; k++){
         sum = 0.0;
         for(int16_t n=0; n<len; n++){
             cos_v = dct_cos[(len * k) + n];
@@ -189,16 +228,17 @@ void _dct_linear(const float *x, int16_t len, float *y){
 /*
     Computes the DCT (Discrete Cosine Transform) on the input matrix and 
     stores the result in the output matrix.
+    Only the first n_coeffs rows of the output are computed, the other ones are left untouched.
     
     Both input and output matrices are stored as 1D arrays.
     
     The matrix is stored on a row by row basis:
     x = [... ROW 0 ... | ... ROW 1 ... | ....]
 */
-void dct_matrix(const float *x, int16_t rows, int16_t cols, float *y){
+void dct_matrix(const float *x, int16_t rows, int16_t cols, int16_t n_coeffs, float *y){
 
     float *column = (float*)malloc(rows * sizeof(float));
-    float *c_res = (float*)malloc(rows * sizeof(float));
+    float *c_res = (float*)malloc(n_coeffs * sizeof(float));
 
     for(int16_t c=0; c<cols; c++){
         // fill the column array with the current column
@@ -206,10 +246,10 @@ void dct_matrix(const float *x, int16_t rows, int16_t cols, float *y){
             column[r] = x[(r*cols) + c];
         }
 
-        _dct_linear(column, rows, c_res);
+        _dct_linear(column, rows, n_coeffs, c_res);
 
         // copy the result on the output
-        for(int16_t r=0; r<rows; r++){
+        for(int16_t r=0; r<n_coeffs; r++){
             y[(r*cols) + c] = c_res[r];
         }
     }
@@ -0,0 +1,185 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Author:          Stefano Albini                  //
+// Contributions:   Dimitrios Samakovlis            //
+// Date:            September 2023                  //
+//////////////////////////////////////////////////////
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <mfcc_stream.h>
+#include <mfcc_module.h>
+#include <mel_basis.h>
+#include <audio_features.h>
+#include <helpers.h>
+
+
+/*
+    Empties the cache: to be called before the first window of a stream
+*/
+void mfcc_stream_init(mfcc_stream_t *stream){
+
+    for(int8_t i=0; i<MFCC_STREAM_FRAMES; i++){
+        stream->frames[i].start = -1;
+    }
+    stream->next_frame = 0;
+    stream->last_position = -1;
+}
+
+
+static mfcc_frame_t *find_frame(mfcc_stream_t *stream, int32_t start){
+
+    for(int8_t i=0; i<MFCC_STREAM_FRAMES; i++){
+        if(stream->frames[i].start == start){
+            return &stream->frames[i];
+        }
+    }
+    return NULL;
+}
+
+
+/*
+    Mel column in dB of the N_FFT samples of frame, not clipped, as power_to_dB computes it
+*/
+static void frame_db(const float *frame, float *column, kiss_fft_cpx *cx_out, float *db){
+
+    stft_column(frame, column, cx_out);
+    mel_column(column, db);
+
+    for(int16_t i=0; i<MEL_ROWS; i++){
+        float sample = (db[i] == 0) ? F_MIN : db[i];
+        db[i] = 10.0 * log10f(sample);
+    }
+}
+
+
+/*
+    MFCC features of the window x that starts at sample position of the stream.
+    The windows of a stream must come with increasing positions: a position that is not after
+    the one of the previous window (not updated, or a new stream without mfcc_stream_init) could
+    take frames of another window from the cache, so it is refused.
+    Returns 1 if the features are computed, 0 otherwise
+*/
+int8_t get_mfcc_features_stream(mfcc_stream_t *stream, int32_t position, const float *x, int16_t len, float *mean_mfcc, float *std_mfcc){
+
+    if(position <= stream->last_position){
+        printf("MFCC stream: window position %ld is not after %ld!\n", (long)position, (long)stream->last_position);
+        return 0;
+    }
+    stream->last_position = position;
+
+    int16_t padded_len = (2 * PAD_LEN) + len;                   // lenght of the 0-padded signal
+    int16_t n_frames = ((padded_len - N_FFT) / HOP_LEN) + 1;    // number of frames for the stft
+
+    float *padded = (float*)malloc(padded_len * sizeof(float));
+    float *column = (float*)malloc(N_FFT * sizeof(float));
+    kiss_fft_cpx *cx_out = (kiss_fft_cpx*)malloc(FFT_RES_LEN * sizeof(kiss_fft_cpx));
+    float *db = (float*)malloc((MEL_ROWS * n_frames) * sizeof(float));     // one column per frame
+    mfcc_frame_t **cached = (mfcc_frame_t**)malloc(n_frames * sizeof(mfcc_frame_t*));
+    float *coeffs = (float*)malloc((N_MFCC * n_frames) * sizeof(float));
+    float *c_res = (float*)malloc(N_MFCC * sizeof(float));
+
+    zero_padding(x, len, PAD_LEN, padded);
+
+    // Mel columns in dB: from the cache for the frames of the previous windows
+    float max = -INFINITY;
+    for(int16_t j=0; j<n_frames; j++){
+        int16_t local = (j * HOP_LEN) - PAD_LEN;               // first sample of the frame in x
+        float *db_j = &db[j * MEL_ROWS];
+        cached[j] = NULL;
+
+        if(local >= 0 && local + N_FFT <= len){
+            mfcc_frame_t *f = find_frame(stream, position + local);
+            if(f == NULL){
+                // new frame inside the window: computed once and kept
+                f = &stream->frames[stream->next_frame];
+                stream->next_frame = (stream->next_frame + 1) % MFCC_STREAM_FRAMES;
+                f->start = position + local;
+                frame_db(&padded[j * HOP_LEN], column, cx_out, f->db);
+                f->db_min = f->db[0];
+                for(int16_t i=1; i<MEL_ROWS; i++){
+                    f->db_min = (f->db[i] < f->db_min) ? f->db[i] : f->db_min;
+                }
+                f->mfcc_valid = 0;
+            }
+            cached[j] = f;
+            for(int16_t i=0; i<MEL_ROWS; i++){
+                db_j[i] = f->db[i];
+            }
+        } else {
+            // frame on the zero padding, depends on the window
+            frame_db(&padded[j * HOP_LEN], column, cx_out, db_j);
+        }
+
+        float max_j = vect_max_value(db_j, MEL_ROWS);
+        max = (max_j > max) ? max_j : max;
+    }
+
+    // TOP_DB clipping and DCT of each column, kept by the cached frames that are not clipped
+    for(int16_t j=0; j<n_frames; j++){
+        float *db_j = &db[j * MEL_ROWS];
+        mfcc_frame_t *f = cached[j];
+
+        if(f != NULL && f->mfcc_valid && !((max - TOP_DB) > f->db_min)){
+            for(int16_t i=0; i<N_MFCC; i++){
+                coeffs[(i * n_frames) + j] = f->mfcc[i];
+            }
+            continue;
+        }
+
+        int8_t clipped = 0;
+        for(int16_t i=0; i<MEL_ROWS; i++){
+            if((max - TOP_DB) > db_j[i]){
+                db_j[i] = (max - TOP_DB);
+                clipped = 1;
+            }
+        }
+
+        _dct_linear(db_j, MEL_ROWS, N_MFCC, c_res);
+
+        for(int16_t i=0; i<N_MFCC; i++){
+            coeffs[(i * n_frames) + j] = c_res[i];
+        }
+        if(f != NULL && !clipped){
+            for(int16_t i=0; i<N_MFCC; i++){
+                f->mfcc[i] = c_res[i];
+            }
+            f->mfcc_valid = 1;
+        }
+    }
+
+    for(int16_t i=0; i<N_MFCC; i++){
+        mean_mfcc[i] = vect_mean(&coeffs[i*n_frames], n_frames);
+        std_mfcc[i] = vect_std(&coeffs[i*n_frames], n_frames);
+    }
+
+    free(padded);
+    free(column);
+    free(cx_out);
+    free(db);
+    free(cached);
+    free(coeffs);
+    free(c_res);
+
+    return 1;
+}
@@ -24,6 +24,7 @@
 
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include <randomForest.h>
 
@@ -54,3 +55,152 @@ void predict_c(float *feat, float *probs)	{
         }
     }
 }
+
+
+// Flat layout of the forest, built from children, weights and node_features by rf_flat_init
+static rf_tree_t rf_trees[N_TREES];
+static rf_node_t *rf_nodes = NULL;
+
+
+/*
+    Packs the nodes reachable from the root of each tree in breadth first order, followed by the
+    class 0 and class 1 leaves, and computes the depth of each tree. Returns 0 (and frees the
+    layout) if a child is out of range or a node is reached twice, 1 otherwise.
+*/
+int8_t rf_flat_init(void){
+
+    int16_t order[N_NODES];     // nodes of the tree in breadth first order
+    int16_t pos[N_NODES];       // position of each node in order, -1 if not reached
+    int16_t depth[N_NODES];     // splits from the root to each node
+    int32_t n_flat = 0;
+
+    rf_flat_free();
+    rf_nodes = (rf_node_t*)malloc(N_TREES * (N_NODES + 2) * sizeof(rf_node_t));
+    if(rf_nodes == NULL){
+        printf("Random forest allocation failed!\n");
+        return 0;
+    }
+
+    for(int16_t t=0; t<N_TREES; t++){
+
+        for(int16_t n=0; n<N_NODES; n++){
+            pos[n] = -1;
+        }
+        int16_t n_order = 1, max_depth = 1;
+        order[0] = 0;
+        pos[0] = 0;
+        depth[0] = 1;
+
+        for(int16_t k=0; k<n_order; k++){
+            int16_t node = order[k];
+            for(int8_t c=0; c<2; c++){
+                int16_t child = children[t][node][c];
+                if(child == CLASS_0 || child == CLASS_1){
+                    continue;
+                }
+                if(child < 0 || child >= N_NODES || pos[child] >= 0){
+                    printf("Random forest tree %d is not a binary tree!\n", t);
+                    rf_flat_free();
+                    return 0;
+                }
+                pos[child] = n_order;
+                depth[child] = depth[node] + 1;
+                max_depth = (depth[child] > max_depth) ? depth[child] : max_depth;
+                order[n_order++] = child;
+            }
+        }
+
+        rf_node_t *tree = &rf_nodes[n_flat];
+        for(int16_t k=0; k<n_order; k++){
+            int16_t node = order[k];
+            tree[k].feature = node_features[t][node];
+            tree[k].threshold = weights[t][node];
+            for(int8_t c=0; c<2; c++){
+                int16_t child = children[t][node][c];
+                tree[k].child[c] = (child == CLASS_0) ? n_order : (child == CLASS_1) ? (n_order + 1) : pos[child];
+            }
+        }
+        // the leaves point to themselves
+        for(int8_t c=0; c<2; c++){
+            tree[n_order + c].feature = 0;
+            tree[n_order + c].threshold = 0.0f;
+            tree[n_order + c].child[0] = n_order + c;
+            tree[n_order + c].child[1] = n_order + c;
+        }
+
+        rf_trees[t].first = n_flat;
+        rf_trees[t].leaves = n_order;
+        rf_trees[t].depth = max_depth;
+        n_flat += n_order + 2;
+    }
+
+    rf_node_t *packed = (rf_node_t*)realloc(rf_nodes, n_flat * sizeof(rf_node_t));
+    if(packed != NULL){
+        rf_nodes = packed;
+    }
+    return 1;
+}
+
+
+void rf_flat_free(void){
+
+    free(rf_nodes);
+    rf_nodes = NULL;
+}
+
+
+/*
+    Same votes as predict_c for n_vectors feature vectors, stored one after the other
+    (TOT_FEATURES_RF each), using the flat layout of the forest built by rf_flat_init.
+    The (tree, vector) pairs are walked in groups of RF_BATCH, level by level: every step is a
+    select between the two children, with no branch on the path taken, so the walks of a group
+    overlap. A group holds RF_BATCH vectors on the same tree, or RF_BATCH trees of one vector
+    when there are fewer vectors.
+    probs holds 2 values per vector and is incremented like in predict_c.
+*/
+void predict_c_flat(const float *feats, int32_t n_vectors, float *probs){
+
+    const rf_node_t *tree[RF_BATCH];    // tree, features and votes of each walk of the group
+    const float *x[RF_BATCH];
+    float *votes[RF_BATCH];
+    int16_t leaves[RF_BATCH];
+    int16_t idx[RF_BATCH];              // current node of each walk
+
+    for(int32_t v0=0; v0<n_vectors; v0+=RF_BATCH){
+
+        int16_t nv = (n_vectors - v0 < RF_BATCH) ? (n_vectors - v0) : RF_BATCH;
+        int16_t n_pairs = nv * N_TREES;
+
+        for(int16_t p0=0; p0<n_pairs; p0+=RF_BATCH){
+
+            int16_t n = (n_pairs - p0 < RF_BATCH) ? (n_pairs - p0) : RF_BATCH;
+            int16_t depth = 0;
+
+            for(int16_t l=0; l<n; l++){
+                int16_t t = (p0 + l) / nv;
+                int32_t v = v0 + ((p0 + l) % nv);
+                tree[l] = &rf_nodes[rf_trees[t].first];
+                leaves[l] = rf_trees[t].leaves;
+                x[l] = &feats[v * TOT_FEATURES_RF];
+                votes[l] = &probs[v * 2];
+                idx[l] = 0;
+                depth = (rf_trees[t].depth > depth) ? rf_trees[t].depth : depth;
+            }
+
+            // one level for all the walks, until all of them are on a leaf (a leaf points to itself)
+            int16_t active = 1;
+            for(int16_t d=0; d<depth && active; d++){
+                active = 0;
+                for(int16_t l=0; l<n; l++){
+                    const rf_node_t *node = &tree[l][idx[l]];
+                    idx[l] = node->child[!(x[l][node->feature] <= node->threshold)];
+                    active |= (idx[l] < leaves[l]);
+                }
+            }
+
+            for(int16_t l=0; l<n; l++){
+                votes[l][idx[l] - leaves[l]]++;
+            }
+        }
+    }
+}
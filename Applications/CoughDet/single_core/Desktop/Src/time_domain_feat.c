@@ -31,6 +31,7 @@
 #include <helpers.h>
 #include <filters_parameters.h>
 #include <filtering.h>
+#include <filter_bank.h>
 
 #include <audio_features.h>
 
@@ -121,26 +122,24 @@ int16_t _find_peaks(const float *x, int16_t len){
 // Computes the EEPD features
 void eepd(const float *sig, int16_t len, int16_t fs, int16_t *res){
 
-    float *interm = (float*)malloc(len * sizeof(float));    // to store the intermediate result between the first and the second filter 
-    float *filtered = (float*)malloc(len * sizeof(float));       // temporary to store the result of each filter
+    // energy envelopes of all the bands, computed together by the filter bank
+    const float *envelopes = filter_bank_eepd(sig, len);
+    if(envelopes == NULL){
+        return;
+    }
 
-    const float *b, *a, *zi;
+    float *filtered = (float*)malloc(len * sizeof(float));       // envelope of the current band
 
     for(int16_t i=0; i<N_EEPD; i++){
 
-        b = filters_parameters.filters[i].b;
-        a = filters_parameters.filters[i].a;
-        zi = filters_parameters.filters[i].zi;  
-
-        filtfilt(sig, len, b, a, zi, interm);
-        vect_mult(interm, interm, len, interm);     // squared vector
-        filtfilt(interm, len, b_second, a_second, zi_second, filtered);
+        for(int16_t n=0; n<len; n++){
+            filtered[n] = envelopes[(n * FILTER_BANK_LANES) + i];
+        }
 
         normalize_max(filtered, len, filtered);   // divide each number by the maximum
 
         res[i] = _find_peaks(filtered, len);
     }
 
-    free(interm);
     free(filtered);
 }
@@ -25,6 +25,8 @@
 #ifndef _PICO_MULTICORE_H
 #define _PICO_MULTICORE_H
 
+#include <stdint.h>
+
 void pico_barrier(int id);
 
 void pico_critical_init();
@@ -33,4 +35,16 @@ void pico_critical_enter();
 
 void pico_critical_exit();
 
+// Stage run by both cores, id is the core (0 or 1)
+typedef void (*pico_stage_t)(uint32_t id);
+
+// Dispatcher of stages to core 1. With PERSISTENT_CORE1 core 1 is launched once by
+// pico_worker_start() and waits for stages on the inter-core FIFO, otherwise it is
+// launched and reset around every pico_worker_run().
+void pico_worker_start();
+
+void pico_worker_run(pico_stage_t stage);
+
+void pico_worker_stop();
+
 #endif
\ No newline at end of file
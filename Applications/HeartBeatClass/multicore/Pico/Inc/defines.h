@@ -60,6 +60,8 @@
 
 #define ONLY_FIRST_WINDOW   //Only 1 window is processed - Disable this if you want to run more windows
 
+#define PERSISTENT_CORE1    //Core 1 is launched once and receives the stages through the FIFO - Disable this to launch and reset it for every stage
+
 // Number of windows collected depend on the number of available core
 #define N 8
 #define H_B 30
@@ -23,8 +23,12 @@
 
 
 #include <pico/multicore.h>
+#include "Pico_management/multicore.h"
+#include "defines.h"
 
 #define VOID_PICO_MSG 2167
+#define STAGE_DONE_MSG 2168
+#define STAGE_EXIT_MSG 0
 
 critical_section_t crit_sec;
 
@@ -50,3 +54,50 @@ void pico_critical_enter()  {
 void pico_critical_exit()  {
     critical_section_exit(&crit_sec);
 }
+
+
+// Persistent worker of core 1: stage descriptors (function pointers) arrive through the
+// inter-core FIFO, so core 1 is launched once instead of launched and reset for every stage
+static void pico_worker_loop()  {
+    while (1) {
+        uint32_t msg = multicore_fifo_pop_blocking();
+        if (msg == STAGE_EXIT_MSG)
+            break;
+        ((pico_stage_t) (uintptr_t) msg)(1);
+        multicore_fifo_push_blocking(STAGE_DONE_MSG);
+    }
+}
+
+// Entry of core 1 when it is launched for a single stage
+static pico_stage_t pending_stage;
+
+static void pico_stage_once()   {
+    pending_stage(1);
+}
+
+void pico_worker_start()    {
+#ifdef PERSISTENT_CORE1
+    multicore_launch_core1(pico_worker_loop);
+#endif
+}
+
+void pico_worker_run(pico_stage_t stage)    {
+#ifdef PERSISTENT_CORE1
+    multicore_fifo_push_blocking((uint32_t) (uintptr_t) stage);
+    stage(0);
+    multicore_fifo_pop_blocking();
+#else
+    // One launch/reset of core 1 per stage
+    pending_stage = stage;
+    multicore_launch_core1(pico_stage_once);
+    stage(0);
+    multicore_reset_core1();
+#endif
+}
+
+void pico_worker_stop() {
+#ifdef PERSISTENT_CORE1
+    multicore_fifo_push_blocking(STAGE_EXIT_MSG);
+    multicore_reset_core1();
+#endif
+}
@@ -56,34 +56,34 @@ uint32_t complete_del[H_B * FPSIZE];
 int32_t offset_MF;
 
 
-static void multicore_relEn(void)
+static void multicore_relEn(uint32_t id)
 {
-  relEn_w(arg, 1);
+  relEn_w(arg, id);
 }
 
-static void multicore_getPeaks(void)
+static void multicore_getPeaks(uint32_t id)
 {
-  getPeaks_w (arg, 1);
+  getPeaks_w (arg, id);
 }
 
-static void multicore_report_rpeak(void)
+static void multicore_report_rpeak(uint32_t id)
 {
-  report_rpeak(arg, 1);
+  report_rpeak(arg, id);
 }
 
-static void multicore_delineateECG(void)
+static void multicore_delineateECG(uint32_t id)
 {
-  delineateECG_w(arg, 1);
+  delineateECG_w(arg, id);
 }
 
-static void multicore_combine_leads(void)
+static void multicore_combine_leads(uint32_t id)
 {
-  combine_leads(arg, 1);
+  combine_leads(arg, id);
 }
 
-static void multicore_morph_nleads(void)
+static void multicore_morph_nleads(uint32_t id)
 {
-  filterWindows(arg, 1);
+  filterWindows(arg, id);
 }
 
 void clearRelEn() {
@@ -99,10 +99,8 @@ void delineateECG() {
     arg[1] = (int32_t*) &ecg_buff[dim*NLEADS];
     buffSize_MF_RMS = dim;
     
-    // Call core 1
-    multicore_launch_core1(multicore_combine_leads);
-    combine_leads(arg, 0);
-    multicore_reset_core1();
+    // Run on both cores
+    pico_worker_run(multicore_combine_leads);
 
 #endif
 
@@ -111,10 +109,8 @@ void delineateECG() {
 
     arg[0] = (int32_t*) &ecg_buff[dim*NLEADS];
     
-    // Call core 1
-    multicore_launch_core1(multicore_delineateECG);
-    delineateECG_w(arg, 0);
-    multicore_reset_core1();
+    // Run on both cores
+    pico_worker_run(multicore_delineateECG);
     
 #endif
 }
@@ -151,6 +147,9 @@ void classifyBeatECG() {
 
   clearRelEn();
 
+  // Core 1 stays alive across all the stages and windows
+  pico_worker_start();
+
   // Prepare the input data
   for(rWindow=0; rWindow < N_WINDOWS; rWindow++)
   {
@@ -187,10 +186,8 @@ void classifyBeatECG() {
     arg[0] = &ecg_buff[overlap];
     buffSize_MF_RMS = dim-overlap;
     
-    // Call core 1
-    multicore_launch_core1(multicore_morph_nleads);
-    filterWindows(arg, 0);
-    multicore_reset_core1();
+    // Run on both cores
+    pico_worker_run(multicore_morph_nleads);
 
   #ifdef PRINT_SIG_MF_3L
     printf("\n!MORPHOLOGICAL FILTERING!\n");
@@ -212,10 +209,8 @@ void classifyBeatECG() {
     arg[0] = (int32_t*) &ecg_buff;
     arg[1] = (int32_t*) &ecg_buff[dim*NLEADS];
 
-    // Call core 1
-    multicore_launch_core1(multicore_relEn);
-    relEn_w(arg, 0);
-    multicore_reset_core1();
+    // Run on both cores
+    pico_worker_run(multicore_relEn);
 
   #ifdef PRINT_RELEN
     printf("\n!RELEN!\n");
@@ -231,10 +226,8 @@ void classifyBeatECG() {
 
 #ifdef MODULE_RPEAK
 
-    // Call core 1
-    multicore_launch_core1(multicore_getPeaks);
-    getPeaks_w(arg, 0);
-    multicore_reset_core1();
+    // Run on both cores
+    pico_worker_run(multicore_getPeaks);
 
     rpeaks_counter = 0;
 
@@ -254,10 +247,8 @@ void classifyBeatECG() {
 
 #ifdef MODULE_BEATCLASS
 
-    // Call core 1
-    multicore_launch_core1(multicore_report_rpeak);
-    report_rpeak(arg, 0);
-    multicore_reset_core1();
+    // Run on both cores
+    pico_worker_run(multicore_report_rpeak);
 
     for(int32_t indR=0; indR<rpeaks_counter; indR++) {
       if(indicesBeatClasses[indR]>0) {
@@ -292,12 +283,12 @@ void classifyBeatECG() {
 
 
 #ifdef ONLY_FIRST_WINDOW 
-    return; 
+    break; 
 #endif
 
 #ifdef ONLY_TWO_WINDOW
     if (rWindow == 1)
-        return;
+        break;
 #endif
 
     overlap = dim - (indicesRpeaks[rpeaks_counter - 2] - LONG_WINDOW);
@@ -324,4 +315,6 @@ void classifyBeatECG() {
 
     flagMF=1;
   }
+
+  pico_worker_stop();
 }
@@ -0,0 +1,54 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#ifndef CORE_DISPATCH_H_
+#define CORE_DISPATCH_H_
+
+#include <stdint.h>
+#include <pthread.h>
+
+/*
+    coreDispatch
+Desktop counterpart of the Pico dual-core stage dispatcher (multicore/Pico,
+Pico_management/multicore.c). A stage runs on both "cores": the caller runs
+it with id 0 and a second thread with id 1. coreForkJoinRun() creates and
+joins the second thread for every stage, like multicore_launch_core1() and
+multicore_reset_core1(), while coreWorkerRun() hands the stage to a
+persistent worker, like the FIFO-driven core 1 loop. Used to measure the
+fork/join overhead per window.
+*/
+
+typedef void (*coreStage)(uint32_t id, void *arg);
+
+typedef struct {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    coreStage stage;            // Stage waiting for the worker, NULL if none
+    void *arg;
+    int32_t done;               // Set by the worker when the stage has finished
+    int32_t exit;
+} coreWorker;
+
+void coreWorkerStart(coreWorker *w);
+void coreWorkerRun(coreWorker *w, coreStage stage, void *arg);
+void coreWorkerStop(coreWorker *w);
+
+void coreForkJoinRun(coreStage stage, void *arg);
+
+#endif // CORE_DISPATCH_H_
@@ -62,6 +62,7 @@
 
 //======== DEFINE MODULES ==========//
 #define MODULE_MF
+#define MODULE_MF_SIMD     //All the leads are filtered together by the block (van Herk/Gil-Werman) kernel - Disable this to filter lead by lead with the sample-by-sample filter
 #define MODULE_RMS
 #define MODULE_RELEN
 #define MODULE_RPEAK
@@ -78,6 +79,25 @@
 
 #define ONLY_FIRST_WINDOW   //Only 1 window is processed - Disable this if you want to run more windows
 
+// #define STREAMING_MODE      //Samples are pushed through the ecgStream API (see ecgStream.h) instead of read from the static array
+#define STREAM_RING_SIZE    4096    //Power of two, at least dim samples per lead
+#define STREAM_CHUNK        ECG_SAMPLING_FREQUENCY  //Samples per push in the desktop driver (1 second)
+#define STREAM_REPEAT       100     //Times the static recording is replayed when no input file is given
+
+// #define BATCH_MODE          //Recordings of several patients are classified in parallel by a thread pool (see ecgBatch.h)
+#define BATCH_RECORDINGS    256     //Copies of the static recording classified when no input files are given
+#define BATCH_WORKERS       0       //Worker threads, 0 for one per online core
+
+// #define DISPATCH_BENCH      //Measures the per-window cost of a thread fork/join per stage against a persistent worker (see coreDispatch.h)
+#define DISPATCH_WINDOWS    10000   //Windows of 6 stages dispatched for each scheme
+
+#if defined(BATCH_MODE) || defined(DISPATCH_BENCH)
+#ifndef STREAMING_MODE
+#define STREAMING_MODE
+#endif
+#undef PRINT_RESULT     //Per-window prints would interleave or flood the measurements
+#endif
+
 #define N 8
 #define H_B 30
 #define dim  (int)((BUFFER_SIZE * N) + LONG_WINDOW)
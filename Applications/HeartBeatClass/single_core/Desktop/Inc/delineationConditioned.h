@@ -39,6 +39,19 @@ extern uint16_t fiducial_point_code[FPSIZE];
 extern uint16_t type_wave[FPSIZE];
 extern uint16_t type_point[FPSIZE];
 
+#include "ecgContext.h"
+
+// Runs the complete app over the static recording in data/signal_250_3leads.h
 void classifyBeatECG();
 
+// Window-level steps, used by classifyBeatECG() and the streaming engine (ecgStream.h).
+// prepareWindowECG() copies the overlap of the previous window to the start of ecg_buff and
+// returns how many new samples must be written at ecg_buff[overlap + i + dim*lead].
+// processWindowECG() runs the pipeline on the filled window and returns 1 for an abnormal beat.
+// Every stream (patient) needs its own EcgContext.
+void initClassifyBeatECG(EcgContext *ctx);
+int32_t prepareWindowECG(EcgContext *ctx);
+int32_t processWindowECG(EcgContext *ctx);
+void closeClassifyBeatECG(EcgContext *ctx);
+
 #endif
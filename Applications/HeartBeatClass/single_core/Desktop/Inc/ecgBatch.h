@@ -0,0 +1,47 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#ifndef ECG_BATCH_H_
+#define ECG_BATCH_H_
+
+#include <stdint.h>
+#include "defines.h"
+
+/*
+    ecgBatch
+Host-side batch runner: a pool of worker threads classifies many independent
+recordings (patients). Every worker owns one ecgStream, so the recordings share
+no state and the throughput scales with the number of cores.
+*/
+
+typedef struct {
+    const int16_t (*samples)[NLEADS];   // Interleaved samples of the NLEADS leads
+    int32_t nSamples;
+} ecgRecording;
+
+typedef struct {
+    int32_t windows;
+    int32_t abnormalWindows;
+    int64_t beats;
+    int64_t abnormalBeats;
+} ecgRecordingResult;
+
+// Classifies the recordings with nWorkers threads and returns the elapsed wall time in seconds
+double ecgBatchRun(const ecgRecording *recordings, ecgRecordingResult *results, int32_t nRecordings, int32_t nWorkers);
+
+#endif // ECG_BATCH_H_
@@ -0,0 +1,71 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#ifndef ECG_CONTEXT_H_
+#define ECG_CONTEXT_H_
+
+#include <stdint.h>
+#include "defines.h"
+#include "morpho_filtering.h"
+#include "relativeEnergy.h"
+#include "peakDetection.h"
+#include "delineation.h"
+
+// Slot of the arg[] array that points to the EcgContext of the stream being processed
+#define ARG_CTX 12
+#define N_ARGS  13
+
+/*
+    EcgContext
+All the state of one ECG stream: the window buffer, the results of the current window
+and the state that every stage keeps between windows. The stages find it through
+arg[ARG_CTX], so independent streams (e.g. different patients) can run concurrently.
+*/
+typedef struct {
+    // Window buffer: NLEADS leads followed by the combined (RelEn / RMS) signal
+    int16_t *ecg_buff;
+    int32_t *arg[N_ARGS];
+
+    int32_t indicesRpeaks[H_B+1];
+    int32_t indicesBeatClasses[H_B+1];
+    uint32_t complete_del[H_B * FPSIZE];
+
+    // Window bookkeeping
+    int32_t count_window;
+    int32_t overlap;
+    int32_t buffSize_MF_RMS;
+    int32_t flag_prevWindAB;
+    int32_t firstDel;
+    int32_t offset_del;
+    int32_t rpeaks_counter;
+    int32_t tot_overlap;
+    int32_t totP;
+    int32_t flagMF;
+    int32_t i_lead;
+    int32_t flag_abnBeat;
+
+    // Stage state
+    BaselineFilt bl_filt[NLEADS];
+    HighFreqFilt250Hz hf_filt[NLEADS];
+    MorphBlockFilt mf_filt;
+    RelEnState relEn;
+    PeakDetState peaks;
+    uint32_t delineatedRR[FPSIZE*H_B];
+} EcgContext;
+
+#endif // ECG_CONTEXT_H_
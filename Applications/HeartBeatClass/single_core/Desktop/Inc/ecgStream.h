@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#ifndef ECG_STREAM_H_
+#define ECG_STREAM_H_
+
+#include <stdint.h>
+#include "defines.h"
+#include "delineationConditioned.h"
+
+/*
+    ecgStream
+Streaming front-end of the classifier. Samples of the NLEADS leads are pushed in
+chunks of any size into a ring buffer of STREAM_RING_SIZE samples per lead. Every
+time enough samples for the next window are buffered, the window is run through
+the whole pipeline (MF, RelEn, R peak detection, beat classification and 3-lead
+delineation) and the callback is called with the result. The morphological filter,
+the peak detection and the overlap between windows are kept across windows, so an
+unbounded recording can be followed without restarting the application.
+*/
+
+typedef struct {
+    int32_t window;             // Index of the processed window
+    int32_t offset;             // Absolute index of the first sample of the window
+    int32_t nPeaks;             // Number of detected R peaks
+    const int32_t *rpeaks;      // R peak indices relative to offset
+    const int32_t *classes;     // Beat class of every R peak (0 is normal)
+    int32_t abnormal;           // 1 if any beat of the window is abnormal
+} ecgWindowResult;
+
+typedef void (*ecgWindowCallback)(const ecgWindowResult *result, void *user);
+
+typedef struct {
+    EcgContext ctx;             // Pipeline state of this stream
+
+    int16_t ring[STREAM_RING_SIZE][NLEADS];
+    uint32_t head;              // Next sample to consume
+    uint32_t count;             // Buffered samples
+    int32_t needed;             // New samples required by the next window
+
+    ecgWindowCallback callback;
+    void *user;
+
+    int64_t samples;            // Total pushed samples
+    int32_t windows;            // Total processed windows
+    double busySeconds;         // Wall time spent inside ecgStreamPush
+} ecgStream;
+
+void ecgStreamInit(ecgStream *s, ecgWindowCallback callback, void *user);
+
+// Buffers nSamples samples and processes every window they complete. Returns the number of windows processed.
+int32_t ecgStreamPush(ecgStream *s, const int16_t samples[][NLEADS], int32_t nSamples);
+
+// Sustained throughput: pushed samples per second of processing time
+double ecgStreamThroughput(const ecgStream *s);
+
+void ecgStreamClose(ecgStream *s);
+
+#endif // ECG_STREAM_H_
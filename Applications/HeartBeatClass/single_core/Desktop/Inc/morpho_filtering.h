@@ -83,6 +83,7 @@ typedef struct {
 
 inline void InitBaselineFilt(BaselineFilt* f) {
     InitBaseliner(&f->baseliner);
+    for (int i = 0; i < BL_LATENCY; ++i) f->buffer[i] = 0;
     f->pos = 0;
 }
 
@@ -117,5 +118,40 @@ TYPE HighFreqFilt250HzProcess(HighFreqFilt250Hz* f, TYPE input);
 
 void filterWindows(int32_t *arg[]);
 
+// Block filter (all leads) ──────────────────────────────────────────────────
+
+// Leads processed together, one per SIMD lane
+#define MF_LANES 4
+// Samples filtered per block, sized so that the working arrays stay in L1
+#define MF_BLOCK 256
+
+#define HF_HIST (HF_FILT_250HZ_WIN-1)
+
+/**
+ * State of BaselineFilt followed by HighFreqFilt250Hz for MF_LANES leads,
+ * kept as the tail of every stage so that blocks can be processed with
+ * the van Herk/Gil-Werman algorithm instead of monotonic queues.
+ */
+typedef struct {
+    int32_t ero0[OPENING_WIN-1][MF_LANES];
+    int32_t dil1[OPENING_WIN+CLOSING_WIN-2][MF_LANES];
+    int32_t ero2[CLOSING_WIN-1][MF_LANES];
+    int32_t delay[BL_LATENCY][MF_LANES];
+    int32_t hf_in[HF_HIST][MF_LANES];
+    int32_t hf_dil[HF_HIST][MF_LANES];
+    int32_t hf_ero[HF_HIST][MF_LANES];
+} MorphBlockFilt;
+
+void InitMorphBlockFilt(MorphBlockFilt* f);
+
+/**
+ * Filters n samples of every lane of data (lane l at data[l*stride + i]) in place.
+ * The output is bit-identical to HighFreqFilt250HzProcess(BaselineFiltProcess())
+ * run sample by sample on each lead, as long as the intermediate results fit TYPE.
+ */
+void MorphBlockFiltProcess(MorphBlockFilt* f, TYPE* data, int32_t stride, int32_t nLeads, int32_t n);
+
+void filterWindowsNLeads(int32_t *arg[]);
+
 #endif  // MORPH_FILT_H_
 
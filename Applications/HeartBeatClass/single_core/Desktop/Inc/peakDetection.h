@@ -45,8 +45,19 @@
 #define TH_LOW_WIDTH_RATIO (int8_t) 65 // ratio between width of two R peaks with a small minimum distance (checked 55,65,75,85,95)
 #define TH_HIGH_WIDTH_RATIO (int16_t) 154 // ratio between width of two R peaks with a small minimum distance (checked 145,135,125,115,105)
 
+//State kept between the BUFFER_SIZE sub-windows and between windows
+typedef struct {
+	uint32_t lastPeakIndex;
+	int16_t lastPeakAmplitude;
+	uint32_t numberOfAnalyzedWindows;
+	uint8_t lastPeakWasIncomplete;
+	uint16_t lastPeakWidth;
+	uint32_t lastPeakIndex_BF;
+	int16_t lastPeakWidth_BF;
+	int16_t lastPeakAmplitude_BF;
+} PeakDetState;
 
 void getPeaks_w(int32_t *arg[]);
-void resetPeakDetection();
+void resetPeakDetection(PeakDetState *p);
 
 #endif // __PEAKDETECTION_H__
@@ -35,6 +35,24 @@
 #define SHORT_WINDOW_HALF (uint16_t) (0.14/2*ECG_SAMPLING_FREQUENCY)
 #define POWER (uint8_t) 2
 
+//LONG_WINDOW + 1 as an integer constant, to size the circular buffer
+#define RELEN_BUFFER_SIZE ((95*ECG_SAMPLING_FREQUENCY)/100 + 2)
+
+//State kept between samples of a window
+typedef struct {
+	//Previously-found short and long energies for RelEn signal generation
+	uint32_t lastShortEnergy;
+	uint32_t lastLongEnergy;
+	//circular ecg buffer and its pointers
+	int16_t ecgBuffer_re[RELEN_BUFFER_SIZE];
+	uint16_t ecgBufferPointer;
+	uint16_t lastEcgBufferPointer;
+	uint16_t currentShortWindowPointer;
+	uint16_t lastShortWindowPointer;
+	uint16_t relEnBufferPointer;
+	int8_t start;
+} RelEnState;
+
 //USE THIS ONE!
 //Generate the relative energy raw signal used to calculate peaks
 //Inputs: ecgBuffer - one long window of the signal. The first index of the buffer is the last value of the previous window
@@ -43,6 +61,6 @@
 //Output: the relative energy coefficient corresponding to the buffer of values
 
 void relEn_w(int32_t *arg[]);
-void clearAndResetRelEn();
+void clearAndResetRelEn(RelEnState *st);
 
 #endif // __RELATIVEENERGY_H__
@@ -38,6 +38,25 @@ modified and the output of the function is the number of the classification deci
 0 is assumed to be the class Normal
 */
 uint16_t classify(int16_t buffer[], uint16_t buffer_length, uint16_t peak);
+
+/*
+	rpInit
+Unpacks the random projection matrix used by classifyBatch. It must run before the first
+classifyBatch; initClassifyBeatECG and ecgBatchRun call it, and only the first call does the work.
+*/
+void rpInit(void);
+
+// Beats classified together by classifyBatch (the batch is split in chunks of RP_BATCH)
+#define RP_BATCH 32
+
+/*
+	classifyBatch
+Classifies nBeats beats in one call, with the same result as classify(buffers[b], buffer_length, peaks[b])
+for every beat b. The beats are processed together in a structure-of-arrays layout with the random projection
+matrix unpacked by rpInit.
+*/
+void classifyBatch(int16_t *buffers[], uint16_t buffer_length, const uint16_t peaks[], int32_t nBeats, uint16_t classes[]);
+
 void report_rpeak(int32_t *arg[]);
 
 #endif  //RP_CLASSIFIER_H_
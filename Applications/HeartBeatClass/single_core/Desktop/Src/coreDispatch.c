@@ -0,0 +1,104 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#include "coreDispatch.h"
+
+#include <stddef.h>
+
+static void *workerLoop(void *param) {
+    coreWorker *w = (coreWorker *) param;
+
+    pthread_mutex_lock(&w->lock);
+    while(1) {
+        while(w->stage == NULL && !w->exit)
+            pthread_cond_wait(&w->cond, &w->lock);
+        if(w->exit)
+            break;
+
+        coreStage stage = w->stage;
+        void *arg = w->arg;
+        pthread_mutex_unlock(&w->lock);
+
+        stage(1, arg);
+
+        pthread_mutex_lock(&w->lock);
+        w->stage = NULL;
+        w->done = 1;
+        pthread_cond_broadcast(&w->cond);
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    return NULL;
+}
+
+void coreWorkerStart(coreWorker *w) {
+    w->stage = NULL;
+    w->arg = NULL;
+    w->done = 0;
+    w->exit = 0;
+    pthread_mutex_init(&w->lock, NULL);
+    pthread_cond_init(&w->cond, NULL);
+    pthread_create(&w->thread, NULL, workerLoop, w);
+}
+
+void coreWorkerRun(coreWorker *w, coreStage stage, void *arg) {
+    pthread_mutex_lock(&w->lock);
+    w->stage = stage;
+    w->arg = arg;
+    w->done = 0;
+    pthread_cond_broadcast(&w->cond);
+    pthread_mutex_unlock(&w->lock);
+
+    stage(0, arg);
+
+    pthread_mutex_lock(&w->lock);
+    while(!w->done)
+        pthread_cond_wait(&w->cond, &w->lock);
+    pthread_mutex_unlock(&w->lock);
+}
+
+void coreWorkerStop(coreWorker *w) {
+    pthread_mutex_lock(&w->lock);
+    w->exit = 1;
+    pthread_cond_broadcast(&w->cond);
+    pthread_mutex_unlock(&w->lock);
+
+    pthread_join(w->thread, NULL);
+    pthread_cond_destroy(&w->cond);
+    pthread_mutex_destroy(&w->lock);
+}
+
+typedef struct {
+    coreStage stage;
+    void *arg;
+} forkJoinJob;
+
+static void *forkJoinEntry(void *param) {
+    forkJoinJob *job = (forkJoinJob *) param;
+    job->stage(1, job->arg);
+    return NULL;
+}
+
+void coreForkJoinRun(coreStage stage, void *arg) {
+    pthread_t thread;
+    forkJoinJob job = {stage, arg};
+
+    pthread_create(&thread, NULL, forkJoinEntry, &job);
+    stage(0, arg);
+    pthread_join(thread, NULL);
+}
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 
 #include "delineation.h"
+#include "ecgContext.h"
 
 
 //Fiducial point code
@@ -34,14 +35,11 @@ uint16_t type_wave[FPSIZE]={0,2,2,2,1,1,1,0,0};
 uint16_t type_point[FPSIZE] = {2,0,1,2,0,1,2,0,1,};
 int16_t flagOnsetOffset[9] = {1,-1,0,-1,-1,-1,1,-1,0};
 
-//Delineated beat
-uint32_t delineatedRR[FPSIZE*H_B];
-
 //  +---------------------------------------------------+
 //  |               General helper functions            |
 //  +---------------------------------------------------+
 
-void initDelineationArray(){
+void initDelineationArray(uint32_t *delineatedRR){
     for(int32_t i=0; i<FPSIZE*H_B;i++){
         delineatedRR[i] = 0;
     }
@@ -325,7 +323,7 @@ int16_t delineate_onset_offset(int16_t* sig,cntType sigLength,dType fs,uint16_t
         return sig[point]; //feature amplitude
 }
 
-void optimized_feature_extraction(dType* ecgRR, int32_t sigLength, dType fs, int16_t* indexesCodeCurrentPeak, int32_t rp, uint32_t startindexRR ){
+void optimized_feature_extraction(uint32_t *delineatedRR, dType* ecgRR, int32_t sigLength, dType fs, int16_t* indexesCodeCurrentPeak, int32_t rp, uint32_t startindexRR ){
 
     dType Ptime=0,Ttime=0,isoline=0;
 
@@ -409,9 +407,11 @@ void delineateECG_w(int32_t *arg[]){
     int32_t *rpeaks_counter = arg[4];
     uint32_t *complete_del = (uint32_t *)arg[5];
     uint32_t out = 0;
+    //Delineated beat
+    uint32_t *delineatedRR = ((EcgContext*) arg[ARG_CTX])->delineatedRR;
 
 
-    initDelineationArray();
+    initDelineationArray(delineatedRR);
 
     for(int32_t rp = 1; rp < *rpeaks_counter; rp++){
         //SELECTIVE DELINEATION *******************
@@ -424,7 +424,7 @@ void delineateECG_w(int32_t *arg[]){
 
         //Function for delineation inside RR interval: as input ecg signal within RR (remember to scale the signal back to the Matlab version to use floats: divided by 10)
         int16_t featureIndexCodePointer[2] = {0,FPSIZE-1};
-        optimized_feature_extraction((dType *)&ecg_buffRR_w[startindexRR],stopRR,ECG_SAMPLING_FREQUENCY,featureIndexCodePointer, rp, startindexRR);
+        optimized_feature_extraction(delineatedRR, (dType *)&ecg_buffRR_w[startindexRR],stopRR,ECG_SAMPLING_FREQUENCY,featureIndexCodePointer, rp, startindexRR);
     }
         //*****************************************
     
@@ -29,8 +29,11 @@
 #include "peakDetection.h"
 #include "relativeEnergy.h"
 #include "rp_classifier.h"
+#include "ecgContext.h"
 
+#ifndef STREAMING_MODE
 #include "data/signal_250_3leads.h"
+#endif
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -38,48 +41,34 @@
 
 #define N_WINDOWS (ECG_VECTOR_SIZE/dim)
 
-int16_t *ecg_buff;
-int32_t indicesRpeaks[H_B+1];
-int32_t indicesBeatClasses[H_B+1];
-uint32_t complete_del[H_B * FPSIZE];
-
-int32_t *arg[12];
-
-int32_t count_window;
-int32_t overlap;
-int32_t buffSize_MF_RMS;
-int32_t flag_prevWindAB;
-int32_t rWindow;
-
-
-void clearRelEn() {
-    clearAndResetRelEn();
-    resetPeakDetection();
+void clearRelEn(EcgContext *ctx) {
+    clearAndResetRelEn(&ctx->relEn);
+    resetPeakDetection(&ctx->peaks);
 }
 
-void delineateECG(){
+void delineateECG(EcgContext *ctx) {
 
 
-#ifdef MODULE_MF_3L
+#if defined(MODULE_MF_3L) && !defined(MODULE_MF_SIMD)     // With MODULE_MF_SIMD the leads are filtered with lead 0
 
-        if(flag_prevWindAB==1) {
-            arg[0] = (int32_t*) ecg_buff;
-            buffSize_MF_RMS = dim;
+        if(ctx->flag_prevWindAB==1) {
+            ctx->arg[0] = (int32_t*) ctx->ecg_buff;
+            ctx->buffSize_MF_RMS = dim;
         } else {
-            arg[0] = (int32_t*) &ecg_buff[overlap];
-            buffSize_MF_RMS = dim-overlap;
+            ctx->arg[0] = (int32_t*) &ctx->ecg_buff[ctx->overlap];
+            ctx->buffSize_MF_RMS = dim-ctx->overlap;
         }
 
         for(int32_t lead_abnbeat = 1; lead_abnbeat < NLEADS; lead_abnbeat++)    {
-            arg[9] = &lead_abnbeat;
-            filterWindows(arg);
+            ctx->arg[9] = &lead_abnbeat;
+            filterWindows(ctx->arg);
         }
 
     #ifdef PRINT_SIG_MF_3L
-        if(count_window==0) {
+        if(ctx->count_window==0) {
             int32_t lead_print = 1;
             for(int32_t sample = dim*lead_print; sample<dim*(lead_print+1); sample++) {
-                printf("%d ", ecg_buff[sample]);
+                printf("%d ", ctx->ecg_buff[sample]);
             }
             printf("\n");
         }
@@ -89,16 +78,16 @@ void delineateECG(){
 
 #ifdef MODULE_RMS_3L
 
-            arg[0] = (int32_t*) ecg_buff;
-            arg[1] = (int32_t*) &ecg_buff[dim*NLEADS]; //Using last dim samples of the buffer to keep the first for the MF lead0
-            buffSize_MF_RMS = dim;
+            ctx->arg[0] = (int32_t*) ctx->ecg_buff;
+            ctx->arg[1] = (int32_t*) &ctx->ecg_buff[dim*NLEADS]; //Using last dim samples of the buffer to keep the first for the MF lead0
+            ctx->buffSize_MF_RMS = dim;
 
-            combine_leads(arg);
+            combine_leads(ctx->arg);
 
     #ifdef PRINT_SIG_RMS_3L
-            if(count_window==0) {
+            if(ctx->count_window==0) {
                 for(int32_t sample = dim*NLEADS; sample<dim*(NLEADS+1); sample++) {
-                    printf("%d ", ecg_buff[sample]);
+                    printf("%d ", ctx->ecg_buff[sample]);
                 }
                 printf("\n");
             }
@@ -110,91 +99,130 @@ void delineateECG(){
 
 #ifdef MODULE_DEL_3L
 
-            arg[0] = (int32_t*) &ecg_buff[dim*NLEADS];
+            ctx->arg[0] = (int32_t*) &ctx->ecg_buff[dim*NLEADS];
 
-            delineateECG_w(arg);
+            delineateECG_w(ctx->arg);
 
 #endif
 }
 
-void classifyBeatECG()  {
+void initClassifyBeatECG(EcgContext *ctx) {
+
+    ctx->firstDel = 0;
+    ctx->offset_del = 0;
+    ctx->rpeaks_counter = 0;
+    ctx->tot_overlap = 0;
+    ctx->totP = 0;
+    ctx->flagMF = 0;
+    ctx->i_lead = 0;
+    ctx->flag_abnBeat = 0;
+
+    ctx->buffSize_MF_RMS = dim;
+    ctx->count_window = 0;
+    ctx->overlap = 0;
+    ctx->flag_prevWindAB = 0;
+
+    ctx->ecg_buff = (int16_t *) malloc(dim*(NLEADS+1) * sizeof(int16_t));
+
+    rpInit();
+
+    ctx->arg[0] = (int32_t*) ctx->ecg_buff;
+    ctx->arg[1] = (int32_t*) &ctx->ecg_buff[dim];
+    ctx->arg[2] = ctx->indicesRpeaks;
+    ctx->arg[3] = &ctx->offset_del;
+    ctx->arg[4] = &ctx->rpeaks_counter;
+    ctx->arg[5] = (int32_t*) ctx->complete_del;
+    ctx->arg[6] = &ctx->totP;
+    ctx->arg[8] = &ctx->flagMF;
+    ctx->arg[9] = &ctx->i_lead;
+    ctx->arg[10] = &ctx->buffSize_MF_RMS;
+    ctx->arg[11] = ctx->indicesBeatClasses;
+    ctx->arg[ARG_CTX] = (int32_t*) ctx;
+
+    for(int32_t ix_rp = 0; ix_rp < H_B+1 ; ix_rp++) {
+        ctx->indicesRpeaks[ix_rp] = 0;
+    }
 
-    int32_t firstDel = 0;
-    int32_t offset_del = 0;
-    int32_t rpeaks_counter = 0;
-    int32_t tot_overlap = 0;
-    int32_t offset_MF = 0;
-    int32_t totP = 0;
-    int32_t flagMF = 0;
-    int32_t i_lead = 0;
-    int32_t flag_abnBeat = 0;
-
-
-    offset_MF = 150;    // For 250Hz sampling frequency
-
-    buffSize_MF_RMS = dim;
-    count_window = 0;
-    overlap = 0;
-    flag_prevWindAB = 0;
-
-    ecg_buff = (int16_t *) malloc(dim*(NLEADS+1) * sizeof(int16_t));
-
-    arg[0] = (int32_t*) ecg_buff;
-    arg[1] = (int32_t*) &ecg_buff[dim];
-    arg[2] = indicesRpeaks;
-    arg[3] = &offset_del;
-    arg[4] = &rpeaks_counter;
-    arg[5] = (int32_t*) complete_del;
-    arg[6] = &totP;
-    // arg[7] = &rWindow;
-    arg[8] = &flagMF;
-    arg[9] = &i_lead;
-    arg[10] = &buffSize_MF_RMS;
-    arg[11] = indicesBeatClasses;
-
-    clearRelEn();
+    clearRelEn(ctx);
+}
 
-    for(rWindow=0; rWindow<N_WINDOWS; rWindow++)
-    {
+void closeClassifyBeatECG(EcgContext *ctx) {
+    free(ctx->ecg_buff);
+    ctx->ecg_buff = NULL;
+}
 
-        if (firstDel == 1) {
-            for(int32_t lead=0; lead<NLEADS; lead++) {
-                for(int32_t i=0; i<overlap; i++) {
-                    ecg_buff[i + dim*lead] = ecg_buff[(dim - overlap + i) + dim*lead]; //copy the overlap of the 3 leads
-                }
-            }
-        }
+int32_t prepareWindowECG(EcgContext *ctx) {
 
-        for(int32_t lead=0; lead<NLEADS; lead++) {
-            for(int32_t i=overlap; i<dim; i++) {
-                ecg_buff[i + dim*lead] = ecg_3l[rWindow*dim + i - tot_overlap][lead];
-            }
+    if (ctx->firstDel == 0)
+        return dim;
+
+    // The next window starts LONG_WINDOW samples before the second-to-last R peak.
+    // Without two peaks (e.g. flat or lost signal) only the RelEn warm-up is kept.
+    if (ctx->rpeaks_counter >= 2 && ctx->indicesRpeaks[ctx->rpeaks_counter - 2] > LONG_WINDOW)
+        ctx->overlap = dim - (ctx->indicesRpeaks[ctx->rpeaks_counter - 2] - LONG_WINDOW);
+    else
+        ctx->overlap = LONG_WINDOW;
+
+#ifdef DEBUG_FIRST_MODULES
+    ctx->overlap = LONG_WINDOW+LONG_WINDOW;
+#endif
+
+    ctx->tot_overlap += ctx->overlap;
+    ctx->offset_del = (ctx->count_window+1) * dim - ctx->tot_overlap;
+
+    if (ctx->rpeaks_counter > 0)
+        ctx->totP += ctx->rpeaks_counter-1;
+
+    ctx->flagMF=1;
+    ctx->count_window++;
+    ctx->rpeaks_counter = 0;
+
+    for(int32_t ix_rp = 0; ix_rp < H_B+1 ; ix_rp++) {
+        ctx->indicesRpeaks[ix_rp] = 0;
+    }
+
+    for(int32_t lead=0; lead<NLEADS; lead++) {
+        for(int32_t i=0; i<ctx->overlap; i++) {
+            ctx->ecg_buff[i + dim*lead] = ctx->ecg_buff[(dim - ctx->overlap + i) + dim*lead]; //copy the overlap of the 3 leads
         }
+    }
 
-        if (firstDel == 0) {
-            // Needed to initialize the MF filter properly
-            for(int32_t lead=0; lead<NLEADS; lead++) {
-                for(int32_t i=0; i<=offset_MF; i++) {
-                    ecg_buff[i + dim*lead] = 0;
-                }
+    return dim - ctx->overlap;
+}
+
+int32_t processWindowECG(EcgContext *ctx) {
+
+    int32_t offset_MF = 150;    // For 250Hz sampling frequency
+    int32_t abnormal = 0;
+
+    if (ctx->firstDel == 0) {
+        // Needed to initialize the MF filter properly
+        for(int32_t lead=0; lead<NLEADS; lead++) {
+            for(int32_t i=0; i<=offset_MF; i++) {
+                ctx->ecg_buff[i + dim*lead] = 0;
             }
         }
+    }
 
 #ifdef MODULE_MF
 
-        arg[0] = (int32_t*) &ecg_buff[overlap];
-        buffSize_MF_RMS = dim-overlap;
+    ctx->arg[0] = (int32_t*) &ctx->ecg_buff[ctx->overlap];
+    ctx->buffSize_MF_RMS = dim-ctx->overlap;
 
-        arg[9]= &i_lead;
-        filterWindows(arg);
+#ifdef MODULE_MF_SIMD
+    filterWindowsNLeads(ctx->arg);
+#else
+    ctx->arg[9]= &ctx->i_lead;
+    filterWindows(ctx->arg);
+#endif
 
     #ifdef PRINT_SIG_MF
-        if(count_window==0){
-            for(int32_t sample = 0; sample<dim; sample++) {
-                printf("%d ", ecg_buff[sample]);
-            }
-            printf("\n");
+    if(ctx->count_window==0){
+        for(int32_t sample = 0; sample<dim; sample++) {
+            printf("%d ", ctx->ecg_buff[sample]);
         }
+        printf("\n");
+    }
     #endif
 
 #endif // MODULE_MF
@@ -202,39 +230,39 @@ void classifyBeatECG()  {
 
 #ifdef MODULE_RELEN
 
-        clearAndResetRelEn();
+    clearAndResetRelEn(&ctx->relEn);
 
-        arg[0] = (int32_t*) ecg_buff; //keep the first dim samples for lead0 MF
-        arg[1] = (int32_t*) &ecg_buff[dim*NLEADS];
+    ctx->arg[0] = (int32_t*) ctx->ecg_buff; //keep the first dim samples for lead0 MF
+    ctx->arg[1] = (int32_t*) &ctx->ecg_buff[dim*NLEADS];
 
-        relEn_w(arg);
+    relEn_w(ctx->arg);
 
     #ifdef PRINT_RELEN
-        if(count_window==0) {
-            for(int32_t sample = dim*NLEADS; sample<dim*(NLEADS+1); sample++) {
-                printf("%d ", ecg_buff[sample]);
-            }
-            printf("\n");
+    if(ctx->count_window==0) {
+        for(int32_t sample = dim*NLEADS; sample<dim*(NLEADS+1); sample++) {
+            printf("%d ", ctx->ecg_buff[sample]);
         }
+        printf("\n");
+    }
     #endif
 
 #endif // MODULE_RELEN
 
 #ifdef MODULE_RPEAK
 
-        getPeaks_w(arg);
+    getPeaks_w(ctx->arg);
 
-        rpeaks_counter = 0;
+    ctx->rpeaks_counter = 0;
 
-        while(indicesRpeaks[rpeaks_counter]!=0) {
-            rpeaks_counter++;
-        }
+    while(ctx->rpeaks_counter < H_B+1 && ctx->indicesRpeaks[ctx->rpeaks_counter]!=0) {
+        ctx->rpeaks_counter++;
+    }
 
     #ifdef PRINT_RPEAKS
-        for(int32_t indR=0; indR<rpeaks_counter; indR++) {
-            printf("%d ", (indicesRpeaks[indR] + offset_del));
-        }
-        printf("\n");
+    for(int32_t indR=0; indR<ctx->rpeaks_counter; indR++) {
+        printf("%d ", (ctx->indicesRpeaks[indR] + ctx->offset_del));
+    }
+    printf("\n");
     #endif
 
 #endif // MODULE_RPEAK
@@ -242,78 +270,85 @@ void classifyBeatECG()  {
 
 #ifdef MODULE_BEATCLASS
 
-        report_rpeak(arg);
-        for(int32_t indR=0; indR<rpeaks_counter; indR++) {
-            if(indicesBeatClasses[indR]>0) {
-                flag_abnBeat=1;
-                break;
-            }
+    report_rpeak(ctx->arg);
+    for(int32_t indR=0; indR<ctx->rpeaks_counter; indR++) {
+        if(ctx->indicesBeatClasses[indR]>0) {
+            ctx->flag_abnBeat=1;
+            break;
         }
+    }
 
     #ifdef PRINT_BEATCLASS
-        for(int32_t indR=0; indR<rpeaks_counter; indR++) {
-          printf("%d %d\n", indicesRpeaks[indR], indicesBeatClasses[indR]);
-        }
+    for(int32_t indR=0; indR<ctx->rpeaks_counter; indR++) {
+        printf("%d %d\n", ctx->indicesRpeaks[indR], ctx->indicesBeatClasses[indR]);
+    }
     #endif
-    
+
     #ifdef PRINT_RESULT
-        if(flag_abnBeat)
-	    printf("Window %d: ABNORMAL_BEAT!\n", rWindow);
-	else
-	    printf("Window %d: BIEN!\n", rWindow);
+    if(ctx->flag_abnBeat)
+        printf("Window %d: ABNORMAL_BEAT!\n", ctx->count_window);
+    else
+        printf("Window %d: BIEN!\n", ctx->count_window);
     #endif
 
 #endif // MODULE_BEATCLASS
 
-
+    abnormal = ctx->flag_abnBeat;
 
 #ifdef MODULE_3L
 
-        if(flag_abnBeat==1) {
-            delineateECG();
-            flag_abnBeat = 0;
-            flag_prevWindAB = 0;
-        } else {
-            flag_prevWindAB = 1;
-        }
-
+    if(ctx->flag_abnBeat==1) {
+        delineateECG(ctx);
+        ctx->flag_abnBeat = 0;
+        ctx->flag_prevWindAB = 0;
+    } else {
+        ctx->flag_prevWindAB = 1;
+    }
 
 #endif
 
-
     #ifdef PRINT_DEL
-            for(int32_t ix = 0; ix<(rpeaks_counter-1)*FPSIZE; ix++)
-                printf("%d ", complete_del[ix]);
-            printf("\n");
+    for(int32_t ix = 0; ix<(ctx->rpeaks_counter-1)*FPSIZE; ix++)
+        printf("%d ", ctx->complete_del[ix]);
+    printf("\n");
     #endif
 
-#ifdef ONLY_FIRST_WINDOW
-        return;
-#endif
+    ctx->flag_abnBeat = 0;
+    ctx->firstDel = 1;
 
-        overlap = dim - (indicesRpeaks[rpeaks_counter - 2] - LONG_WINDOW);
+    return abnormal;
+}
 
+#ifndef STREAMING_MODE
 
-#ifdef DEBUG_FIRST_MODULES
-        overlap = LONG_WINDOW+LONG_WINDOW;
-#endif
+void classifyBeatECG()  {
 
-        tot_overlap += overlap;
-        offset_del = (count_window+1) * dim - tot_overlap;
+    static EcgContext context;
+    EcgContext *ctx = &context;
+    int32_t newSamples = 0;
+    int32_t rWindow;
 
-        totP += rpeaks_counter-1;
+    initClassifyBeatECG(ctx);
 
-        firstDel = 1;
-        flagMF=1;
-        count_window++;
-        rpeaks_counter = 0;
+    for(rWindow=0; rWindow<N_WINDOWS; rWindow++)
+    {
+        newSamples = prepareWindowECG(ctx);
 
-        for(int32_t ix_rp = 0; ix_rp < H_B+1 ; ix_rp++) {
-           indicesRpeaks[ix_rp] = 0;
+        // The new samples of window rWindow continue right after the overlap
+        for(int32_t lead=0; lead<NLEADS; lead++) {
+            for(int32_t i=0; i<newSamples; i++) {
+                ctx->ecg_buff[ctx->overlap + i + dim*lead] = ecg_3l[rWindow*dim + ctx->overlap + i - ctx->tot_overlap][lead];
+            }
         }
 
-    }
+        processWindowECG(ctx);
 
-    free(ecg_buff);
+#ifdef ONLY_FIRST_WINDOW
+        break;
+#endif
+    }
 
+    closeClassifyBeatECG(ctx);
 }
+
+#endif // STREAMING_MODE
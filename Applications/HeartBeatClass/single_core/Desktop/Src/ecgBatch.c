@@ -0,0 +1,123 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "ecgBatch.h"
+#include "ecgStream.h"
+#include "rp_classifier.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+
+typedef struct {
+    const ecgRecording *recordings;
+    ecgRecordingResult *results;
+    int32_t nRecordings;
+    int32_t next;               // Next recording to hand out
+    pthread_mutex_t lock;
+} batchQueue;
+
+static void onWindow(const ecgWindowResult *result, void *user) {
+    ecgRecordingResult *res = (ecgRecordingResult *) user;
+
+    res->windows++;
+    res->abnormalWindows += result->abnormal;
+    for(int32_t ix = 0; ix < result->nPeaks; ix++) {
+        res->beats++;
+        if(result->classes[ix] > 0)
+            res->abnormalBeats++;
+    }
+}
+
+static void *worker(void *param) {
+    batchQueue *q = (batchQueue *) param;
+    ecgStream *stream = (ecgStream *) malloc(sizeof(ecgStream));
+
+    if(stream == NULL)
+        return NULL;
+
+    while(1) {
+        int32_t rec;
+
+        pthread_mutex_lock(&q->lock);
+        rec = q->next++;
+        pthread_mutex_unlock(&q->lock);
+
+        if(rec >= q->nRecordings)
+            break;
+
+        ecgRecordingResult *res = &q->results[rec];
+        res->windows = 0;
+        res->abnormalWindows = 0;
+        res->beats = 0;
+        res->abnormalBeats = 0;
+
+        ecgStreamInit(stream, onWindow, res);
+        for(int32_t i = 0; i < q->recordings[rec].nSamples; i += STREAM_CHUNK) {
+            int32_t n = q->recordings[rec].nSamples - i;
+            if(n > STREAM_CHUNK)
+                n = STREAM_CHUNK;
+            ecgStreamPush(stream, &q->recordings[rec].samples[i], n);
+        }
+        ecgStreamClose(stream);
+    }
+
+    free(stream);
+    return NULL;
+}
+
+double ecgBatchRun(const ecgRecording *recordings, ecgRecordingResult *results, int32_t nRecordings, int32_t nWorkers) {
+    batchQueue q;
+    pthread_t *threads = (pthread_t *) malloc(nWorkers * sizeof(pthread_t));
+    struct timespec start, stop;
+
+    q.recordings = recordings;
+    q.results = results;
+    q.nRecordings = nRecordings;
+    q.next = 0;
+    pthread_mutex_init(&q.lock, NULL);
+
+    // The shared classifier tables are written here, before any worker reads them
+    rpInit();
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for(int32_t w = 0; w < nWorkers; w++) {
+        if(pthread_create(&threads[w], NULL, worker, &q) != 0) {
+            printf("Cannot start worker %d\n", w);
+            nWorkers = w;
+            break;
+        }
+    }
+    // Without any thread the caller does the work
+    if(nWorkers == 0)
+        worker(&q);
+    for(int32_t w = 0; w < nWorkers; w++) {
+        pthread_join(threads[w], NULL);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    pthread_mutex_destroy(&q.lock);
+    free(threads);
+
+    return (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9;
+}
@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "ecgStream.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define RING_MASK (STREAM_RING_SIZE-1)
+
+static double nowSeconds() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+void ecgStreamInit(ecgStream *s, ecgWindowCallback callback, void *user) {
+    s->head = 0;
+    s->count = 0;
+    s->callback = callback;
+    s->user = user;
+    s->samples = 0;
+    s->windows = 0;
+    s->busySeconds = 0;
+
+    initClassifyBeatECG(&s->ctx);
+    s->needed = prepareWindowECG(&s->ctx);
+}
+
+// Moves the buffered samples of the next window into ecg_buff, runs it and reports the result
+static void runWindow(ecgStream *s) {
+    EcgContext *ctx = &s->ctx;
+    ecgWindowResult result;
+
+    for(int32_t i=0; i<s->needed; i++) {
+        uint32_t pos = (s->head + i) & RING_MASK;
+        for(int32_t lead=0; lead<NLEADS; lead++) {
+            ctx->ecg_buff[ctx->overlap + i + dim*lead] = s->ring[pos][lead];
+        }
+    }
+    s->head = (s->head + s->needed) & RING_MASK;
+    s->count -= s->needed;
+
+    result.abnormal = processWindowECG(&s->ctx);
+    result.window = ctx->count_window;
+    result.offset = ctx->offset_del;
+    result.nPeaks = ctx->rpeaks_counter;
+    result.rpeaks = ctx->indicesRpeaks;
+    result.classes = ctx->indicesBeatClasses;
+
+    if(s->callback != NULL)
+        s->callback(&result, s->user);
+
+    s->windows++;
+    s->needed = prepareWindowECG(&s->ctx);
+}
+
+int32_t ecgStreamPush(ecgStream *s, const int16_t samples[][NLEADS], int32_t nSamples) {
+    int32_t windows = s->windows;
+    double start = nowSeconds();
+
+    while(nSamples > 0) {
+        // The ring holds at least one full window, so there is always room after the windows are drained
+        int32_t room = STREAM_RING_SIZE - s->count;
+        int32_t chunk = nSamples < room ? nSamples : room;
+        uint32_t tail = (s->head + s->count) & RING_MASK;
+
+        for(int32_t i=0; i<chunk; i++) {
+            for(int32_t lead=0; lead<NLEADS; lead++) {
+                s->ring[(tail + i) & RING_MASK][lead] = samples[i][lead];
+            }
+        }
+        s->count += chunk;
+        s->samples += chunk;
+        samples += chunk;
+        nSamples -= chunk;
+
+        while(s->count >= (uint32_t) s->needed) {
+            runWindow(s);
+        }
+    }
+
+    s->busySeconds += nowSeconds() - start;
+    return s->windows - windows;
+}
+
+double ecgStreamThroughput(const ecgStream *s) {
+    if(s->busySeconds <= 0)
+        return 0;
+    return s->samples / s->busySeconds;
+}
+
+void ecgStreamClose(ecgStream *s) {
+    closeClassifyBeatECG(&s->ctx);
+    s->count = 0;
+}
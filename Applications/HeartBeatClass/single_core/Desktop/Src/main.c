@@ -22,9 +22,263 @@
 
 
 
+#define _POSIX_C_SOURCE 199309L
+
 #include "delineationConditioned.h"
 #include "defines.h"
 
+#if defined(BATCH_MODE)
+
+#include "ecgBatch.h"
+#include "data/signal_250_3leads.h"
+
+#include <stdio.h>
+#include <unistd.h>
+
+// Loads a file of raw interleaved int16 samples of the NLEADS leads
+static int32_t loadRecording(const char *path, ecgRecording *rec) {
+    FILE *in = fopen(path, "rb");
+    long size;
+    int16_t (*samples)[NLEADS];
+
+    if(in == NULL)
+        return -1;
+    fseek(in, 0, SEEK_END);
+    size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+
+    samples = malloc(size);
+    rec->nSamples = (int32_t) fread(samples, sizeof(samples[0]), size / sizeof(samples[0]), in);
+    rec->samples = (const int16_t (*)[NLEADS]) samples;
+    fclose(in);
+    return 0;
+}
+
+static void summarize(const char *label, const ecgRecordingResult *results, int32_t nRecordings, int32_t nWorkers, double seconds) {
+    int64_t beats = 0, abnormalBeats = 0;
+
+    for(int32_t r = 0; r < nRecordings; r++) {
+        beats += results[r].beats;
+        abnormalBeats += results[r].abnormalBeats;
+    }
+    printf("%s: %d recordings, %d workers, %.3f s, %.0f recordings/hour, beats: %lld (%lld abnormal)\n",
+        label, nRecordings, nWorkers, seconds, nRecordings * 3600.0 / seconds,
+        (long long) beats, (long long) abnormalBeats);
+}
+
+// Input: one file of raw interleaved int16 samples per patient.
+// Without arguments BATCH_RECORDINGS copies of the static recording are classified.
+int main(int argc, char *argv[])
+{
+    int32_t nRecordings = argc > 1 ? argc - 1 : BATCH_RECORDINGS;
+    int32_t nWorkers = BATCH_WORKERS > 0 ? BATCH_WORKERS : (int32_t) sysconf(_SC_NPROCESSORS_ONLN);
+    ecgRecording *recordings = malloc(nRecordings * sizeof(ecgRecording));
+    ecgRecordingResult *results = malloc(nRecordings * sizeof(ecgRecordingResult));
+    double serial, parallel;
+
+    for(int32_t r = 0; r < nRecordings; r++) {
+        if(argc > 1) {
+            if(loadRecording(argv[r + 1], &recordings[r]) != 0) {
+                printf("Cannot open %s\n", argv[r + 1]);
+                return 1;
+            }
+        } else {
+            recordings[r].samples = (const int16_t (*)[NLEADS]) ecg_3l;
+            recordings[r].nSamples = ECG_VECTOR_SIZE;
+        }
+    }
+
+    if(nWorkers < 1)
+        nWorkers = 1;
+
+    serial = ecgBatchRun(recordings, results, nRecordings, 1);
+    summarize("Serial", results, nRecordings, 1, serial);
+
+    parallel = ecgBatchRun(recordings, results, nRecordings, nWorkers);
+    summarize("Parallel", results, nRecordings, nWorkers, parallel);
+
+    printf("Speedup: %.2fx on %d workers\n", serial / parallel, nWorkers);
+
+    if(argc > 1) {
+        for(int32_t r = 0; r < nRecordings; r++) {
+            free((void *) recordings[r].samples);
+        }
+    }
+    free(recordings);
+    free(results);
+
+    return 0;
+}
+
+#elif defined(DISPATCH_BENCH)
+
+#include "coreDispatch.h"
+#include "ecgStream.h"
+#include "data/signal_250_3leads.h"
+
+#include <stdio.h>
+#include <time.h>
+
+// Stages that the Pico dispatches to both cores for each window, counted only when their
+// module is compiled in this build: MF, RelEn, R peaks, beat classification, lead combination
+// and delineation (the last two only run on abnormal windows)
+#define DISPATCH_STAGES (DISPATCH_MF + DISPATCH_RELEN + DISPATCH_RPEAK + DISPATCH_BEATCLASS + DISPATCH_RMS_3L + DISPATCH_DEL_3L)
+
+#ifdef MODULE_MF
+#define DISPATCH_MF 1
+#else
+#define DISPATCH_MF 0
+#endif
+#ifdef MODULE_RELEN
+#define DISPATCH_RELEN 1
+#else
+#define DISPATCH_RELEN 0
+#endif
+#ifdef MODULE_RPEAK
+#define DISPATCH_RPEAK 1
+#else
+#define DISPATCH_RPEAK 0
+#endif
+#ifdef MODULE_BEATCLASS
+#define DISPATCH_BEATCLASS 1
+#else
+#define DISPATCH_BEATCLASS 0
+#endif
+#if defined(MODULE_3L) && defined(MODULE_RMS_3L)
+#define DISPATCH_RMS_3L 1
+#else
+#define DISPATCH_RMS_3L 0
+#endif
+#if defined(MODULE_3L) && defined(MODULE_DEL_3L)
+#define DISPATCH_DEL_3L 1
+#else
+#define DISPATCH_DEL_3L 0
+#endif
+
+// The dispatched stages have no body: only the cost of handing them to the second thread is measured
+static void emptyStage(uint32_t id, void *arg) {
+    (void) id;
+    (void) arg;
+}
+
+static double nowSeconds() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main()
+{
+    static ecgStream stream;
+    coreWorker worker;
+    double start, forkJoin, persistent, compute;
+
+    start = nowSeconds();
+    for(int32_t w = 0; w < DISPATCH_WINDOWS; w++) {
+        for(int32_t st = 0; st < DISPATCH_STAGES; st++) {
+            coreForkJoinRun(emptyStage, NULL);
+        }
+    }
+    forkJoin = (nowSeconds() - start) / DISPATCH_WINDOWS;
+
+    coreWorkerStart(&worker);
+    start = nowSeconds();
+    for(int32_t w = 0; w < DISPATCH_WINDOWS; w++) {
+        for(int32_t st = 0; st < DISPATCH_STAGES; st++) {
+            coreWorkerRun(&worker, emptyStage, NULL);
+        }
+    }
+    persistent = (nowSeconds() - start) / DISPATCH_WINDOWS;
+    coreWorkerStop(&worker);
+
+    // Reference: single-thread cost of the pipeline for one window
+    ecgStreamInit(&stream, NULL, NULL);
+    for(int32_t i = 0; i < ECG_VECTOR_SIZE; i += STREAM_CHUNK) {
+        int32_t n = ECG_VECTOR_SIZE - i < STREAM_CHUNK ? ECG_VECTOR_SIZE - i : STREAM_CHUNK;
+        ecgStreamPush(&stream, (const int16_t (*)[NLEADS]) &ecg_3l[i], n);
+    }
+    compute = stream.busySeconds / stream.windows;
+    ecgStreamClose(&stream);
+
+    printf("Dispatch overhead of %d empty stages (the stages compiled in this build):\n", DISPATCH_STAGES);
+    printf("Fork/join per stage:   %8.2f us per window\n", forkJoin * 1e6);
+    printf("Persistent worker:     %8.2f us per window\n", persistent * 1e6);
+    printf("Pipeline compute (single thread, all stages): %8.2f us per window\n", compute * 1e6);
+    printf("Saved: %.2f us per window (%.1f%% of the compute)\n", (forkJoin - persistent) * 1e6, 100.0 * (forkJoin - persistent) / compute);
+
+    return 0;
+}
+
+#elif defined(STREAMING_MODE)
+
+#include "ecgStream.h"
+#include "data/signal_250_3leads.h"
+
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    int64_t beats;
+    int64_t abnormalBeats;
+    int32_t abnormalWindows;
+} streamSummary;
+
+static void onWindow(const ecgWindowResult *result, void *user) {
+    streamSummary *summary = (streamSummary *) user;
+
+    for(int32_t ix = 0; ix < result->nPeaks; ix++) {
+        summary->beats++;
+        if(result->classes[ix] > 0)
+            summary->abnormalBeats++;
+    }
+    summary->abnormalWindows += result->abnormal;
+}
+
+// Input: raw interleaved int16 samples of the NLEADS leads from a file ("-" for stdin).
+// Without arguments the static recording is replayed STREAM_REPEAT times.
+int main(int argc, char *argv[])
+{
+    static ecgStream stream;
+    streamSummary summary = {0, 0, 0};
+    int16_t chunk[STREAM_CHUNK][NLEADS];
+
+    ecgStreamInit(&stream, onWindow, &summary);
+
+    if(argc > 1) {
+        FILE *in = strcmp(argv[1], "-") == 0 ? stdin : fopen(argv[1], "rb");
+        size_t n;
+
+        if(in == NULL) {
+            printf("Cannot open %s\n", argv[1]);
+            return 1;
+        }
+        while((n = fread(chunk, sizeof(chunk[0]), STREAM_CHUNK, in)) > 0) {
+            ecgStreamPush(&stream, (const int16_t (*)[NLEADS]) chunk, (int32_t) n);
+        }
+        if(in != stdin)
+            fclose(in);
+    } else {
+        for(int32_t rep = 0; rep < STREAM_REPEAT; rep++) {
+            for(int32_t i = 0; i < ECG_VECTOR_SIZE; i += STREAM_CHUNK) {
+                int32_t n = ECG_VECTOR_SIZE - i < STREAM_CHUNK ? ECG_VECTOR_SIZE - i : STREAM_CHUNK;
+                ecgStreamPush(&stream, (const int16_t (*)[NLEADS]) &ecg_3l[i], n);
+            }
+        }
+    }
+
+    printf("Samples: %lld, windows: %d (%d abnormal), beats: %lld (%lld abnormal)\n",
+        (long long) stream.samples, stream.windows, summary.abnormalWindows,
+        (long long) summary.beats, (long long) summary.abnormalBeats);
+    printf("Throughput: %.0f samples/s (%.1fx real time)\n",
+        ecgStreamThroughput(&stream), ecgStreamThroughput(&stream) / ECG_SAMPLING_FREQUENCY);
+
+    ecgStreamClose(&stream);
+
+    return 0;
+}
+
+#else
+
 int main()
 {	
     // run the complete app 
@@ -32,3 +286,5 @@ int main()
     
     return 0;
 }
+
+#endif
@@ -24,10 +24,17 @@
 
 #include "morpho_filtering.h"
 #include "defines.h"
+#include "ecgContext.h"
 
-// for runtime - one for each core/lead
-BaselineFilt bl_filt[NLEADS];
-HighFreqFilt250Hz hf_filt[NLEADS];
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
 
 void InitBaseliner(Baseliner* b) {
     b->pos = 0;
@@ -111,6 +118,11 @@ TYPE BaselinerProcess(Baseliner* b, TYPE input) {
 
 void InitHighFreqFilt250Hz(HighFreqFilt250Hz* f) {
     f->pos = 0;
+    for (int i = 0; i < HF_FILT_250HZ_WIN; ++i) {
+        f->original[i] = 0;
+        f->dilation[i] = 0;
+        f->erosion[i] = 0;
+    }
 }
 
 TYPE HighFreqFilt250HzProcess(HighFreqFilt250Hz* f, TYPE input) {
@@ -157,6 +169,9 @@ void filterWindows(int32_t *arg[])
 	int32_t *flag = arg[8];	                // this was used in original ESWEEK to separate first run from subsequent
 	int16_t *i_lead = (int16_t*)arg[9];
 	int32_t *bufferSize = arg[10];
+	// one filter for each lead, kept by the stream between windows
+	BaselineFilt *bl_filt = ((EcgContext*) arg[ARG_CTX])->bl_filt;
+	HighFreqFilt250Hz *hf_filt = ((EcgContext*) arg[ARG_CTX])->hf_filt;
 	
 	if (*flag == 0)	{
 	    InitBaselineFilt(&bl_filt[(*i_lead)]);
@@ -170,3 +185,250 @@ void filterWindows(int32_t *arg[])
 
 
 
+
+
+// Block filter (all leads) ──────────────────────────────────────────────────
+
+#if NLEADS > MF_LANES
+#error "MF_LANES must hold all the leads"
+#endif
+
+// One sample of every lane. With SSE2 the lanes are a 128-bit vector, otherwise
+// a plain array. Intermediate values are int32, as in the C promotions of the
+// per-sample filter, and are truncated to TYPE where that filter stores them.
+#if defined(__SSE2__)
+
+typedef __m128i lanes_t;
+
+#define LANES_LOAD(p)       _mm_loadu_si128((const __m128i*) (p))
+#define LANES_STORE(p, a)   _mm_storeu_si128((__m128i*) (p), (a))
+#define LANES_SET1(x)       _mm_set1_epi32(x)
+#define LANES_ADD(a, b)     _mm_add_epi32((a), (b))
+#define LANES_SUB(a, b)     _mm_sub_epi32((a), (b))
+// Truncation to TYPE (int16_t) and sign extension
+#define LANES_TRUNC(a)      _mm_srai_epi32(_mm_slli_epi32((a), 16), 16)
+// Division by 2 rounding toward zero, as the C operator
+#define LANES_HALF(a)       _mm_srai_epi32(_mm_add_epi32((a), _mm_srli_epi32((a), 31)), 1)
+
+#if defined(__SSE4_1__)
+#define LANES_MIN(a, b)     _mm_min_epi32((a), (b))
+#define LANES_MAX(a, b)     _mm_max_epi32((a), (b))
+#else
+static inline lanes_t lanes_min(lanes_t a, lanes_t b) {
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+}
+static inline lanes_t lanes_max(lanes_t a, lanes_t b) {
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+}
+#define LANES_MIN(a, b)     lanes_min((a), (b))
+#define LANES_MAX(a, b)     lanes_max((a), (b))
+#endif
+
+#else
+
+typedef struct {
+    int32_t v[MF_LANES];
+} lanes_t;
+
+static inline lanes_t lanes_load(const int32_t* p) {
+    lanes_t a;
+    for (int l = 0; l < MF_LANES; ++l) a.v[l] = p[l];
+    return a;
+}
+static inline void lanes_store(int32_t* p, lanes_t a) {
+    for (int l = 0; l < MF_LANES; ++l) p[l] = a.v[l];
+}
+static inline lanes_t lanes_set1(int32_t x) {
+    lanes_t a;
+    for (int l = 0; l < MF_LANES; ++l) a.v[l] = x;
+    return a;
+}
+#define LANES_OP(name, expr) \
+static inline lanes_t name(lanes_t a, lanes_t b) { \
+    lanes_t r; \
+    for (int l = 0; l < MF_LANES; ++l) r.v[l] = (expr); \
+    return r; \
+}
+LANES_OP(lanes_add, a.v[l] + b.v[l])
+LANES_OP(lanes_sub, a.v[l] - b.v[l])
+LANES_OP(lanes_min, a.v[l] < b.v[l] ? a.v[l] : b.v[l])
+LANES_OP(lanes_max, a.v[l] > b.v[l] ? a.v[l] : b.v[l])
+static inline lanes_t lanes_trunc(lanes_t a) {
+    for (int l = 0; l < MF_LANES; ++l) a.v[l] = (TYPE) a.v[l];
+    return a;
+}
+static inline lanes_t lanes_half(lanes_t a) {
+    for (int l = 0; l < MF_LANES; ++l) a.v[l] = a.v[l] / 2;
+    return a;
+}
+
+#define LANES_LOAD(p)       lanes_load((const int32_t*) (p))
+#define LANES_STORE(p, a)   lanes_store((int32_t*) (p), (a))
+#define LANES_SET1(x)       lanes_set1(x)
+#define LANES_ADD(a, b)     lanes_add((a), (b))
+#define LANES_SUB(a, b)     lanes_sub((a), (b))
+#define LANES_TRUNC(a)      lanes_trunc(a)
+#define LANES_HALF(a)       lanes_half(a)
+#define LANES_MIN(a, b)     lanes_min((a), (b))
+#define LANES_MAX(a, b)     lanes_max((a), (b))
+
+#endif
+
+void InitMorphBlockFilt(MorphBlockFilt* f) {
+    // An empty window of the queues is equivalent to a window padded with
+    // the neutral element of the operation
+    for (int i = 0; i < OPENING_WIN-1; ++i)
+        for (int l = 0; l < MF_LANES; ++l) f->ero0[i][l] = INT32_MAX;
+    for (int i = 0; i < OPENING_WIN+CLOSING_WIN-2; ++i)
+        for (int l = 0; l < MF_LANES; ++l) f->dil1[i][l] = INT32_MIN;
+    for (int i = 0; i < CLOSING_WIN-1; ++i)
+        for (int l = 0; l < MF_LANES; ++l) f->ero2[i][l] = INT32_MAX;
+    // The delay line and the high frequency filter start from zeros
+    memset(f->delay, 0, sizeof(f->delay));
+    memset(f->hf_in, 0, sizeof(f->hf_in));
+    memset(f->hf_dil, 0, sizeof(f->hf_dil));
+    memset(f->hf_ero, 0, sizeof(f->hf_ero));
+}
+
+/**
+ * van Herk/Gil-Werman running minimum (isMax == 0) or maximum of width win.
+ * ext holds win-1 samples of history followed by n new samples, out receives n values.
+ * ext is split in segments of win samples: g is the running extreme from the start
+ * of each segment and h from its end, so any window is covered by h of its first
+ * sample and g of its last one, with 3 operations per sample whatever the width.
+ */
+static void vhgw(int32_t (*ext)[MF_LANES], int32_t (*out)[MF_LANES], int32_t n, int32_t win, int isMax,
+                 int32_t (*g)[MF_LANES], int32_t (*h)[MF_LANES]) {
+    int32_t len = n + win - 1;
+
+    for (int32_t s = 0; s < len; s += win) {
+        int32_t e = (s + win < len) ? s + win : len;
+        lanes_t acc = LANES_LOAD(ext[s]);
+        LANES_STORE(g[s], acc);
+        for (int32_t j = s + 1; j < e; ++j) {
+            acc = isMax ? LANES_MAX(acc, LANES_LOAD(ext[j])) : LANES_MIN(acc, LANES_LOAD(ext[j]));
+            LANES_STORE(g[j], acc);
+        }
+        acc = LANES_LOAD(ext[e-1]);
+        LANES_STORE(h[e-1], acc);
+        for (int32_t j = e - 2; j >= s; --j) {
+            acc = isMax ? LANES_MAX(acc, LANES_LOAD(ext[j])) : LANES_MIN(acc, LANES_LOAD(ext[j]));
+            LANES_STORE(h[j], acc);
+        }
+    }
+    for (int32_t i = 0; i < n; ++i) {
+        lanes_t a = LANES_LOAD(h[i]);
+        lanes_t b = LANES_LOAD(g[i + win - 1]);
+        LANES_STORE(out[i], isMax ? LANES_MAX(a, b) : LANES_MIN(a, b));
+    }
+}
+
+// Appends n new samples to a stage history of hist samples and keeps the last hist as the new history
+static void pushHistory(int32_t (*history)[MF_LANES], int32_t hist, int32_t (*ext)[MF_LANES], int32_t n) {
+    memcpy(history, ext[n], hist * sizeof(history[0]));
+}
+
+#define EXT_SIZE (MF_BLOCK + OPENING_WIN + CLOSING_WIN - 2)
+
+static void MorphBlockFiltChunk(MorphBlockFilt* f, int32_t (*x)[MF_LANES], int32_t n) {
+    static const int32_t se[HF_FILT_250HZ_WIN] = {0, 1, 5, 1, 0};
+    int32_t ext[EXT_SIZE][MF_LANES];
+    int32_t g[EXT_SIZE][MF_LANES];
+    int32_t h[EXT_SIZE][MF_LANES];
+    int32_t y[MF_BLOCK + HF_HIST][MF_LANES];
+    int32_t dil[MF_BLOCK + HF_HIST][MF_LANES];
+    int32_t ero[MF_BLOCK + HF_HIST][MF_LANES];
+    int32_t base[MF_BLOCK][MF_LANES];
+
+    // Baseline: erosion of OPENING_WIN, dilation of OPENING_WIN+CLOSING_WIN-1, erosion of CLOSING_WIN
+    memcpy(ext, f->ero0, sizeof(f->ero0));
+    memcpy(ext[OPENING_WIN-1], x, n * sizeof(x[0]));
+    vhgw(ext, base, n, OPENING_WIN, 0, g, h);
+    pushHistory(f->ero0, OPENING_WIN-1, ext, n);
+
+    memcpy(ext, f->dil1, sizeof(f->dil1));
+    memcpy(ext[OPENING_WIN+CLOSING_WIN-2], base, n * sizeof(base[0]));
+    vhgw(ext, base, n, OPENING_WIN+CLOSING_WIN-1, 1, g, h);
+    pushHistory(f->dil1, OPENING_WIN+CLOSING_WIN-2, ext, n);
+
+    memcpy(ext, f->ero2, sizeof(f->ero2));
+    memcpy(ext[CLOSING_WIN-1], base, n * sizeof(base[0]));
+    vhgw(ext, base, n, CLOSING_WIN, 0, g, h);
+    pushHistory(f->ero2, CLOSING_WIN-1, ext, n);
+
+    // Baseline removal from the input delayed by BL_LATENCY
+    memcpy(ext, f->delay, sizeof(f->delay));
+    memcpy(ext[BL_LATENCY], x, n * sizeof(x[0]));
+    memcpy(y, f->hf_in, sizeof(f->hf_in));
+    for (int32_t i = 0; i < n; ++i) {
+        LANES_STORE(y[i + HF_HIST], LANES_TRUNC(LANES_SUB(LANES_LOAD(ext[i]), LANES_LOAD(base[i]))));
+    }
+    pushHistory(f->delay, BL_LATENCY, ext, n);
+
+    // High frequency filter: dilation and erosion by se, then closing and opening over HF_FILT_250HZ_WIN
+    memcpy(dil, f->hf_dil, sizeof(f->hf_dil));
+    memcpy(ero, f->hf_ero, sizeof(f->hf_ero));
+    for (int32_t i = 0; i < n; ++i) {
+        lanes_t yk = LANES_LOAD(y[i + HF_HIST]);
+        lanes_t d = yk;
+        lanes_t e = yk;
+        for (int k = 1; k < HF_FILT_250HZ_WIN; ++k) {
+            yk = LANES_LOAD(y[i + HF_HIST - k]);
+            d = LANES_MAX(d, LANES_ADD(yk, LANES_SET1(se[k])));
+            e = LANES_MIN(e, LANES_SUB(yk, LANES_SET1(se[k])));
+        }
+        LANES_STORE(dil[i + HF_HIST], LANES_TRUNC(d));
+        LANES_STORE(ero[i + HF_HIST], LANES_TRUNC(e));
+    }
+    for (int32_t i = 0; i < n; ++i) {
+        lanes_t closing = LANES_LOAD(dil[i]);
+        lanes_t opening = LANES_LOAD(ero[i]);
+        for (int k = 1; k < HF_FILT_250HZ_WIN; ++k) {
+            closing = LANES_MIN(closing, LANES_LOAD(dil[i + k]));
+            opening = LANES_MAX(opening, LANES_LOAD(ero[i + k]));
+        }
+        LANES_STORE(x[i], LANES_TRUNC(LANES_HALF(LANES_ADD(opening, closing))));
+    }
+    pushHistory(f->hf_in, HF_HIST, y, n);
+    pushHistory(f->hf_dil, HF_HIST, dil, n);
+    pushHistory(f->hf_ero, HF_HIST, ero, n);
+}
+
+void MorphBlockFiltProcess(MorphBlockFilt* f, TYPE* data, int32_t stride, int32_t nLeads, int32_t n) {
+    int32_t x[MF_BLOCK][MF_LANES];
+
+    for (int32_t start = 0; start < n; start += MF_BLOCK) {
+        int32_t len = (n - start < MF_BLOCK) ? n - start : MF_BLOCK;
+
+        // Transpose the leads into lanes, the unused lanes are filtered as zeros
+        for (int32_t i = 0; i < len; ++i) {
+            for (int32_t l = 0; l < MF_LANES; ++l) {
+                x[i][l] = (l < nLeads) ? data[l*stride + start + i] : 0;
+            }
+        }
+
+        MorphBlockFiltChunk(f, x, len);
+
+        for (int32_t i = 0; i < len; ++i) {
+            for (int32_t l = 0; l < nLeads; ++l) {
+                data[l*stride + start + i] = (TYPE) x[i][l];
+            }
+        }
+    }
+}
+
+void filterWindowsNLeads(int32_t *arg[])
+{
+	int16_t *ecg_buffer = (int16_t*) arg[0];
+	int32_t *flag = arg[8];
+	int32_t *bufferSize = arg[10];
+	MorphBlockFilt *mf_filt = &((EcgContext*) arg[ARG_CTX])->mf_filt;
+
+	if (*flag == 0)	{
+	    InitMorphBlockFilt(mf_filt);
+	}
+
+	MorphBlockFiltProcess(mf_filt, ecg_buffer, dim, NLEADS, *bufferSize);
+}
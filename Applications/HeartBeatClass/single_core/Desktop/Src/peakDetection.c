@@ -23,19 +23,10 @@
 
 
 #include "peakDetection.h"
+#include "ecgContext.h"
 
 #define ABS(N) ((N<0)?(-N):(N))
 
-//Variables used to detect peaks
-uint32_t lastPeakIndex = 0;
-int16_t lastPeakAmplitude = 0;
-uint32_t numberOfAnalyzedWindows = 0;
-uint8_t lastPeakWasIncomplete = 0;
-uint16_t lastPeakWidth = INT16_MAX;
-uint32_t lastPeakIndex_BF = 0;
-int16_t lastPeakWidth_BF = 0;
-int16_t lastPeakAmplitude_BF = 0;
-
 void maxAndMinandMean(int16_t ecg[BUFFER_SIZE], int16_t* max, int16_t* min, int32_t* avg) {
 	*max = ecg[0];
 	*min = ecg[0];
@@ -94,27 +85,28 @@ uint32_t getIndexOfMinInRange(int16_t ecg[BUFFER_SIZE], uint16_t startIndex, uin
 	return result;
 }
 
-void resetPeakDetection() {
-	lastPeakIndex = 0;
-	lastPeakAmplitude = 0;
-	numberOfAnalyzedWindows = 0;
-	lastPeakWasIncomplete = 0;
+void resetPeakDetection(PeakDetState *p) {
+	p->lastPeakIndex = 0;
+	p->lastPeakAmplitude = 0;
+	p->numberOfAnalyzedWindows = 0;
+	p->lastPeakWasIncomplete = 0;
 
-	lastPeakIndex_BF = 0;
-	lastPeakWidth_BF = 0;
-	lastPeakAmplitude_BF = 0;
+	p->lastPeakIndex_BF = 0;
+	p->lastPeakWidth_BF = 0;
+	p->lastPeakAmplitude_BF = 0;
 
-	lastPeakWidth = INT16_MAX;
+	p->lastPeakWidth = INT16_MAX;
 }
 
 //Get the indices of the R peaks using a hysteresis comparator (using two thresholds to determine where peaks are located)
-//Inputs: ecgWindow - a window of the ECG
+//Inputs: p - peak detection state of the stream, holding:
 //        lastPeakIndex - the index of the peak located at the last index of the previous window
 //		  lastPeakAmplitude - amplitude of the aforementioned peak
 //		  numberOfAnalyzedWindows - the number of windows that have been analyzed so far. Used to compute peak indices relative to the beginning of the signal
+//		  ecgWindow - a window of the ECG
 //Output: array of peak indices 
 
-void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], uint8_t numberOfFoundPeaks, uint32_t *output) {
+void getPeakIndicesThroughHysteresisComparator(PeakDetState *p, int16_t ecgWindow[BUFFER_SIZE], uint8_t numberOfFoundPeaks, uint32_t *output) {
 	numberOfFoundPeaks = 0;
 	uint8_t thisWindowIsIncomplete = 0;
 
@@ -123,8 +115,8 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 	int16_t peakWidths[TEMPORARY_PEAK_BUFFER_SIZE];
 
 	//Index and amplitude of the last peak of the previous window
-	uint32_t lastPeakIndexTemp = lastPeakIndex;
-	int16_t lastPeakAmplitudeTemp = lastPeakAmplitude;
+	uint32_t lastPeakIndexTemp = p->lastPeakIndex;
+	int16_t lastPeakAmplitudeTemp = p->lastPeakAmplitude;
 
 	//Generate the hysteresis thresholds
 	int32_t avg = 0;
@@ -168,12 +160,12 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 				analyzingPeak = 0;
 
 				//There is a previous peak that needs to be finished
-				if (startIndex < 0.03*ECG_SAMPLING_FREQUENCY && lastPeakWasIncomplete == 1 && numberOfAnalyzedPeaks == 0) {
+				if (startIndex < 0.03*ECG_SAMPLING_FREQUENCY && p->lastPeakWasIncomplete == 1 && numberOfAnalyzedPeaks == 0) {
 					uint32_t minIndex = getIndexOfMinInRange(ecgWindow, startIndex, endIndex);
-					uint16_t peakWidth = lastPeakWidth + endIndex - startIndex;
+					uint16_t peakWidth = p->lastPeakWidth + endIndex - startIndex;
 
 					if (ecgWindow[minIndex] < lastPeakAmplitudeTemp) { //this peak is "more negative" than the previous one
-						tempOutput[numberOfAnalyzedPeaks] = minIndex + numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
+						tempOutput[numberOfAnalyzedPeaks] = minIndex + p->numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
 						peakAmplitudes[numberOfAnalyzedPeaks] = ecgWindow[minIndex];
 					}
 					else { //last peak amplitude was "more negative"
@@ -184,17 +176,17 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 					numberOfAnalyzedPeaks++;
 
 				}//The previous peak finished at the boundary and its value needs to be recorded
-				else if (lastPeakWasIncomplete == 1 && numberOfAnalyzedPeaks == 0) {
+				else if (p->lastPeakWasIncomplete == 1 && numberOfAnalyzedPeaks == 0) {
 					//Save previous peak
 					tempOutput[numberOfAnalyzedPeaks] = lastPeakIndexTemp;
 					peakAmplitudes[numberOfAnalyzedPeaks] = lastPeakAmplitudeTemp;
-					peakWidths[numberOfAnalyzedPeaks] = lastPeakWidth;
+					peakWidths[numberOfAnalyzedPeaks] = p->lastPeakWidth;
 					numberOfAnalyzedPeaks++;
 
 					//Save new peak
 					uint32_t minIndex = getIndexOfMinInRange(ecgWindow, startIndex, endIndex);
 					uint16_t peakWidth = endIndex - startIndex;
-					tempOutput[numberOfAnalyzedPeaks] = minIndex + numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
+					tempOutput[numberOfAnalyzedPeaks] = minIndex + p->numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
 					peakAmplitudes[numberOfAnalyzedPeaks] = ecgWindow[minIndex];
 					peakWidths[numberOfAnalyzedPeaks] = peakWidth;
 					numberOfAnalyzedPeaks++;
@@ -202,7 +194,7 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 				else {//We do not need to care about previous peaks
 					uint32_t minIndex = getIndexOfMinInRange(ecgWindow, startIndex, endIndex);
 					uint16_t peakWidth = endIndex - startIndex;
-					tempOutput[numberOfAnalyzedPeaks] = minIndex + numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
+					tempOutput[numberOfAnalyzedPeaks] = minIndex + p->numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
 					peakAmplitudes[numberOfAnalyzedPeaks] = ecgWindow[minIndex];
 					peakWidths[numberOfAnalyzedPeaks] = peakWidth;
 					numberOfAnalyzedPeaks++;
@@ -211,9 +203,9 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 			}
 			else if (analyzingPeak == 1 && i == BUFFER_SIZE - 1) { //peak is being analyzed when window ends
 				uint32_t minIndex = getIndexOfMinInRange(ecgWindow, startIndex, BUFFER_SIZE - 1);
-				lastPeakAmplitude = ecgWindow[minIndex];
-				lastPeakIndex = minIndex + numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
-				lastPeakWidth = BUFFER_SIZE - 1 - startIndex;
+				p->lastPeakAmplitude = ecgWindow[minIndex];
+				p->lastPeakIndex = minIndex + p->numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
+				p->lastPeakWidth = BUFFER_SIZE - 1 - startIndex;
 				thisWindowIsIncomplete = 1;
 			}
 		}
@@ -245,12 +237,12 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 				analyzingPeak = 0;
 
 				//There is a previous peak that needs to be finished
-				if (startIndex < 0.03*ECG_SAMPLING_FREQUENCY && lastPeakWasIncomplete == 1 && numberOfAnalyzedPeaks == 0) {
+				if (startIndex < 0.03*ECG_SAMPLING_FREQUENCY && p->lastPeakWasIncomplete == 1 && numberOfAnalyzedPeaks == 0) {
 					uint32_t maxIndex = getIndexOfMaxInRange(ecgWindow, startIndex, endIndex);
-					uint16_t peakWidth = lastPeakWidth + endIndex - startIndex;
+					uint16_t peakWidth = p->lastPeakWidth + endIndex - startIndex;
 
 					if (ecgWindow[maxIndex] > lastPeakAmplitudeTemp) { //this peak is greater than the previous one
-						tempOutput[numberOfAnalyzedPeaks] = maxIndex + numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
+						tempOutput[numberOfAnalyzedPeaks] = maxIndex + p->numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
 						peakAmplitudes[numberOfAnalyzedPeaks] = ecgWindow[maxIndex];
 					}
 					else { //last peak amplitude was greater
@@ -259,20 +251,20 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 					}
 					peakWidths[numberOfAnalyzedPeaks] = peakWidth;
 					numberOfAnalyzedPeaks++;
-					lastPeakWidth = peakWidth;
+					p->lastPeakWidth = peakWidth;
 
 				}//The previous peak finished at the boundary and its value needs to be recorded
-				else if (lastPeakWasIncomplete == 1 && numberOfAnalyzedPeaks == 0) {
+				else if (p->lastPeakWasIncomplete == 1 && numberOfAnalyzedPeaks == 0) {
 					//Save previous peak
 					tempOutput[numberOfAnalyzedPeaks] = lastPeakIndexTemp;
 					peakAmplitudes[numberOfAnalyzedPeaks] = lastPeakAmplitudeTemp;
-					peakWidths[numberOfAnalyzedPeaks] = lastPeakWidth;
+					peakWidths[numberOfAnalyzedPeaks] = p->lastPeakWidth;
 					numberOfAnalyzedPeaks++;
 
 					//Save new peak
 					uint32_t maxIndex = getIndexOfMaxInRange(ecgWindow, startIndex, endIndex);
 					uint16_t peakWidth = endIndex - startIndex;
-					tempOutput[numberOfAnalyzedPeaks] = maxIndex + numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
+					tempOutput[numberOfAnalyzedPeaks] = maxIndex + p->numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
 					peakAmplitudes[numberOfAnalyzedPeaks] = ecgWindow[maxIndex];
 					peakWidths[numberOfAnalyzedPeaks] = peakWidth;
 					numberOfAnalyzedPeaks++;
@@ -280,7 +272,7 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 				else {//We do not need to care about previous peaks
 					uint32_t maxIndex = getIndexOfMaxInRange(ecgWindow, startIndex, endIndex);
 					uint16_t peakWidth = endIndex - startIndex;
-					tempOutput[numberOfAnalyzedPeaks] = maxIndex + numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
+					tempOutput[numberOfAnalyzedPeaks] = maxIndex + p->numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
 					peakAmplitudes[numberOfAnalyzedPeaks] = ecgWindow[maxIndex];
 					peakWidths[numberOfAnalyzedPeaks] = peakWidth;
 					numberOfAnalyzedPeaks++;
@@ -290,9 +282,9 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 			}
 			else if (analyzingPeak == 1 && i == BUFFER_SIZE - 1) { //peak is being analyzed when window ends
 				uint32_t maxIndex = getIndexOfMaxInRange(ecgWindow, startIndex, BUFFER_SIZE - 1);
-				lastPeakAmplitude = ecgWindow[maxIndex];
-				lastPeakIndex = maxIndex + numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
-				lastPeakWidth = BUFFER_SIZE - 1 - startIndex;
+				p->lastPeakAmplitude = ecgWindow[maxIndex];
+				p->lastPeakIndex = maxIndex + p->numberOfAnalyzedWindows * BUFFER_SIZE + LONG_WINDOW / 2 + 1;
+				p->lastPeakWidth = BUFFER_SIZE - 1 - startIndex;
 				thisWindowIsIncomplete = 1;
 			}
 		}
@@ -302,16 +294,16 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 	if (numberOfAnalyzedPeaks > 1) {
 	 
 	 	//add last peak of the previous BS
-		if(numberOfAnalyzedWindows>0){
+		if(p->numberOfAnalyzedWindows>0){
 			for(int32_t i = numberOfAnalyzedPeaks; i > 0; i--){
 				tempOutput[i] = tempOutput[i-1];
 				peakWidths[i] = peakWidths[i-1];
 				peakAmplitudes[i] = peakAmplitudes[i-1];
 			}
 			numberOfAnalyzedPeaks++;
-			tempOutput[0] = lastPeakIndex_BF;
-			peakWidths[0] = lastPeakWidth_BF;
-			peakAmplitudes[0] = lastPeakAmplitude_BF;
+			tempOutput[0] = p->lastPeakIndex_BF;
+			peakWidths[0] = p->lastPeakWidth_BF;
+			peakAmplitudes[0] = p->lastPeakAmplitude_BF;
 		}
 
 		for (int16_t j = (numberOfAnalyzedPeaks - 1); j > 0; j--) {
@@ -363,25 +355,24 @@ void getPeakIndicesThroughHysteresisComparator(int16_t ecgWindow[BUFFER_SIZE], u
 			numberOfFoundPeaks = numberOfFoundPeaks + 1; //get rid of redundant variable
 			output[numberOfActualPeaks] = tempOutput[m];
 			numberOfActualPeaks++;
-			lastPeakIndex_BF = tempOutput[m] ;
-			lastPeakWidth_BF = peakWidths[m];
-			lastPeakAmplitude_BF = peakAmplitudes[m];
+			p->lastPeakIndex_BF = tempOutput[m] ;
+			p->lastPeakWidth_BF = peakWidths[m];
+			p->lastPeakAmplitude_BF = peakAmplitudes[m];
 		}
 	}
 
-	lastPeakWasIncomplete = thisWindowIsIncomplete; 
+	p->lastPeakWasIncomplete = thisWindowIsIncomplete; 
 }
 
-uint16_t startnext = 0;
-
 void getPeaks_w(int32_t *arg[]){
 
 	int16_t* xRE = (int16_t*) arg[1];
 	uint32_t* indicesRpeaks = (uint32_t*) arg[2];
+	PeakDetState *p = &((EcgContext*) arg[ARG_CTX])->peaks;
 	uint32_t outputSingleBuff[MAX_BEATS_PER_MIN];
 	//This should be set to 0 every time we delineate 8 beats
-	startnext = 0;
-	numberOfAnalyzedWindows = 0;
+	uint16_t startnext = 0;
+	p->numberOfAnalyzedWindows = 0;
  
 	uint8_t numberOfDetectedPeaks =0;
 
@@ -393,18 +384,19 @@ void getPeaks_w(int32_t *arg[]){
 			outputSingleBuff[i] = 0;
 		}
 	  
-		getPeakIndicesThroughHysteresisComparator(&xRE[LONG_WINDOW + idx*(BUFFER_SIZE)], numberOfDetectedPeaks, outputSingleBuff);
+		getPeakIndicesThroughHysteresisComparator(p, &xRE[LONG_WINDOW + idx*(BUFFER_SIZE)], numberOfDetectedPeaks, outputSingleBuff);
 		for(int32_t m=0; m<MAX_BEATS_PER_MIN; m++)
 		{
 			if(outputSingleBuff[m] > 0)
 			{
-				if (indicesRpeaks[startnext-1] != outputSingleBuff[m])
+				// indicesRpeaks holds H_B peaks plus the terminating 0
+				if ((startnext == 0 || indicesRpeaks[startnext-1] != outputSingleBuff[m]) && startnext < H_B)
 				{
 					indicesRpeaks[startnext] = outputSingleBuff[m]; 
 					startnext++;
 				}			
 			}
 		}
-		numberOfAnalyzedWindows++;
+		p->numberOfAnalyzedWindows++;
 	} 
 }
@@ -24,53 +24,43 @@
 
 #include "relativeEnergy.h"
 #include "delineationConditioned.h"
+#include "ecgContext.h"
 #include "stdlib.h"
 
-//Previously-found short and long energies for RelEn signal generation
-uint32_t lastShortEnergy = 0;
-uint32_t lastLongEnergy = 0;
-//circular ecg buffer and its pointers
-int16_t *ecgBuffer_re;
-uint16_t ecgBufferPointer = 0;
-uint16_t lastEcgBufferPointer = 0;
-uint16_t currentShortWindowPointer = 0;
-uint16_t lastShortWindowPointer = 0;
-uint16_t relEnBufferPointer = (LONG_WINDOW / 2);
-int8_t start = 1;
 uint16_t multiplier = 10000;
 
-void clearAndResetRelEn() {
+void clearAndResetRelEn(RelEnState *st) {
 	//Previously-found short and long energies for RelEn signal generation
-	lastShortEnergy = 0;
-	lastLongEnergy = 0;
+	st->lastShortEnergy = 0;
+	st->lastLongEnergy = 0;
 
 	//circular ecg buffer and its pointers
-	ecgBufferPointer = 0;
-	lastEcgBufferPointer = 0;
-	currentShortWindowPointer = 0;
-	lastShortWindowPointer = 0;
-	relEnBufferPointer = (LONG_WINDOW / 2);
-	start = 1;
+	st->ecgBufferPointer = 0;
+	st->lastEcgBufferPointer = 0;
+	st->currentShortWindowPointer = 0;
+	st->lastShortWindowPointer = 0;
+	st->relEnBufferPointer = (LONG_WINDOW / 2);
+	st->start = 1;
 }
 
 //This is the main function where rel-En coefficients are generated
-uint16_t getRelEnCoefficients(uint8_t fillingBuffer, int16_t sample) {
+uint16_t getRelEnCoefficients(RelEnState *st, uint8_t fillingBuffer, int16_t sample) {
 
 	//If this is the first window, start computing long and short energy sum
 
 	if (fillingBuffer == 1) {
 	 	
-		if (ecgBufferPointer >= (LONG_WINDOW / 2 - SHORT_WINDOW_HALF) && ecgBufferPointer <= (LONG_WINDOW / 2 + SHORT_WINDOW_HALF)) {
-			lastShortEnergy += (sample) * (sample);
+		if (st->ecgBufferPointer >= (LONG_WINDOW / 2 - SHORT_WINDOW_HALF) && st->ecgBufferPointer <= (LONG_WINDOW / 2 + SHORT_WINDOW_HALF)) {
+			st->lastShortEnergy += (sample) * (sample);
 		}
 
-		lastLongEnergy += (sample) * (sample);
+		st->lastLongEnergy += (sample) * (sample);
 		
 
-		if (ecgBufferPointer == LONG_WINDOW - 1) {
-			lastEcgBufferPointer = 0;
-			currentShortWindowPointer = LONG_WINDOW / 2 + SHORT_WINDOW_HALF + 1;
-			lastShortWindowPointer = LONG_WINDOW / 2 - SHORT_WINDOW_HALF;
+		if (st->ecgBufferPointer == LONG_WINDOW - 1) {
+			st->lastEcgBufferPointer = 0;
+			st->currentShortWindowPointer = LONG_WINDOW / 2 + SHORT_WINDOW_HALF + 1;
+			st->lastShortWindowPointer = LONG_WINDOW / 2 - SHORT_WINDOW_HALF;
 		}
  
 		return 0;
@@ -79,33 +69,33 @@ uint16_t getRelEnCoefficients(uint8_t fillingBuffer, int16_t sample) {
 	else { //If not, compute Rel-En coefficient c(n)
 
  
-		lastLongEnergy = lastLongEnergy + (ecgBuffer_re[ecgBufferPointer] * ecgBuffer_re[ecgBufferPointer]) - (ecgBuffer_re[lastEcgBufferPointer] * ecgBuffer_re[lastEcgBufferPointer]);
+		st->lastLongEnergy = st->lastLongEnergy + (st->ecgBuffer_re[st->ecgBufferPointer] * st->ecgBuffer_re[st->ecgBufferPointer]) - (st->ecgBuffer_re[st->lastEcgBufferPointer] * st->ecgBuffer_re[st->lastEcgBufferPointer]);
 
-		lastShortEnergy = lastShortEnergy + (ecgBuffer_re[currentShortWindowPointer]*ecgBuffer_re[currentShortWindowPointer]) - (ecgBuffer_re[lastShortWindowPointer]*ecgBuffer_re[lastShortWindowPointer]);
+		st->lastShortEnergy = st->lastShortEnergy + (st->ecgBuffer_re[st->currentShortWindowPointer]*st->ecgBuffer_re[st->currentShortWindowPointer]) - (st->ecgBuffer_re[st->lastShortWindowPointer]*st->ecgBuffer_re[st->lastShortWindowPointer]);
 
-		lastEcgBufferPointer++;
-		if (lastEcgBufferPointer > LONG_WINDOW) {
-			lastEcgBufferPointer = 0;
+		st->lastEcgBufferPointer++;
+		if (st->lastEcgBufferPointer > LONG_WINDOW) {
+			st->lastEcgBufferPointer = 0;
 		}
-		currentShortWindowPointer++;
-		if (currentShortWindowPointer > LONG_WINDOW) {
-			currentShortWindowPointer = 0;
+		st->currentShortWindowPointer++;
+		if (st->currentShortWindowPointer > LONG_WINDOW) {
+			st->currentShortWindowPointer = 0;
 		}
-		lastShortWindowPointer++;
-		if (lastShortWindowPointer > LONG_WINDOW) {
-			lastShortWindowPointer = 0;
+		st->lastShortWindowPointer++;
+		if (st->lastShortWindowPointer > LONG_WINDOW) {
+			st->lastShortWindowPointer = 0;
 		}
  
 		uint16_t result = 0;
  
-		if (lastLongEnergy > multiplier) {
-			result = lastShortEnergy / (lastLongEnergy / multiplier);
+		if (st->lastLongEnergy > multiplier) {
+			result = st->lastShortEnergy / (st->lastLongEnergy / multiplier);
 		}
 		else {
-			if(lastLongEnergy != 0){
-				result = (lastShortEnergy * multiplier) / lastLongEnergy;
+			if(st->lastLongEnergy != 0){
+				result = (st->lastShortEnergy * multiplier) / st->lastLongEnergy;
 			} else {
-				result = (lastShortEnergy * multiplier);
+				result = (st->lastShortEnergy * multiplier);
 			}
 		}
 
@@ -119,48 +109,45 @@ void relEn_w(int32_t *arg[]){
 
 	int16_t *ecg_w = (int16_t*) arg[0];
 	int16_t *out = (int16_t*) arg[1];
+	RelEnState *st = &((EcgContext*) arg[ARG_CTX])->relEn;
 	int16_t rawRelEn = 0;
 
-	ecgBuffer_re = (int16_t*) malloc((LONG_WINDOW + 1) * sizeof(int16_t));
-
     for(int32_t j = 0; j < dim; j++)
     {	
 		rawRelEn = 0; 
 
-    	if (start == 0)
+    	if (st->start == 0)
     	{ 
-			ecgBuffer_re[ecgBufferPointer] = ecg_w[j];
+			st->ecgBuffer_re[st->ecgBufferPointer] = ecg_w[j];
   
-			uint16_t relEnOutput = getRelEnCoefficients(start, ecg_w[j]);
+			uint16_t relEnOutput = getRelEnCoefficients(st, st->start, ecg_w[j]);
 
-			int16_t currentECG = ecgBuffer_re[relEnBufferPointer];
+			int16_t currentECG = st->ecgBuffer_re[st->relEnBufferPointer];
 			rawRelEn = (relEnOutput * currentECG) / multiplier;
-			ecgBufferPointer++;
-			relEnBufferPointer++;
+			st->ecgBufferPointer++;
+			st->relEnBufferPointer++;
  
 		} //The buffer is initially being filled
 		else {
  		 
-			ecgBuffer_re[ecgBufferPointer] = ecg_w[j];
+			st->ecgBuffer_re[st->ecgBufferPointer] = ecg_w[j];
  
-			uint16_t relEnOutput = getRelEnCoefficients(start, ecg_w[j]);
+			uint16_t relEnOutput = getRelEnCoefficients(st, st->start, ecg_w[j]);
 				
-			if (ecgBufferPointer == LONG_WINDOW - 1) {
-				rawRelEn = (relEnOutput * ecgBuffer_re[relEnBufferPointer]) / multiplier;
-				start = 0;
-				relEnBufferPointer++;
+			if (st->ecgBufferPointer == LONG_WINDOW - 1) {
+				rawRelEn = (relEnOutput * st->ecgBuffer_re[st->relEnBufferPointer]) / multiplier;
+				st->start = 0;
+				st->relEnBufferPointer++;
 			}
-			ecgBufferPointer++;
+			st->ecgBufferPointer++;
 		} 
 
-		if (relEnBufferPointer > LONG_WINDOW) {
-			relEnBufferPointer = 0;
+		if (st->relEnBufferPointer > LONG_WINDOW) {
+			st->relEnBufferPointer = 0;
 		}
-		if (ecgBufferPointer > LONG_WINDOW) {
-			ecgBufferPointer = 0;
+		if (st->ecgBufferPointer > LONG_WINDOW) {
+			st->ecgBufferPointer = 0;
 		}
 		out[j] = rawRelEn;
 	}
-
-	free(ecgBuffer_re);
 }
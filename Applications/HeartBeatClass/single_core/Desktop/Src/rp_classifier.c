@@ -29,6 +29,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <limits.h>
+#include <pthread.h>
 
 /*
     polygmf:
@@ -151,7 +152,7 @@ void rescaledProductory(uint16_t coeffs[NUM_COEFFICIENTS], uint16_t output[NUM_C
         max = 0;
         for(c=0; c<NUM_CLASSES; c++)
         {
-            gaussians[c] = output[c] * polygmf(coeffs[i], c, i);
+            gaussians[c] = (uint32_t)output[c] * polygmf(coeffs[i], c, i);
             if(gaussians[c] > max)
                 max = gaussians[c];    
         }
@@ -229,7 +230,19 @@ This function resamples the input signal and normalize it into the range that th
 expects. In order to do so the function assumes that the signal is centered in 0, in
 other words, the basline and low frequency components have been removed from the signal
 */
+static void normalizeAndResampleStrided(int16_t input[], uint16_t start, uint16_t mask, uint16_t *output, int32_t stride);
+
 void normalizeAndResampleInput(int16_t input[], uint16_t start, uint16_t mask, uint16_t output[OUTPUT_FREQUENCY])
+{
+    normalizeAndResampleStrided(input, start, mask, output, 1);
+}
+
+/*
+    normalizeAndResampleStrided
+Same as normalizeAndResampleInput, with the resampled values written every stride
+elements of output (stride RP_BATCH to fill one column of a batch)
+*/
+static void normalizeAndResampleStrided(int16_t input[], uint16_t start, uint16_t mask, uint16_t *output, int32_t stride)
 {
     int16_t max = input[0], min = input[0];
     uint16_t i, signal_range, lower_mult, upper_mult, factor = 0, temp;
@@ -266,7 +279,7 @@ void normalizeAndResampleInput(int16_t input[], uint16_t start, uint16_t mask, u
     //Normalize the resampled signal
     temp = 0;
     for(i=0;i<INPUT_FREQUENCY; i+=RESAMPLE_STEP)
-        output[temp++] = ((int32_t)((int32_t)(input[(start + i) & mask] + max) * (int32_t)factor)) >> 16;
+        output[stride * temp++] = ((int32_t)((int32_t)(input[(start + i) & mask] + max) * (int32_t)factor)) >> 16;
 }
 
 
@@ -303,6 +316,148 @@ uint16_t classify(int16_t buffer[], uint16_t buffer_length, uint16_t peak)
 }
 
 
+// rp_mat unpacked by rpInit, kept for all the batches
+static uint16_t rp_add[NUM_COEFFICIENTS][OUTPUT_FREQUENCY];
+static uint16_t rp_sub[NUM_COEFFICIENTS][OUTPUT_FREQUENCY];
+static pthread_once_t rp_once = PTHREAD_ONCE_INIT;
+
+/*
+    expandRandomProjection
+This function unpacks the 2-bit entries of rp_mat into one add mask and one subtract
+mask per coefficient and input sample (0xFFFF where the entry is +1 or -1 respectively,
+0 otherwise), so that the projection of a batch is a branch-free sum of masked inputs.
+*/
+static void expandRandomProjection(void)
+{
+    uint16_t c, i, s, temp;
+
+    for(i=0; i<OUTPUT_FREQUENCY; i++)
+    {
+        for(c=0; c<(NUM_COEFFICIENTS/COMPRESSED_ELEMENTS); c++)
+        {
+            temp = rp_mat[c][i];
+            for(s=0;s<COMPRESSED_ELEMENTS;s++)
+            {
+                rp_add[(c<<3) + s][i] = (temp & 0x0001) ? 0xFFFF : 0;
+                rp_sub[(c<<3) + s][i] = (temp & 0x0002) ? 0xFFFF : 0;
+                temp = temp >> 2;
+            }
+        }
+    }
+}
+
+void rpInit(void)
+{
+    pthread_once(&rp_once, expandRandomProjection);
+}
+
+/*
+    applyRandomProjectionBatch
+Same as applyRandomProjection for n beats stored as columns (structure of arrays):
+input[i][b] is sample i of beat b and output[c][b] coefficient c of beat b. The
+arithmetic is modulo 2^16 as in the single-beat version.
+*/
+static void applyRandomProjectionBatch(uint16_t add[NUM_COEFFICIENTS][OUTPUT_FREQUENCY], uint16_t sub[NUM_COEFFICIENTS][OUTPUT_FREQUENCY],
+                                       uint16_t input[OUTPUT_FREQUENCY][RP_BATCH], uint16_t output[NUM_COEFFICIENTS][RP_BATCH], int32_t n)
+{
+    int32_t c, i, b;
+
+    for(c=0; c<NUM_COEFFICIENTS; c++)
+    {
+        for(b=0; b<n; b++)
+            output[c][b] = (1<<15) - 1; //Initialize to half of the range
+
+        for(i=0; i<OUTPUT_FREQUENCY; i++)
+        {
+            uint16_t a = add[c][i], m = sub[c][i];
+            for(b=0; b<n; b++)
+                output[c][b] += (input[i][b] & a) - (input[i][b] & m);
+        }
+    }
+}
+
+/*
+    rescaledProductoryBatch
+Same as rescaledProductory for n beats in structure-of-arrays layout. The loop
+that shifts the gaussians left until the maximum reaches bit 31 is replaced by
+a single shift of the number of leading zeros of the maximum.
+*/
+static void rescaledProductoryBatch(uint16_t coeffs[NUM_COEFFICIENTS][RP_BATCH], uint16_t output[NUM_CLASSES][RP_BATCH], int32_t n)
+{
+    uint32_t gaussians[NUM_CLASSES][RP_BATCH], max[RP_BATCH];
+    int32_t c, i, b;
+
+    for(c=0;c<NUM_CLASSES;c++)
+        for(b=0;b<n;b++)
+            output[c][b] = polygmf(coeffs[0][b], c, 0);
+
+    for(i=1;i<NUM_COEFFICIENTS;i++)
+    {
+        for(b=0;b<n;b++)
+            max[b] = 0;
+
+        for(c=0; c<NUM_CLASSES; c++)
+        {
+            for(b=0;b<n;b++)
+            {
+                gaussians[c][b] = (uint32_t)output[c][b] * polygmf(coeffs[i][b], c, i);
+                if(gaussians[c][b] > max[b])
+                    max[b] = gaussians[c][b];
+            }
+        }
+
+        for(b=0;b<n;b++)
+        {
+            uint32_t shift = 0;
+
+            //If the maximum is 0 we cannot rescale (all vaules are 0)
+            if(max[b] == 0)
+                continue;
+
+#if defined(__GNUC__)
+            shift = __builtin_clz(max[b]);
+#else
+            while((max[b] << shift) < (1u<<31))
+                shift++;
+#endif
+            for(c=0; c<NUM_CLASSES; c++)
+                output[c][b] = (gaussians[c][b] << shift) >> 16;
+        }
+    }
+}
+
+void classifyBatch(int16_t *buffers[], uint16_t buffer_length, const uint16_t peaks[], int32_t nBeats, uint16_t classes[])
+{
+    uint16_t resampled[OUTPUT_FREQUENCY][RP_BATCH];
+    uint16_t coefficients[NUM_COEFFICIENTS][RP_BATCH];
+    uint16_t productory[NUM_CLASSES][RP_BATCH];
+    uint16_t values[NUM_CLASSES];
+    uint16_t mask = buffer_length - 1;
+
+    for(int32_t first = 0; first < nBeats; first += RP_BATCH)
+    {
+        int32_t n = (nBeats - first < RP_BATCH) ? nBeats - first : RP_BATCH;
+
+        for(int32_t b = 0; b < n; b++)
+        {
+            uint16_t start = (peaks[first + b] + buffer_length - (INPUT_FREQUENCY >> 1)) & mask;
+            normalizeAndResampleStrided(buffers[first + b], start, mask, &resampled[0][b], RP_BATCH);
+        }
+
+        applyRandomProjectionBatch(rp_add, rp_sub, resampled, coefficients, n);
+
+        rescaledProductoryBatch(coefficients, productory, n);
+
+        for(int32_t b = 0; b < n; b++)
+        {
+            for(int32_t c = 0; c < NUM_CLASSES; c++)
+                values[c] = productory[c][b];
+            classes[first + b] = classifyBeat(values);
+        }
+    }
+}
+
+
 void report_rpeak(int32_t *arg[])
 {
 
@@ -310,18 +465,29 @@ void report_rpeak(int32_t *arg[])
     int32_t *offset = arg[2];
     int16_t bufferSize = 512;
     int32_t *rpeaks_counter = arg[4];
-    int16_t class = 0;
     int32_t *indicesBeatClasses = arg[11];
 
+    int16_t *beats[H_B+1];
+    uint16_t peaks[H_B+1] = {0};
+    uint16_t classes[H_B+1];
+
+    // Locate every beat of the window, then classify them all in one batch
     for(int32_t ix = 0; ix < *rpeaks_counter; ix++){
         if(offset[ix]-bufferSize/2<0){
-            class = classify(&buffer[0], bufferSize, offset[ix]);
+            beats[ix] = &buffer[0];
+            peaks[ix] = offset[ix];
         }else if(offset[ix]+bufferSize/2>dim){
-            class = classify(&buffer[dim-bufferSize], bufferSize, offset[ix]-(dim-bufferSize));
+            beats[ix] = &buffer[dim-bufferSize];
+            peaks[ix] = offset[ix]-(dim-bufferSize);
         }else{
-            class = classify(&buffer[offset[ix]-bufferSize/2], bufferSize, offset[ix]-bufferSize/2);
+            beats[ix] = &buffer[offset[ix]-bufferSize/2];
+            peaks[ix] = offset[ix]-bufferSize/2;
         }
-        
-        indicesBeatClasses[ix] = class;
+    }
+
+    classifyBatch(beats, bufferSize, peaks, *rpeaks_counter, classes);
+
+    for(int32_t ix = 0; ix < *rpeaks_counter; ix++){
+        indicesBeatClasses[ix] = classes[ix];
     }
 }
@@ -0,0 +1,39 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Main Author:     Alireza Amirshahi               //
+// Optimizations:   Dimitrios Samakovlis            //
+/////////////////////////////////////////////////////
+
+
+
+
+#ifndef BLOCK_BENCH_H_
+#define BLOCK_BENCH_H_
+
+// Runs each conv block of the network on the input of Src/fcn.c with conv_block_three_pass
+// and conv_block_fused, checks that the outputs are identical and prints the time per call.
+// Started with "SeizDetCNN blockbench"; returns 0 when all the outputs match.
+int block_bench(void);
+
+// Classifies BENCH_WINDOWS windows derived from the input of Src/fcn.c with forward_propagation
+// (one window at a time) and with forward_propagation_batch, checks that the predictions are the
+// same and prints the time per window. Started with "SeizDetCNN batchbench"; returns 0 when they match.
+int batch_bench(void);
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Main Author:     Alireza Amirshahi               //
+// Optimizations:   Dimitrios Samakovlis            //
+/////////////////////////////////////////////////////
+
+
+
+#ifndef CONV_AVX2_H_
+#define CONV_AVX2_H_
+
+#include "defines.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && NUM_FRACTION_CNV_FC >= 8 && NUM_FRACTION_CNV_FC <= 16
+#define CONV_AVX2_AVAILABLE
+#endif
+
+// AVX2 versions of conv1d and conv_max1d of main.c, with bit-identical results.
+// MUL_CONV(f, d, n) = (f*d) >> n is computed as the high half of (f << (16-n)) * d
+// (pmulhw), which needs 8 <= NUM_FRACTION_CNV_FC <= 16, and the shifted products
+// of two taps are added in 32 bits (pmaddwd). Each 256-bit vector holds 8 output
+// channels, so the kernels work on one im2col column of the input at a time.
+
+#ifdef CONV_AVX2_AVAILABLE
+
+// 1 if the CPU runs the AVX2 kernels (checked once), 0 otherwise
+int conv_avx2_supported(void);
+
+void conv1d_avx2(const int16_t *data, const signed char *filter, int16_t *map_out, const signed char *bias, int32_t filter_size,
+                 int32_t input_len, int32_t input_depth, int32_t output_len, int32_t n_filter, int32_t strides, int32_t relu);
+
+// conv1d_avx2 on n_maps inputs with the same layer: map_out[m] gets the output of data[m]. The im2col
+// columns of all the maps go through the weights together, so a layer with few output positions
+// (the fully connected layers) reads its weights once for up to 16 maps instead of once per map.
+void conv1d_batch_avx2(const int16_t * const data[], int16_t * const map_out[], int32_t n_maps, const signed char *filter,
+                       const signed char *bias, int32_t filter_size, int32_t input_len, int32_t input_depth,
+                       int32_t output_len, int32_t n_filter, int32_t strides, int32_t relu);
+
+void conv_max1d_avx2(const int16_t *data, const signed char *filter, int16_t *map_out, const signed char *bias,
+                     int32_t input_len, int32_t input_depth, int32_t output_len);
+
+// conv_max1d_avx2 with batch_normalization and relu applied to each pooled output before it is stored,
+// for the pooled outputs out_begin..out_end-1 only
+void conv_max_bn_relu1d_avx2(const int16_t *data, const signed char *filter, int16_t *map_out, const signed char *bias,
+                             const signed char *gamma, const signed char *beta, const signed char *mean, const signed char *var,
+                             int32_t input_len, int32_t input_depth, int32_t output_len, int32_t out_begin, int32_t out_end);
+
+#endif
+
+#endif
@@ -32,6 +32,7 @@
 #define NUM_FRACTION_CNV_FC 8
 #define NUM_FRACTION_BN 5
 #define NEG_INF (-(1<<14))
+#define MAX_INT_16 65535
 #define INPUT_LEN (23 * 1024)
 
 #define MUL_CONV(x, y, num) (int32_t)((int)(x)*(int)(y))>>(num)
@@ -40,6 +41,15 @@
 #define mem2d(data,data_len,j,i)   data[((j)*(data_len))+(i)]
 #define mem3d(filter,filter_len,filter_depth,n,k,i)   filter[((n)*(filter_depth)+(k))*(filter_len)+(i)]
 
+// batch_normalization followed by relu for one element of a channel with parameters gamma, beta, mean, var
+static inline int16_t bn_relu(int16_t x, signed char gamma, signed char beta, signed char mean, signed char var) {
+    int16_t normalized = x - ((int16_t) mean << (NUM_FRACTION_DATA - NUM_FRACTION_BN));
+    int16_t standardized = MUL(normalized, var, NUM_FRACTION_BN);
+    int16_t new_standardized = MUL(standardized, gamma, NUM_FRACTION_BN);
+    int16_t out = (int16_t) (new_standardized + ((int16_t) beta << (NUM_FRACTION_DATA - NUM_FRACTION_BN)));
+    return (out < 0) ? 0 : out;
+}
+
 
 extern int16_t input_array[INPUT_LEN];
     
@@ -27,6 +27,27 @@
 
 #include "defines.h"
 
-int main();
+int main(int argc, char **argv);
+
+// A block (conv_max1d, batch_normalization, relu) as three passes over the map, or fused in one pass
+void conv_block_three_pass(int32_t block, const int16_t *layer_in, int16_t *conv1d_out);
+void conv_block_fused(int32_t block, const int16_t *layer_in, int16_t *conv1d_out);
+
+// conv_max1d + batch_normalization + relu of a block for the pooled outputs out_begin..out_end-1 of the map
+void conv_max_bn_relu1d(const int16_t *data, const signed char *filter, int16_t *map_out, const signed char *bias,
+                        const signed char *gamma, const signed char *beta, const signed char *mean, const signed char *var,
+                        int32_t input_len, int32_t input_depth, int32_t output_len, int32_t out_begin, int32_t out_end);
+
+// Prediction (0 normal, 1 seizure) for a window of INPUT_LEN samples in data, which is overwritten.
+// intermediate is a work buffer of 256*128.
+int16_t forward_propagation(int16_t *data, int16_t *intermediate);
+
+// Predictions (0 normal, 1 seizure) of n_windows windows of INPUT_LEN samples, window w at data + w*INPUT_LEN.
+// The windows are not modified. Same predictions as forward_propagation on each window.
+void forward_propagation_batch(const int16_t *data, int32_t n_windows, int16_t *predictions);
+
+// The network after block 0: prediction (0 normal, 1 seizure) from the output of block 0 (128 x 256).
+// map0 (64*128) and map1 (16*128) are work buffers.
+int16_t forward_propagation_from_block1(const int16_t *block0_out, int16_t *map0, int16_t *map1);
 
 #endif 
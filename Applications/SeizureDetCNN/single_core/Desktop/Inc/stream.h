@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Main Author:     Alireza Amirshahi               //
+// Optimizations:   Dimitrios Samakovlis            //
+/////////////////////////////////////////////////////
+
+
+
+
+#ifndef STREAM_H_
+#define STREAM_H_
+
+#include "defines.h"
+
+// Continuous classification of multichannel EEG: the samples are pushed as they are acquired and
+// the network runs on the last STREAM_WINDOW samples every hop samples (4 s window at 256 Hz).
+#define STREAM_CHANNELS 23
+#define STREAM_WINDOW 1024
+#define STREAM_DEFAULT_HOP 256          // one decision per second
+
+// The output of block 0 for pooled position j depends on the input positions 4j-1..4j+4 only.
+// When the window moves by hop (a multiple of 4), the previous block 0 map shifted by hop/4 is
+// reused, and only its first position and the last hop/4+1 ones are computed.
+typedef struct {
+    int32_t hop;
+    int32_t head;                       // ring position of the oldest sample of the window
+    int32_t filled;                     // samples in the ring, up to STREAM_WINDOW
+    int32_t since_decision;             // samples pushed since the last decision
+    int32_t block0_valid;               // block0 holds the map of the window hop samples earlier
+    int64_t n_samples;                  // samples pushed since eeg_stream_init
+    int16_t ring[STREAM_CHANNELS][STREAM_WINDOW];
+    int16_t window[STREAM_CHANNELS * STREAM_WINDOW];
+    int16_t block0[128 * 256];
+    int16_t map0[64 * 128];
+    int16_t map1[16 * 128];
+} eeg_stream_t;
+
+typedef struct {
+    int64_t end_sample;                 // index (since eeg_stream_init) of the sample after the window
+    int16_t prediction;                 // 0 normal, 1 seizure
+    int32_t reused;                     // block 0 outputs reused from the previous window
+    double latency_us;                  // from the arrival of the last sample of the window to the prediction
+} eeg_decision_t;
+
+// Returns -1 if hop is not a multiple of 4 in 4..STREAM_WINDOW, 0 otherwise
+int32_t eeg_stream_init(eeg_stream_t *stream, int32_t hop);
+
+// Pushes n_samples samples of STREAM_CHANNELS interleaved channels (samples[t * STREAM_CHANNELS + ch]),
+// runs the network every hop samples once the window is full and stores up to max_decisions
+// decisions. Returns the number of decisions stored.
+int32_t eeg_stream_push(eeg_stream_t *stream, const int16_t *samples, int32_t n_samples,
+                        eeg_decision_t *decisions, int32_t max_decisions);
+
+// Streams the window of Src/fcn.c repeated 8 times with the given hop and prints the decisions,
+// their latency and the latency of a full inference. Started with "SeizDetCNN stream [hop]".
+int stream_demo(int32_t hop);
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Main Author:     Alireza Amirshahi               //
+// Optimizations:   Dimitrios Samakovlis            //
+/////////////////////////////////////////////////////
+
+
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "block_bench.h"
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define REPEAT 20
+
+static int16_t block_in[256*128];          // input of block 0 (INPUT_LEN) or output of the previous one
+static int16_t out_three_pass[256*128];
+static int16_t out_fused[256*128];
+
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static double time_block(void (*run)(int32_t, const int16_t *, int16_t *), int32_t block, int16_t *out) {
+    double best = 1e9;
+    for (int32_t r = 0; r < REPEAT; r++) {
+        double start = now();
+        run(block, block_in, out);
+        double elapsed = now() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+    return best;
+}
+
+int block_bench(void) {
+    int32_t depth_size[4] = {23, 128, 128, 128};
+    int32_t map_size[4] = {1024, 256, 64, 16};
+    int failures = 0;
+
+    printf("block  in (len x depth)  three-pass [us]  fused [us]  speedup  same\n");
+
+    memcpy(block_in, input_array, sizeof(input_array));
+    for (int32_t block = 0; block < 3; block++) {
+        double three_pass = time_block(conv_block_three_pass, block, out_three_pass);
+        double fused = time_block(conv_block_fused, block, out_fused);
+        size_t out_size = (size_t) map_size[block + 1] * depth_size[block + 1] * sizeof(int16_t);
+        int same = memcmp(out_three_pass, out_fused, out_size) == 0;
+        failures += !same;
+
+        printf("%5d  %4d x %-3d          %15.1f  %10.1f  %6.2fx  %s\n", (int) block, (int) map_size[block], (int) depth_size[block],
+               three_pass * 1e6, fused * 1e6, three_pass / fused, same ? "yes" : "NO");
+
+        memcpy(block_in, out_fused, out_size);   // input of the next block
+    }
+    return failures != 0;
+}
+
+
+#define BENCH_WINDOWS 16
+
+static int16_t windows[BENCH_WINDOWS][INPUT_LEN];
+static int16_t window_copy[INPUT_LEN];          // forward_propagation overwrites its input
+static int16_t work_map[256*128];
+
+int batch_bench(void) {
+    int16_t single[BENCH_WINDOWS], batch[BENCH_WINDOWS];
+    double best_single = 1e9, best_batch = 1e9;
+
+    // the input of Src/fcn.c scaled by 1, 1/4, -1 or 1/2 and with a different small offset on each
+    // window, so that both classes are predicted
+    const int32_t scale_num[4] = {4, 1, -4, 2};
+    for (int32_t w = 0; w < BENCH_WINDOWS; w++)
+        for (int32_t i = 0; i < INPUT_LEN; i++) {
+            int32_t v = (input_array[i] * scale_num[w % 4]) / 4 + ((i * (w + 1)) % 7) - 3;
+            windows[w][i] = (v > 32767) ? 32767 : (v < -32768) ? -32768 : v;
+        }
+
+    for (int32_t r = 0; r < REPEAT; r++) {
+        double start = now();
+        for (int32_t w = 0; w < BENCH_WINDOWS; w++) {
+            memcpy(window_copy, windows[w], sizeof(window_copy));
+            single[w] = forward_propagation(window_copy, work_map);
+        }
+        double elapsed = now() - start;
+        best_single = (elapsed < best_single) ? elapsed : best_single;
+
+        start = now();
+        forward_propagation_batch(&windows[0][0], BENCH_WINDOWS, batch);
+        elapsed = now() - start;
+        best_batch = (elapsed < best_batch) ? elapsed : best_batch;
+    }
+
+    int same = memcmp(single, batch, sizeof(single)) == 0;
+    int32_t seizures = 0;
+    for (int32_t w = 0; w < BENCH_WINDOWS; w++)
+        seizures += single[w];
+    printf("windows  seizure  single [us/window]  batch [us/window]  speedup  same\n");
+    printf("%7d  %7d  %19.1f  %17.1f  %6.2fx  %s\n", BENCH_WINDOWS, (int) seizures, best_single / BENCH_WINDOWS * 1e6,
+           best_batch / BENCH_WINDOWS * 1e6, best_single / best_batch, same ? "yes" : "NO");
+    return !same;
+}
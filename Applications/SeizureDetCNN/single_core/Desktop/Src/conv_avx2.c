@@ -0,0 +1,257 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Main Author:     Alireza Amirshahi               //
+// Optimizations:   Dimitrios Samakovlis            //
+/////////////////////////////////////////////////////
+
+
+
+#include "conv_avx2.h"
+
+#ifdef CONV_AVX2_AVAILABLE
+
+#include <immintrin.h>
+#include <string.h>
+
+#define AVX2 __attribute__((target("avx2")))
+
+#define LANES       8                   // output channels per vector
+#define GROUP       4                   // vectors accumulated together
+#define CHUNK       16                  // im2col columns per call of dot_channels
+#define MAX_PREPARED 8                  // conv_max1d x3 and conv1d x2 in forward_propagation
+
+// Weights of a layer in the order of the kernels: for each pair of taps p and each block b
+// of LANES output channels, the 16 int16 (f[8b+c][2p] << s, f[8b+c][2p+1] << s), c = 0..7,
+// with s = 16 - NUM_FRACTION_CNV_FC. Channels and taps beyond the layer are 0.
+// cols and sums are the im2col columns and dot products of CHUNK columns, allocated with the
+// weights so that the large layers (fully connected) do not put them on the stack on every call.
+typedef struct {
+    const signed char *filter;
+    const signed char *bias;
+    int32_t n_filter;
+    int32_t taps;
+    int32_t pairs;
+    int32_t blocks;                     // multiple of GROUP
+    int16_t *weights;
+    int32_t *bias32;
+    int16_t *cols;                      // CHUNK x 2*pairs, the tap that completes the last pair stays 0
+    int32_t *sums;                      // CHUNK x blocks*LANES
+} prepared_t;
+
+static prepared_t prepared[MAX_PREPARED];
+static int32_t n_prepared = 0;
+
+int conv_avx2_supported(void) {
+    static int supported = -1;
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return supported;
+}
+
+// The weights are rearranged the first time a layer runs
+static const prepared_t *prepare(const signed char *filter, const signed char *bias, int32_t n_filter, int32_t taps) {
+    for (int32_t k = 0; k < n_prepared; k++) {
+        if (prepared[k].filter == filter && prepared[k].bias == bias && prepared[k].n_filter == n_filter && prepared[k].taps == taps)
+            return &prepared[k];
+    }
+
+    prepared_t *pf = &prepared[n_prepared < MAX_PREPARED ? n_prepared++ : 0];
+    free(pf->weights);
+    free(pf->bias32);
+    free(pf->cols);
+    free(pf->sums);
+    pf->filter = filter;
+    pf->bias = bias;
+    pf->n_filter = n_filter;
+    pf->taps = taps;
+    pf->pairs = (taps + 1) / 2;
+    pf->blocks = (n_filter + LANES * GROUP - 1) / (LANES * GROUP) * GROUP;
+    pf->weights = (int16_t *) calloc((size_t) pf->pairs * pf->blocks * 2 * LANES, sizeof(int16_t));
+    pf->bias32 = (int32_t *) calloc((size_t) pf->blocks * LANES, sizeof(int32_t));
+    pf->cols = (int16_t *) calloc((size_t) CHUNK * 2 * pf->pairs, sizeof(int16_t));
+    pf->sums = (int32_t *) calloc((size_t) CHUNK * pf->blocks * LANES, sizeof(int32_t));
+
+    for (int32_t n = 0; n < n_filter; n++) {
+        int16_t *w = pf->weights + (n / LANES) * 2 * LANES + (n % LANES) * 2;
+        for (int32_t t = 0; t < taps; t++)
+            w[(t / 2) * pf->blocks * 2 * LANES + t % 2] = (int16_t) (filter[n * taps + t] * (1 << (16 - NUM_FRACTION_CNV_FC)));
+        pf->bias32[n] = bias[n];
+    }
+    return pf;
+}
+
+// sums[c][n] = bias[n] + sum_t MUL_CONV(f[n][t], cols[c][t]) for n_cols columns of 2*pairs taps
+// and all the (padded) channels. Each group of GROUP*LANES channels stays in registers/L1
+// for all the columns (weight stationary).
+static AVX2 void dot_channels(const prepared_t *pf, const int16_t *cols, int32_t n_cols, int32_t *sums) {
+    const __m256i ones = _mm256_set1_epi16(1);
+    const int32_t stride = pf->blocks * 2 * LANES;
+    const int32_t col_len = 2 * pf->pairs;
+    const int32_t sums_len = pf->blocks * LANES;
+
+    for (int32_t b = 0; b < pf->blocks; b += GROUP) {
+        const __m256i bias0 = _mm256_loadu_si256((const __m256i *) (pf->bias32 + (b + 0) * LANES));
+        const __m256i bias1 = _mm256_loadu_si256((const __m256i *) (pf->bias32 + (b + 1) * LANES));
+        const __m256i bias2 = _mm256_loadu_si256((const __m256i *) (pf->bias32 + (b + 2) * LANES));
+        const __m256i bias3 = _mm256_loadu_si256((const __m256i *) (pf->bias32 + (b + 3) * LANES));
+
+        for (int32_t c = 0; c < n_cols; c++) {
+            const int16_t *col = cols + c * col_len;
+            const int16_t *w = pf->weights + b * 2 * LANES;
+            __m256i acc0 = bias0, acc1 = bias1, acc2 = bias2, acc3 = bias3;
+
+            for (int32_t p = 0; p < pf->pairs; p++, w += stride) {
+                int32_t pair;
+                memcpy(&pair, col + 2 * p, sizeof(pair));
+                const __m256i d = _mm256_set1_epi32(pair);
+                acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(_mm256_mulhi_epi16(_mm256_loadu_si256((const __m256i *) (w + 0 * 2 * LANES)), d), ones));
+                acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(_mm256_mulhi_epi16(_mm256_loadu_si256((const __m256i *) (w + 1 * 2 * LANES)), d), ones));
+                acc2 = _mm256_add_epi32(acc2, _mm256_madd_epi16(_mm256_mulhi_epi16(_mm256_loadu_si256((const __m256i *) (w + 2 * 2 * LANES)), d), ones));
+                acc3 = _mm256_add_epi32(acc3, _mm256_madd_epi16(_mm256_mulhi_epi16(_mm256_loadu_si256((const __m256i *) (w + 3 * 2 * LANES)), d), ones));
+            }
+
+            int32_t *out = sums + c * sums_len + b * LANES;
+            _mm256_storeu_si256((__m256i *) (out + 0 * LANES), acc0);
+            _mm256_storeu_si256((__m256i *) (out + 1 * LANES), acc1);
+            _mm256_storeu_si256((__m256i *) (out + 2 * LANES), acc2);
+            _mm256_storeu_si256((__m256i *) (out + 3 * LANES), acc3);
+        }
+    }
+}
+
+// Same saturation as the scalar code: above MAX_INT_16 -> MAX_INT_16-1, below -MAX_INT_16 -> -MAX_INT_16+1
+static inline AVX2 __m256i saturate(__m256i sum) {
+    sum = _mm256_blendv_epi8(sum, _mm256_set1_epi32(MAX_INT_16 - 1), _mm256_cmpgt_epi32(sum, _mm256_set1_epi32(MAX_INT_16)));
+    return _mm256_blendv_epi8(sum, _mm256_set1_epi32(-MAX_INT_16 + 1), _mm256_cmpgt_epi32(_mm256_set1_epi32(-MAX_INT_16), sum));
+}
+
+// The columns of all the maps are taken in order (map 0 first) and split in chunks of CHUNK,
+// so that a chunk can hold columns of several maps and the weights are read once per chunk
+AVX2 void conv1d_batch_avx2(const int16_t * const data[], int16_t * const map_out[], const int32_t n_maps, const signed char * const filter,
+                            const signed char * const bias, const int32_t filter_size, const int32_t input_len, const int32_t input_depth,
+                            const int32_t output_len, const int32_t n_filter, const int32_t strides, const int32_t relu) {
+    const prepared_t *pf = prepare(filter, bias, n_filter, filter_size * input_depth);
+    const int32_t col_len = 2 * pf->pairs;
+    const int32_t sums_len = pf->blocks * LANES;
+    const int32_t map_cols = (input_len + strides - 1) / strides;
+    const int32_t total_cols = n_maps * map_cols;
+    int16_t *cols = pf->cols;
+    int32_t *sums = pf->sums;
+
+    for (int32_t first = 0; first < total_cols; first += CHUNK) {
+        const int32_t n_cols = (total_cols - first < CHUNK) ? total_cols - first : CHUNK;
+        for (int32_t c = 0; c < n_cols; c++) {
+            // Taps outside the input are 0, as with the padding of the reference loop
+            const int16_t *map = data[(first + c) / map_cols];
+            const int32_t start_index = ((first + c) % map_cols) * strides;
+            int16_t *col = cols + c * col_len;
+            for (int32_t w_j = 0; w_j < input_depth; w_j++) {
+                for (int32_t w_i = 0; w_i < filter_size; w_i++) {
+                    int32_t index = start_index + w_i;
+                    col[w_j * filter_size + w_i] = index < input_len ? map[input_len * w_j + index] : 0;
+                }
+            }
+        }
+        dot_channels(pf, cols, n_cols, sums);
+
+        for (int32_t c = 0; c < n_cols; c++) {
+            int16_t *map = map_out[(first + c) / map_cols];
+            int32_t *sum_c = sums + c * sums_len;
+            for (int32_t b = 0; b < pf->blocks; b++) {
+                __m256i sum = _mm256_loadu_si256((const __m256i *) (sum_c + b * LANES));
+                if (relu)
+                    sum = _mm256_max_epi32(sum, _mm256_setzero_si256());
+                _mm256_storeu_si256((__m256i *) (sum_c + b * LANES), saturate(sum));
+            }
+            for (int32_t w_n = 0; w_n < n_filter; w_n++)
+                mem2d(map, output_len, w_n, (first + c) % map_cols) = (int16_t) sum_c[w_n];
+        }
+    }
+}
+
+AVX2 void conv1d_avx2(const int16_t * const data, const signed char * const filter, int16_t *map_out, const signed char * const bias,
+                      const int32_t filter_size, const int32_t input_len, const int32_t input_depth, const int32_t output_len,
+                      const int32_t n_filter, const int32_t strides, const int32_t relu) {
+    conv1d_batch_avx2(&data, &map_out, 1, filter, bias, filter_size, input_len, input_depth, output_len, n_filter, strides, relu);
+}
+
+// conv_max1d for the pooled outputs out_begin..out_end-1, followed by batch_normalization and relu
+// of each pooled output when bn (gamma, beta, mean, var) is given
+static AVX2 void conv_max(const int16_t * const data, const signed char * const filter, int16_t *map_out, const signed char * const bias,
+                          const signed char * const bn[4], const int32_t input_len, const int32_t input_depth, const int32_t output_len,
+                          const int32_t out_begin, const int32_t out_end) {
+    const prepared_t *pf = prepare(filter, bias, 128, 3 * input_depth);
+    const int32_t col_len = 2 * pf->pairs;
+    const int32_t sums_len = pf->blocks * LANES;
+    int16_t *cols = pf->cols;
+    int32_t *sums = pf->sums;
+    int32_t maximum[sums_len];
+
+    for (int32_t n = 0; n < sums_len; n++)
+        maximum[n] = NEG_INF;
+
+    for (int32_t first = 4 * out_begin; first < 4 * out_end; first += CHUNK) {
+        int32_t n_cols = 4 * out_end - first < CHUNK ? 4 * out_end - first : CHUNK;
+        for (int32_t c = 0; c < n_cols; c++) {
+            // Kernel of 3 centered on start_index, with zero padding at both ends
+            const int32_t start_index = first + c;
+            int16_t *col = cols + c * col_len;
+            for (int32_t w_j = 0; w_j < input_depth; w_j++) {
+                const int16_t *row = &data[input_len * w_j];
+                col[3 * w_j + 0] = start_index > 0 ? row[start_index - 1] : 0;
+                col[3 * w_j + 1] = row[start_index];
+                col[3 * w_j + 2] = start_index + 1 < input_len ? row[start_index + 1] : 0;
+            }
+        }
+        dot_channels(pf, cols, n_cols, sums);
+
+        for (int32_t c = 0; c < n_cols; c++) {
+            const int32_t start_index = first + c;
+            for (int32_t b = 0; b < pf->blocks; b++) {
+                __m256i sum = saturate(_mm256_loadu_si256((const __m256i *) (sums + c * sums_len + b * LANES)));
+                __m256i max = _mm256_loadu_si256((const __m256i *) (maximum + b * LANES));
+                _mm256_storeu_si256((__m256i *) (maximum + b * LANES), _mm256_max_epi32(max, sum));
+            }
+            if (start_index % 4 == 3) {
+                for (int32_t w_n = 0; w_n < 128; w_n++) {
+                    mem2d(map_out, output_len, w_n, start_index / 4) = bn ?
+                        bn_relu((int16_t) maximum[w_n], bn[0][w_n], bn[1][w_n], bn[2][w_n], bn[3][w_n]) : (int16_t) maximum[w_n];
+                    maximum[w_n] = NEG_INF;
+                }
+            }
+        }
+    }
+}
+
+AVX2 void conv_max1d_avx2(const int16_t * const data, const signed char * const filter, int16_t *map_out, const signed char * const bias,
+                          const int32_t input_len, const int32_t input_depth, const int32_t output_len) {
+    conv_max(data, filter, map_out, bias, NULL, input_len, input_depth, output_len, 0, output_len);
+}
+
+AVX2 void conv_max_bn_relu1d_avx2(const int16_t * const data, const signed char * const filter, int16_t *map_out, const signed char * const bias,
+                                  const signed char * const gamma, const signed char * const beta, const signed char * const mean,
+                                  const signed char * const var, const int32_t input_len, const int32_t input_depth, const int32_t output_len,
+                                  const int32_t out_begin, const int32_t out_end) {
+    const signed char * const bn[4] = {gamma, beta, mean, var};
+    conv_max(data, filter, map_out, bias, bn, input_len, input_depth, output_len, out_begin, out_end);
+}
+
+#endif
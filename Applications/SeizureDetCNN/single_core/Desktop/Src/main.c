@@ -23,15 +23,19 @@
 
 
 #include "main.h"
+#include "conv_avx2.h"
+#include "block_bench.h"
+#include "stream.h"
 #include <stdio.h>
+#include <string.h>
 
 
 // Enable the C level optimizations for performance gains (loop reordering - loop unrolling)
 #define CONV_OPTIMIZED
 #define CONV_MAX_OPTIMIZED	// this has the most significant gains as it is the most time consuming part
 #define BATCH_OPTIMIZED
-
-#define MAX_INT_16 65535
+#define CONV_SIMD		// use the AVX2 kernels of conv_avx2.c (same results) when the CPU supports them
+#define CONV_BLOCK_FUSED	// conv_max1d, batch_normalization and relu in one pass over tiles of the output (same results)
 
 int16_t intermediate_map[256*128];
 
@@ -50,8 +54,15 @@ int16_t forward_propagation(int16_t *data, int16_t *intermediate);
 
 // =================================================================================
 
-int main()
+int main(int argc, char **argv)
 {
+    if (argc > 1 && strcmp(argv[1], "blockbench") == 0)
+        return block_bench();
+    if (argc > 1 && strcmp(argv[1], "batchbench") == 0)
+        return batch_bench();
+    if (argc > 1 && strcmp(argv[1], "stream") == 0)
+        return stream_demo(argc > 2 ? atoi(argv[2]) : STREAM_DEFAULT_HOP);
+
     int16_t predict = forward_propagation(input_array, intermediate_map);
     
     printf("Prediction : %d", predict);
@@ -67,6 +78,12 @@ int main()
 void conv1d(const int16_t * const data, const signed char * const filter, int16_t *map_out, const signed char * const bias, const int32_t filter_size,
             const int32_t input_len, const int32_t input_depth, const int32_t output_len, const int32_t n_filter, const int32_t strides,
             const int32_t relu) {
+    #if defined(CONV_SIMD) && defined(CONV_AVX2_AVAILABLE)
+    if (conv_avx2_supported()) {
+        conv1d_avx2(data, filter, map_out, bias, filter_size, input_len, input_depth, output_len, n_filter, strides, relu);
+        return;
+    }
+    #endif
     register int32_t sum;
     int32_t mult;
     #ifndef CONV_OPTIMIZED
@@ -123,6 +140,12 @@ void conv1d(const int16_t * const data, const signed char * const filter, int16_
 
 void conv_max1d(const int16_t * const data, const signed char * const filter, int16_t *map_out, const signed char * const bias,
                 const int32_t input_len, const int32_t input_depth, const int32_t output_len) {
+    #if defined(CONV_SIMD) && defined(CONV_AVX2_AVAILABLE)
+    if (conv_avx2_supported()) {
+        conv_max1d_avx2(data, filter, map_out, bias, input_len, input_depth, output_len);
+        return;
+    }
+    #endif
     register int32_t sum;
     register int32_t mult;
     
@@ -300,7 +323,76 @@ void relu(int16_t * const data, int32_t input_len) {
         data[i] = (data[i] < 0) ? 0 : data[i];
 }
 
-void conv_block(const int32_t block, int16_t * const layer_in, int16_t * const conv1d_out){
+// Pooled outputs per tile of conv_max_bn_relu1d: the 4*FUSED_TILE+2 input positions of all
+// the channels (23 or 128) take at most 16.5 KB
+#define FUSED_TILE 16
+
+static int16_t fused_tile[128 * (4 * FUSED_TILE + 2)];
+static int32_t fused_sum[4 * FUSED_TILE];
+
+// conv_max1d, then batch_normalization and relu of each pooled output as it is produced, for
+// the pooled outputs out_begin..out_end-1 (0..output_len-1 for the whole map).
+// The input positions of FUSED_TILE pooled outputs are copied once (with the zero padding)
+// and every filter runs over them, so the data stays in L1 and the map is written once.
+void conv_max_bn_relu1d(const int16_t * const data, const signed char * const filter, int16_t *map_out, const signed char * const bias,
+                        const signed char * const gamma, const signed char * const beta, const signed char * const mean, const signed char * const var,
+                        const int32_t input_len, const int32_t input_depth, const int32_t output_len, const int32_t out_begin, const int32_t out_end) {
+    #if defined(CONV_SIMD) && defined(CONV_AVX2_AVAILABLE)
+    if (conv_avx2_supported()) {
+        conv_max_bn_relu1d_avx2(data, filter, map_out, bias, gamma, beta, mean, var, input_len, input_depth, output_len, out_begin, out_end);
+        return;
+    }
+    #endif
+    const int32_t tile_len = 4 * FUSED_TILE + 2;
+
+    for (int32_t first = out_begin; first < out_end; first += FUSED_TILE) {
+        const int32_t n_out = (out_end - first < FUSED_TILE) ? out_end - first : FUSED_TILE;
+
+        // input positions 4*first-1 .. 4*(first+n_out)
+        for (int32_t w_j = 0; w_j < input_depth; w_j++) {
+            for (int32_t i = 0; i < 4 * n_out + 2; i++) {
+                const int32_t position = 4 * first - 1 + i;
+                fused_tile[w_j * tile_len + i] = (position >= 0 && position < input_len) ? data[input_len * w_j + position] : 0;
+            }
+        }
+
+        register const signed char *filter_address = filter;
+        for (int32_t w_n = 0; w_n < 128; w_n++) {
+            // sums of the 4*n_out positions, one input channel at a time (contiguous, so the compiler vectorizes it)
+            for (int32_t i = 0; i < 4 * n_out; i++)
+                fused_sum[i] = bias[w_n];
+            for (int32_t w_j = 0; w_j < input_depth; w_j++) {
+                register const int16_t *data_address = &fused_tile[w_j * tile_len];
+                const signed char f0 = *(filter_address++), f1 = *(filter_address++), f2 = *(filter_address++);
+                for (int32_t i = 0; i < 4 * n_out; i++) {
+                    fused_sum[i] += MUL_CONV(f0, data_address[i], NUM_FRACTION_CNV_FC);
+                    fused_sum[i] += MUL_CONV(f1, data_address[i + 1], NUM_FRACTION_CNV_FC);
+                    fused_sum[i] += MUL_CONV(f2, data_address[i + 2], NUM_FRACTION_CNV_FC);
+                }
+            }
+
+            for (int32_t out = 0; out < n_out; out++) {
+                int32_t maximum = NEG_INF;
+                for (int32_t pool = 0; pool < 4; pool++) {
+                    register int32_t sum = fused_sum[4 * out + pool];
+
+                    if (sum > (MAX_INT_16) ){
+                        sum = (MAX_INT_16) -1;
+                    }
+                    else if (sum < -(MAX_INT_16)){
+                        sum = -(MAX_INT_16) +1;
+                    }
+                    if (sum > maximum) {
+                        maximum = sum;
+                    }
+                }
+                mem2d(map_out, output_len, w_n, first + out) = bn_relu((int16_t) maximum, gamma[w_n], beta[w_n], mean[w_n], var[w_n]);
+            }
+        }
+    }
+}
+
+void conv_block_three_pass(const int32_t block, const int16_t * const layer_in, int16_t * const conv1d_out){
     int32_t depth_size[6] = {23, 128, 128, 128, 100, 2};
     int32_t map_size[6] = {1024, 256, 64, 16, 1, 1};
     signed char* filter = conv1d_w[block];
@@ -314,6 +406,23 @@ void conv_block(const int32_t block, int16_t * const layer_in, int16_t * const c
     relu(conv1d_out, map_size[block+1] * depth_size[block + 1]);
 }
 
+void conv_block_fused(const int32_t block, const int16_t * const layer_in, int16_t * const conv1d_out){
+    int32_t depth_size[6] = {23, 128, 128, 128, 100, 2};
+    int32_t map_size[6] = {1024, 256, 64, 16, 1, 1};
+
+    conv_max_bn_relu1d(layer_in, conv1d_w[block], conv1d_out, conv1d_b[block],
+                       bn[block * 4], bn[block * 4 + 1], bn[block * 4 + 2], bn[block * 4 + 3],
+                       map_size[block], depth_size[block], map_size[block+1], 0, map_size[block+1]);
+}
+
+void conv_block(const int32_t block, const int16_t * const layer_in, int16_t * const conv1d_out){
+    #ifdef CONV_BLOCK_FUSED
+    conv_block_fused(block, layer_in, conv1d_out);
+    #else
+    conv_block_three_pass(block, layer_in, conv1d_out);
+    #endif
+}
+
 int16_t forward_propagation(int16_t *data, int16_t *intermediate) {
     int32_t fc_depth_size[3] = {128, 100, 2};
     int32_t fc_map_size[3] = {16, 1, 1};
@@ -370,3 +479,73 @@ int16_t forward_propagation(int16_t *data, int16_t *intermediate) {
     else
         return 1;
 }
+
+int16_t forward_propagation_from_block1(const int16_t *block0_out, int16_t *map0, int16_t *map1) {
+    int32_t fc_depth_size[3] = {128, 100, 2};
+    int32_t fc_map_size[3] = {16, 1, 1};
+
+    conv_block(1, block0_out, map0);
+    conv_block(2, map0, map1);
+    conv1d(map1, dense_w[0], map0, dense_b[0], fc_map_size[0],fc_map_size[0],
+           fc_depth_size[0], fc_map_size[1], fc_depth_size[1], fc_map_size[0], 1);
+    conv1d(map0, dense_w[1], map1, dense_b[1], fc_map_size[1],fc_map_size[1],
+           fc_depth_size[1], fc_map_size[2], fc_depth_size[2], fc_map_size[1], 0);
+
+    return (map1[0] > map1[1]) ? 0 : 1;
+}
+
+
+// Windows of a batch processed together, layer by layer
+#define BATCH_TILE 8
+
+static int16_t batch_map0[BATCH_TILE][256*128];
+static int16_t batch_map1[BATCH_TILE][64*128];
+
+// conv1d of the same layer on the n maps of a tile. With the AVX2 kernels the columns of all the
+// maps share one pass over the weights; otherwise it is conv1d on each map.
+static void conv1d_tile(int16_t * const data[], int16_t * const map_out[], const int32_t n, const signed char * const filter,
+                        const signed char * const bias, const int32_t filter_size, const int32_t input_len, const int32_t input_depth,
+                        const int32_t output_len, const int32_t n_filter, const int32_t strides, const int32_t relu) {
+    #if defined(CONV_SIMD) && defined(CONV_AVX2_AVAILABLE)
+    if (conv_avx2_supported()) {
+        conv1d_batch_avx2((const int16_t * const *) data, map_out, n, filter, bias, filter_size, input_len, input_depth,
+                          output_len, n_filter, strides, relu);
+        return;
+    }
+    #endif
+    for (int32_t w = 0; w < n; w++)
+        conv1d(data[w], filter, map_out[w], bias, filter_size, input_len, input_depth, output_len, n_filter, strides, relu);
+}
+
+// Runs forward_propagation on n_windows windows of INPUT_LEN samples (window w at data + w*INPUT_LEN)
+// and stores their predictions. The windows are not modified. The windows are taken in tiles of
+// BATCH_TILE and each layer runs on all the windows of a tile before the next layer. The conv blocks
+// already reuse their weights over CHUNK columns of a window; the fully connected layers have one
+// column per window, so the columns of the whole tile go through their weights in a single pass.
+void forward_propagation_batch(const int16_t *data, int32_t n_windows, int16_t *predictions) {
+    int32_t fc_depth_size[3] = {128, 100, 2};
+    int32_t fc_map_size[3] = {16, 1, 1};
+    int16_t *map0[BATCH_TILE], *map1[BATCH_TILE];
+
+    for (int32_t w = 0; w < BATCH_TILE; w++) {
+        map0[w] = batch_map0[w];
+        map1[w] = batch_map1[w];
+    }
+
+    for (int32_t first = 0; first < n_windows; first += BATCH_TILE) {
+        int32_t n = (n_windows - first < BATCH_TILE) ? n_windows - first : BATCH_TILE;
+
+        for (int32_t w = 0; w < n; w++)
+            conv_block(0, data + (first + w) * INPUT_LEN, batch_map0[w]);
+        for (int32_t w = 0; w < n; w++)
+            conv_block(1, batch_map0[w], batch_map1[w]);
+        for (int32_t w = 0; w < n; w++)
+            conv_block(2, batch_map1[w], batch_map0[w]);
+        conv1d_tile(map0, map1, n, dense_w[0], dense_b[0], fc_map_size[0],fc_map_size[0],
+                    fc_depth_size[0], fc_map_size[1], fc_depth_size[1], fc_map_size[0], 1);
+        conv1d_tile(map1, map0, n, dense_w[1], dense_b[1], fc_map_size[1],fc_map_size[1],
+                    fc_depth_size[1], fc_map_size[2], fc_depth_size[2], fc_map_size[1], 0);
+        for (int32_t w = 0; w < n; w++)
+            predictions[first + w] = (batch_map0[w][0] > batch_map0[w][1]) ? 0 : 1;
+    }
+}
@@ -0,0 +1,166 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////////
+// Main Author:     Alireza Amirshahi               //
+// Optimizations:   Dimitrios Samakovlis            //
+/////////////////////////////////////////////////////
+
+
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "stream.h"
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define POOL 4
+#define BLOCK0_LEN (STREAM_WINDOW / POOL)
+
+static double now_us(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec * 1e-3;
+}
+
+int32_t eeg_stream_init(eeg_stream_t *stream, int32_t hop) {
+    if (hop < POOL || hop > STREAM_WINDOW || hop % POOL != 0)
+        return -1;
+    stream->hop = hop;
+    stream->head = 0;
+    stream->filled = 0;
+    stream->since_decision = 0;
+    stream->block0_valid = 0;
+    stream->n_samples = 0;
+    return 0;
+}
+
+// Block 0 for the pooled outputs out_begin..out_end-1 of the current window
+static void block0_range(eeg_stream_t *stream, int32_t out_begin, int32_t out_end) {
+    conv_max_bn_relu1d(stream->window, conv1d_w[0], stream->block0, conv1d_b[0], bn[0], bn[1], bn[2], bn[3],
+                       STREAM_WINDOW, STREAM_CHANNELS, BLOCK0_LEN, out_begin, out_end);
+}
+
+static int16_t decide(eeg_stream_t *stream, int32_t *reused) {
+    // window in the layout of input_array: channel after channel, oldest sample first
+    for (int32_t ch = 0; ch < STREAM_CHANNELS; ch++) {
+        int16_t *row = stream->window + ch * STREAM_WINDOW;
+        memcpy(row, &stream->ring[ch][stream->head], (STREAM_WINDOW - stream->head) * sizeof(int16_t));
+        memcpy(row + STREAM_WINDOW - stream->head, stream->ring[ch], stream->head * sizeof(int16_t));
+    }
+
+    const int32_t shift = stream->hop / POOL;
+    *reused = stream->block0_valid && shift + 1 < BLOCK0_LEN;
+    if (*reused) {
+        // position j of the new window is position j+shift of the previous one, except at the
+        // edges where the zero padding of the previous window was replaced by samples
+        for (int32_t w_n = 0; w_n < 128; w_n++) {
+            int16_t *row = stream->block0 + w_n * BLOCK0_LEN;
+            memmove(row, row + shift, (BLOCK0_LEN - shift) * sizeof(int16_t));
+        }
+        block0_range(stream, 0, 1);
+        block0_range(stream, BLOCK0_LEN - shift - 1, BLOCK0_LEN);
+    } else {
+        block0_range(stream, 0, BLOCK0_LEN);
+    }
+    stream->block0_valid = 1;
+
+    return forward_propagation_from_block1(stream->block0, stream->map0, stream->map1);
+}
+
+int32_t eeg_stream_push(eeg_stream_t *stream, const int16_t *samples, int32_t n_samples,
+                        eeg_decision_t *decisions, int32_t max_decisions) {
+    int32_t n_decisions = 0;
+
+    for (int32_t t = 0; t < n_samples; t++) {
+        const double arrival = now_us();
+        const int32_t tail = (stream->head + stream->filled) % STREAM_WINDOW;
+        for (int32_t ch = 0; ch < STREAM_CHANNELS; ch++)
+            stream->ring[ch][tail] = samples[t * STREAM_CHANNELS + ch];
+        if (stream->filled < STREAM_WINDOW)
+            stream->filled++;
+        else
+            stream->head = (stream->head + 1) % STREAM_WINDOW;
+        stream->n_samples++;
+        stream->since_decision++;
+
+        if (stream->filled < STREAM_WINDOW || (stream->block0_valid && stream->since_decision < stream->hop))
+            continue;
+        if (stream->since_decision != stream->hop)
+            stream->block0_valid = 0;   // first window, or the map of the previous one is not hop samples behind
+        stream->since_decision = 0;
+
+        int32_t reused;
+        int16_t prediction = decide(stream, &reused);
+        if (n_decisions < max_decisions) {
+            decisions[n_decisions].end_sample = stream->n_samples;
+            decisions[n_decisions].prediction = prediction;
+            decisions[n_decisions].reused = reused;
+            decisions[n_decisions].latency_us = now_us() - arrival;
+            n_decisions++;
+        }
+    }
+    return n_decisions;
+}
+
+// ============================== stream_demo ==============================
+
+#define DEMO_REPEAT 8
+#define DEMO_CHUNK 64                   // samples per push, as delivered by an acquisition DMA
+
+static eeg_stream_t demo_stream;
+static int16_t demo_chunk[DEMO_CHUNK * STREAM_CHANNELS];
+static int16_t demo_map0[256 * 128];
+static int16_t demo_input[INPUT_LEN];
+
+int stream_demo(int32_t hop) {
+    if (eeg_stream_init(&demo_stream, hop) != 0) {
+        printf("hop must be a multiple of %d between %d and %d\n", POOL, POOL, STREAM_WINDOW);
+        return 1;
+    }
+
+    memcpy(demo_input, input_array, sizeof(demo_input));
+    forward_propagation(demo_input, demo_map0);             // the first inference also prepares the weights
+    memcpy(demo_input, input_array, sizeof(demo_input));
+    double start = now_us();
+    int16_t full = forward_propagation(demo_input, demo_map0);
+    printf("Full inference: prediction %d, %.1f us\n", full, now_us() - start);
+    printf("Window %d samples, hop %d samples\n", STREAM_WINDOW, (int) hop);
+
+    double total_latency = 0;
+    int32_t n_total = 0;
+    for (int64_t t = 0; t < (int64_t) DEMO_REPEAT * STREAM_WINDOW; t += DEMO_CHUNK) {
+        for (int32_t i = 0; i < DEMO_CHUNK; i++)
+            for (int32_t ch = 0; ch < STREAM_CHANNELS; ch++)
+                demo_chunk[i * STREAM_CHANNELS + ch] = input_array[ch * STREAM_WINDOW + (t + i) % STREAM_WINDOW];
+
+        eeg_decision_t decisions[DEMO_CHUNK];
+        int32_t n = eeg_stream_push(&demo_stream, demo_chunk, DEMO_CHUNK, decisions, DEMO_CHUNK);
+        for (int32_t k = 0; k < n; k++) {
+            printf("sample %6lld: prediction %d (%s), latency %7.1f us%s\n", (long long) decisions[k].end_sample,
+                   decisions[k].prediction, decisions[k].prediction ? "Seizure" : "Normal", decisions[k].latency_us,
+                   decisions[k].reused ? "" : " (full block 0)");
+            total_latency += decisions[k].latency_us;
+            n_total++;
+        }
+    }
+    if (n_total > 0)
+        printf("%d decisions, mean latency %.1f us\n", (int) n_total, total_latency / n_total);
+    return 0;
+}
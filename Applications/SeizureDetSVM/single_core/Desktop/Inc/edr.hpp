@@ -70,20 +70,24 @@ void MeanFilt(arr_t* arr, int arrSize) {
     // assert((sum > 0? sum : -sum) < 0.1);
 }
 
-template<int ECG_FREQ, int MAX_ECG_SIZE, typename ecg_t, typename rpk_t>
+/**
+ * ECG derived respiration: mean absolute value, around each R peak,
+ * of the ECG minus its baseline. woBaseline is a work array of
+ * ecgSize elements.
+ */
+template<int ECG_FREQ, typename ecg_t, typename rpk_t>
 void EcgDerivedRespiration(
     const ecg_t* ecg,
     int ecgSize,
     const rpk_t* rPeak,
     int rPeakSize,
-    ecg_t* edr
+    ecg_t* edr,
+    ecg_t* woBaseline
 ) {
     constexpr int WIN0 = std::ceil(0.2*ECG_FREQ);
     constexpr int WIN1 = std::ceil(0.6*ECG_FREQ);
     constexpr int INTEGRAL_RADIUS = std::ceil(0.1*ECG_FREQ);
 
-    ecg_t *woBaseline = (ecg_t *) malloc(sizeof(ecg_t) * (MAX_ECG_SIZE));
-    
     // Double filter the signal...
     MeanFilt<WIN0>(ecg, ecgSize, woBaseline);
     MeanFilt<WIN1>(woBaseline, ecgSize);
@@ -103,9 +107,46 @@ void EcgDerivedRespiration(
         }
         edr[i] = integral / (r-l);
     }
-
-    free(woBaseline);
 }
 
+/**
+ * EDR value of a single R peak, equal to the value EcgDerivedRespiration
+ * gives for it over ecg[0..ecgSize). Only the samples the value depends on
+ * (about 0.8 s after the peak) are filtered.
+ */
+template<int ECG_FREQ, typename ecg_t>
+ecg_t EcgDerivedRespirationAt(const ecg_t* ecg, int ecgSize, int center) {
+    constexpr int WIN0 = std::ceil(0.2*ECG_FREQ);
+    constexpr int WIN1 = std::ceil(0.6*ECG_FREQ);
+    constexpr int INTEGRAL_RADIUS = std::ceil(0.1*ECG_FREQ);
+    constexpr int SPAN = 2*INTEGRAL_RADIUS + 1;
+
+    int l = max(center - INTEGRAL_RADIUS, 0);
+    int r = min(center + 1 + INTEGRAL_RADIUS, ecgSize);
+
+    // First mean filter over [l, r + WIN1 - 1), clamped to the end
+    // of the sequence as MeanFilt does.
+    ecg_t mean0[SPAN + WIN1 - 1];
+    int end0 = min(r + WIN1 - 1, ecgSize);
+    for (int k = l; k < end0; ++k) {
+        int n = min(WIN0, ecgSize - k);
+        ecg_t sum = 0;
+        for (int j = k; j < k + n; ++j) {
+            sum += ecg[j];
+        }
+        mean0[k - l] = sum/n;
+    }
+
+    ecg_t integral = 0;
+    for (int j = l; j < r; ++j) {
+        int n = min(WIN1, ecgSize - j);
+        ecg_t sum = 0;
+        for (int k = j; k < j + n; ++k) {
+            sum += mean0[k - l];
+        }
+        integral += std::abs(ecg[j] - sum/n);
+    }
+    return integral / (r-l);
+}
 
 #endif  // EDR_HPP_
@@ -30,10 +30,15 @@ extern "C" {
     #include "lib/fixmath.h"
 }
 #include "global_config.hpp"
+#include "lib/fastlomb.hpp"
 
 #define EDR_LOMBSIZE LOMBSIZE
 
+// plan: FastLomb plan with maxFreq = 1 Hz and ofac = 2
+// power: work array of FLOMB_MAX_SIZE/2 elements for the spectrum
 void ExtractEdrFreqFeatures(
+    FastLombPlan& plan,
+    fixed_t* power,
     const fixed_t* edr,
     const fixed_t* edrTime,
     int edrSize,
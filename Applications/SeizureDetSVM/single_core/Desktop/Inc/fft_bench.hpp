@@ -0,0 +1,36 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////
+// Author:          ESL team                    //
+// Optimizations:   Dimitrios Samakovlis        //
+/////////////////////////////////////////////////
+
+
+
+
+#ifndef FFT_BENCH_HPP_
+#define FFT_BENCH_HPP_
+
+/**
+ * Compares Fft, Fft4 and FftReal for every power-of-two size from 64 to
+ * FLOMB_MAX_SIZE: time (and TSC cycles on x86) per transform, and error
+ * relative to a double-precision DFT of the same fixed-point input.
+ */
+void FftBenchmark();
+
+#endif  // FFT_BENCH_HPP_
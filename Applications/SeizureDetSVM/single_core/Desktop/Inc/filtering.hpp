@@ -28,6 +28,7 @@
 #include <cstdint>
 
 // Remove the moving average of window "window_length" from the current signal
-void remove_moving_average(int32_t *data, int length, int32_t window_length);
+// (new_data: work array of "length" elements)
+void remove_moving_average(int32_t *data, int length, int32_t window_length, int32_t *new_data);
 
 #endif
\ No newline at end of file
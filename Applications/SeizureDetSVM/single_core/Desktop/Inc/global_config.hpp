@@ -47,6 +47,17 @@ constexpr int NON_OVERLAP_SIZE = NON_OVERLAP_SIZE_S * ECG_FREQ;
 constexpr int OVERLAP_SIZE = OVERLAP_SIZE_S * ECG_FREQ;
 constexpr int MOVING_AVG_WINDOW = 15;
 
+// If > 0, main slides the window over the recording (looped) this many
+// times with IncrementalPredictor instead of a single PredictSeizure.
+constexpr int INCREMENTAL_HOPS = 0;
+
+// Use the feature-major SVM (predictColumn) instead of predict.
+constexpr bool SVM_COLUMN_MAJOR = true;
+
+// Use the radix-4 Fft4 in the Lomb-Scargle periodogram instead of Fft
+// (more accurate, so the features differ in the last bits).
+constexpr bool FFT_RADIX4 = false;
+
 constexpr int ADC_FRAC = 4;
 constexpr int ECG_FRAC = 12;
 constexpr int RRI_FRAC = 20;
@@ -0,0 +1,100 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////
+// Author:          ESL team                    //
+// Optimizations:   Dimitrios Samakovlis        //
+/////////////////////////////////////////////////
+
+
+
+
+#ifndef INCREMENTAL_HPP_
+#define INCREMENTAL_HPP_
+
+extern "C" {
+    #include <stdint.h>
+}
+#include "global_config.hpp"
+#include "procedure.hpp"
+#include "rpeak_del.hpp"
+
+/**
+ * IncrementalPredictor: PredictSeizure over a sliding window.
+ *
+ * The window of WIN_SIZE samples advances by NON_OVERLAP_SIZE samples.
+ * The filtered signal, the R peaks and their EDR values of the
+ * OVERLAP_SIZE samples kept are reused, and only the new samples are
+ * filtered and delineated. The result of every window is the same as
+ * PredictSeizure on that window:
+ *  - The first MOVING_AVG_WINDOW-1 filtered samples of the window,
+ *    which only see part of the moving average, are recomputed.
+ *  - A fresh delineation runs from the start of the window until it is
+ *    in the same state as the continuous one (normally within the first
+ *    beat), and the peaks of the continuous delineation are used after.
+ *  - The EDR of a peak is reused when it did not depend on the edges
+ *    of the windows, and is computed around the peak otherwise.
+ * The RRI/EDR features and the SVM then run on the peaks of the window.
+ */
+class IncrementalPredictor {
+ public:
+  IncrementalPredictor();
+
+  // First window: WIN_SIZE samples in ECG_FRAC.
+  Decision Start(const int32_t* ecg);
+
+  // Next window: NON_OVERLAP_SIZE new samples in ECG_FRAC.
+  Decision Advance(const int32_t* ecg);
+
+  // SVM input of the last window (not updated on NO_DECISION).
+  const fixed_t* features() const { return workspace_.feature; }
+
+ private:
+  // Peaks of the continuous delineation (one every INT_LEN samples at most).
+  static constexpr int SCAN_CAPACITY =
+      WIN_SIZE / RpeakScanner<ECG_FREQ, int32_t>::INT_LEN + 1;
+
+  void Filter(int from, int to);
+  void Scan(int from);
+  Decision Predict(const int16_t* freshPeak, int freshSize, int sync);
+
+  int32_t raw_[WIN_SIZE];
+  int32_t ecg_[WIN_SIZE];
+  RpeakScanner<ECG_FREQ, int32_t> scanner_;
+
+  // Continuous delineation: peak, position where it was detected,
+  // its EDR and whether that EDR holds in the next windows.
+  int scanSize_;
+  int16_t scanPeak_[SCAN_CAPACITY];
+  int16_t scanDetect_[SCAN_CAPACITY];
+  int32_t scanEdr_[SCAN_CAPACITY];
+  bool scanEdrFinal_[SCAN_CAPACITY];
+
+  // Feature extraction buffers of this stream
+  FeatureWorkspace workspace_;
+};
+
+/**
+ * Slides the window over ecg (size ADC samples, looped) for hops windows,
+ * once as is and once with a dropout to 0 in the middle, and runs both
+ * IncrementalPredictor and PredictSeizure on every window. A window fails
+ * if the decisions or, when there is a decision, the feature vectors differ.
+ * Returns the number of failed windows.
+ */
+int CheckIncremental(const int32_t* ecg, int size, int hops);
+
+#endif  // INCREMENTAL_HPP_
@@ -27,21 +27,56 @@
 
 #include "fft.hpp"
 
-void FastLomb_initialize();
-
 fixed_t FastLomb_timeSpan(const fixed_t* t, int N);
 
 int FastLomb_numFreqs(fixed_t maxFreq, fixed_t timeSpan, fixed_t ofac);
 
 fixed_t FastLomb_deltaFreq(fixed_t timeSpan, fixed_t ofac);
 
-template<bool VALS_PART>
-void FastLomb_spread(fixed_t x, fixed_t y);
-
-inline void FastLomb_spread_vals(fixed_t x, fixed_t y);
-
-
-inline void FastLomb_spread_time(fixed_t x, fixed_t y);
+/**
+ * FastLombPlan: Fast Lomb periodogram for a fixed (maxFreq, ofac).
+ *
+ * The plan owns the spreading/FFT workspace, so no memory is allocated
+ * per call and several plans can run independently (one per stream).
+ * The values that only depend on timeSpan (FFT size, number of
+ * frequencies, frequency step) are kept for the last timeSpan used.
+ */
+class FastLombPlan {
+ public:
+  static constexpr int MACC = 4;
+
+  FastLombPlan(fixed_t maxFreq, fixed_t ofac);
+
+  int numFreqs(fixed_t timeSpan);
+  fixed_t deltaFreq(fixed_t timeSpan);
+
+  // Writes numFreqs(timeSpan) values of the periodogram of x(t) to output.
+  void run(
+      const fixed_t* x,
+      const fixed_t* t,
+      int len,
+      fixed_t timeSpan,
+      fixed_t* output
+  );
+
+ private:
+  void prepare(fixed_t timeSpan);
+
+  template<bool VALS_PART>
+  void spread(fixed_t x, fixed_t y);
+
+  fixed_t maxFreq_, ofac_;
+
+  bool prepared_;
+  fixed_t timeSpan_;
+  int fftSize_;
+  int nFqs_;
+  fixed_t deltaFreq_;
+  fx_rdiv_t iFftDeltaFq_;
+
+  // The spreading of the last samples can go a few positions past fftSize
+  cn w_[FLOMB_MAX_SIZE + 2*MACC];
+};
 
 void FastLomb_(
     const fixed_t* x,
@@ -151,5 +151,21 @@ inline complex fastmul(complex lhs, const complex& rhs) {
  */
 void Fft (cn pol[], const int n);
 
+/**
+ * Same transform as Fft, computed with radix-4 butterflies (one radix-2
+ * stage first when log2(n) is odd), which need 3 complex multiplications
+ * per 4 points instead of 4. The twiddles come from fft_twiddles.hpp,
+ * in the same format as FFT_FRAC.
+ */
+void Fft4 (cn pol[], const int n);
+
+/**
+ * Transform of n real samples, computed with one complex transform
+ * of n/2 points (even samples as real part, odd samples as imaginary part).
+ * out needs n/2+1 elements and gets the bins 0..n/2 (the others are
+ * their conjugates).
+ */
+void FftReal (const fixed_t x[], cn out[], const int n);
+
 #endif // FFT_HPP_
 
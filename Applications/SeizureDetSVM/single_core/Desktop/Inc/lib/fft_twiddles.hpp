@@ -0,0 +1,51 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////
+// Author:          ESL team                    //
+// Optimizations:   Dimitrios Samakovlis        //
+/////////////////////////////////////////////////
+
+
+
+#ifndef _FFT_TWIDDLES_
+#define _FFT_TWIDDLES_
+
+#include "fft.hpp"
+
+/**
+ * twiddles[k] = exp(2*pi*i*k/FLOMB_MAX_SIZE) for k < 3*FLOMB_MAX_SIZE/4,
+ * rounded to FFT_FRAC bits (Q30 with RISCV_ASS, Q15 otherwise).
+ * Used by Fft4 (up to W^3k) and FftReal.
+ * The table is computed by the static initializer of fft.cpp, before main.
+ */
+struct TwiddleTable {
+    TwiddleTable() {
+        for (int k = 0; k < 3*FLOMB_MAX_SIZE/4; ++k) {
+            double angle = 2*M_PI*k/FLOMB_MAX_SIZE;
+            w[k].real = lround(cos(angle) * (1 << FFT_FRAC));
+            w[k].imag = lround(sin(angle) * (1 << FFT_FRAC));
+        }
+    }
+
+    cn w[3*FLOMB_MAX_SIZE/4];
+};
+
+static const TwiddleTable twiddleTable;
+static const cn* const twiddles = twiddleTable.w;
+
+#endif
@@ -29,6 +29,55 @@
 
 namespace fixpnt_32b {
 
+// Maximum order of the versions with a run-time order
+constexpr int LPC_MAX_ORDER = 32;
+
+/**
+ * Right shift applied to the products seq[j]*seq[j+i]
+ * before accumulating them in 64 bits,
+ * chosen from the magnitude and the size of the sequence.
+ */
+int CorrelationShift(const int32_t* seq, int seqSize);
+
+/**
+ * Normalized correlations norm_corr[i-1] = corr[i]/corr[0], i = 1..order,
+ * with `frac` fractional bits, from the accumulated correlations.
+ */
+void NormalizeCorrelations(
+    const int64_t* corr,
+    int order,
+    int32_t* norm_corr,
+    int frac
+);
+
+/**
+ * Correlations corr[i] = sum_j (seq[j]*seq[j+i]) >> shift of the lags
+ * 0..ORDER, computed in a single pass over the sequence.
+ */
+template<int ORDER>
+void Autocorrelation(
+    const int32_t* seq,
+    int seqSize,
+    int shift,
+    int64_t* corr
+) {
+    int64_t acc[ORDER+1] = {0};
+    int j = 0;
+    for (; j + ORDER < seqSize; ++j) {
+        for (int i = 0; i <= ORDER; ++i) {
+            acc[i] += ((int64_t)seq[j]*seq[j+i]) >> shift;
+        }
+    }
+    for (; j < seqSize; ++j) {
+        for (int i = 0; j + i < seqSize; ++i) {
+            acc[i] += ((int64_t)seq[j]*seq[j+i]) >> shift;
+        }
+    }
+    for (int i = 0; i <= ORDER; ++i) {
+        corr[i] = acc[i];
+    }
+}
+
 /**
  * Computes the linear prediction coefficients of a sequence
  * obtained via the root mean square criterion or correlation method,
@@ -42,7 +91,7 @@ namespace fixpnt_32b {
  *
  * @param seq input sequence, computed at any scale.
  * @param seqSize size of `seq`.
- * @param order number of coefficients calculated.
+ * @param order number of coefficients calculated (at most LPC_MAX_ORDER).
  * @param coeffs array of size `order` to store the coefficients.
  * @param frac number of fractional bits used during computation.
  */
@@ -81,6 +130,24 @@ void ComputeLinPredCoeffs(
     int frac
 );
 
+/**
+ * Same as ComputeLinPredCoeffs(seq, seqSize, ORDER, coeffs, frac),
+ * with all the correlations computed by Autocorrelation<ORDER>.
+ */
+template<int ORDER>
+void ComputeLinPredCoeffs(
+    const int32_t* seq,
+    int seqSize,
+    int32_t* coeffs,
+    int frac
+) {
+    int64_t corr[ORDER+1];
+    Autocorrelation<ORDER>(seq, seqSize, CorrelationShift(seq, seqSize), corr);
+    int32_t norm_corr[ORDER];
+    NormalizeCorrelations(corr, ORDER, norm_corr, frac);
+    ComputeLinPredCoeffs(norm_corr, ORDER, coeffs, frac);
+}
+
 namespace acc_32b {
 
 /**
@@ -96,7 +163,7 @@ namespace acc_32b {
  *
  * @param seq input sequence, computed at any scale.
  * @param seqSize size of `seq`.
- * @param order number of coefficients calculated.
+ * @param order number of coefficients calculated (at most LPC_MAX_ORDER).
  * @param coeffs array of size `order` to store the coefficients.
  * @param frac number of fractional bits used during computation.
  */
@@ -0,0 +1,60 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////
+// Author:          ESL team                    //
+// Optimizations:   Dimitrios Samakovlis        //
+/////////////////////////////////////////////////
+
+
+
+
+#ifndef SCRATCH_ARENA_HPP_
+#define SCRATCH_ARENA_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * ScratchArena: fixed-capacity stack allocator for the per-window arrays,
+ * so that their size is bounded at compile time (no VLAs, no heap).
+ *
+ * A function takes its arrays after a mark() and gives them back
+ * with release(mark) before returning.
+ */
+template<int BYTES>
+class ScratchArena {
+ public:
+  // Array of count elements, or nullptr if the arena is full
+  template<typename T>
+  T* take(int count) {
+    size_t start = (used_ + alignof(T) - 1) & ~(alignof(T) - 1);
+    if (start + count*sizeof(T) > BYTES) return nullptr;
+    used_ = start + count*sizeof(T);
+    return reinterpret_cast<T*>(mem_ + start);
+  }
+
+  size_t mark() const { return used_; }
+
+  void release(size_t mark) { used_ = mark; }
+
+ private:
+  alignas(8) uint8_t mem_[BYTES];
+  size_t used_ = 0;
+};
+
+#endif  // SCRATCH_ARENA_HPP_
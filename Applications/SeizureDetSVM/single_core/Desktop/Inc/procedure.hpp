@@ -28,10 +28,66 @@
 extern "C"{
 #include <stdint.h>
 }
+#include "global_config.hpp"
+#include "lib/fastlomb.hpp"
+#include "lib/scratch_arena.hpp"
 
 const int RPEAK_CAPACITY = 150;
 
-bool PredictSeizure(int32_t* ecg, int ecgSize);
+// Fewer R peaks in a window (10 bpm) is a dropout of the signal, and the
+// LPC of the EDR needs more samples than its order
+const int MIN_RPEAKS = EDR_LPC_ORDER + 1;
+
+// NO_DECISION: the window has too few R peaks, or a constant RRI or EDR,
+// for the features (signal dropout, flat or saturated input)
+enum class Decision { NON_SEIZURE, SEIZURE, NO_DECISION };
+
+// Largest use of the scratch arena, in fixed_t: the EDR and the ECG without
+// baseline in PredictSeizure, or the EDR with the HRV, the R peak times and
+// the rescaled EDR in PredictFromRpeaks (the moving average alone is WIN_SIZE)
+constexpr int SCRATCH_PEAK_ELEMS =
+    (RPEAK_CAPACITY + WIN_SIZE > 4*RPEAK_CAPACITY) ?
+    RPEAK_CAPACITY + WIN_SIZE : 4*RPEAK_CAPACITY;
+
+/**
+ * FeatureWorkspace: every per-window buffer of PredictSeizure,
+ * sized at compile time and reused from one window to the next.
+ * Streams processed independently need one workspace each.
+ */
+struct FeatureWorkspace {
+  FeatureWorkspace();
+
+  // Lomb periodogram of the RRI and EDR (maxFreq = 1 Hz, ofac = 2),
+  // which owns the spreading/FFT workspace, and its spectrum
+  FastLombPlan lomb;
+  fixed_t power[FLOMB_MAX_SIZE/2];
+
+  int16_t rPeak[RPEAK_CAPACITY];
+  int16_t rri[RPEAK_CAPACITY-1];
+  fixed_t edrFreqFeat[EDR_NUM_FREQ_FEATS];
+  fixed_t edrLpc[EDR_LPC_ORDER];
+  fixed_t feature[NUM_FEATURES];
+
+  // Arrays of the size of the window or of the R peaks: the moving
+  // average, the ECG without baseline, the EDR, the HRV and the R peak times
+  // (+ 8 bytes of alignment for each of the 4 arrays held together)
+  ScratchArena<SCRATCH_PEAK_ELEMS*sizeof(fixed_t) + 32> scratch;
+};
+
+// ecgSize <= WIN_SIZE
+Decision PredictSeizure(FeatureWorkspace& ws, int32_t* ecg, int ecgSize);
+
+// PredictSeizure with a workspace of its own (one stream)
+Decision PredictSeizure(int32_t* ecg, int ecgSize);
+
+/**
+ * Second half of PredictSeizure: extracts the RRI and EDR features
+ * from the R peaks of a window and their EDR values (ECG_FRAC)
+ * and runs the SVM on them. rPeakSize <= RPEAK_CAPACITY.
+ */
+Decision PredictFromRpeaks(
+    FeatureWorkspace& ws, const int16_t* rPeak, const int32_t* edr, int rPeakSize
+);
 
 #endif  // PROCEDURE_HPP_
 
@@ -80,7 +80,7 @@ int DelineateRpeaks(
                 rPeak[*rPeakSize] = argmax;
                 *rPeakSize += 1;
                 // ... and skip the next INT_LEN-1 windows.
-                for (int r = 0; r < INT_LEN-1; ++r) {
+                for (int r = 0; r < INT_LEN-1 && i+1 < ecgSize; ++r) {
                     ++i;
                     eroder.process(i);
                     dilator.process(i);
@@ -114,5 +114,56 @@ int DelineateRpeaks(
     return 0;
 }
 
+/**
+ * Resumable version of the INT_LEN >= 10 path of DelineateRpeaks.
+ * Positions are fed one by one with process(); the detections are
+ * the same as those of DelineateRpeaks run from the first position fed.
+ * shift() moves the positions held in the internal queues when the
+ * buffer they index is shifted to the left by off samples.
+ */
+template<int ECG_FREQ, typename ecg_t>
+class RpeakScanner {
+ public:
+  static constexpr int INT_LEN = std::ceil(0.2*ECG_FREQ);
+  static_assert(INT_LEN >= 10, "RpeakScanner needs the eroder path");
+
+  RpeakScanner(const ecg_t* ecg, ecg_t threshold = 1500) :
+      ecg_(ecg), eroder_(ecg), dilator_(ecg), threshold_(threshold) {}
+
+  // True if the next call to process() tests for a peak
+  // (it is not in the first INT_LEN-1 positions or just after a peak).
+  inline bool testing() const {
+    return skip_ == 0;
+  }
+
+  // Returns true, and the R peak in *rPeak, if a peak is found at pos.
+  inline bool process(int pos, int* rPeak) {
+    uint16_t argmin = eroder_.process(pos);
+    uint16_t argmax = dilator_.process(pos);
+    if (skip_ > 0) {
+      --skip_;
+      return false;
+    }
+    if (ecg_[argmax] - ecg_[argmin] > threshold_) {
+      *rPeak = argmax;
+      skip_ = INT_LEN-1;
+      return true;
+    }
+    return false;
+  }
+
+  inline void shift(int16_t off) {
+    eroder_.applyOffset(-off);
+    dilator_.applyOffset(-off);
+  }
+
+ private:
+  const ecg_t* ecg_;
+  ArgEroder<INT_LEN, ecg_t> eroder_;
+  ArgDilator<INT_LEN, ecg_t> dilator_;
+  ecg_t threshold_;
+  int skip_ = INT_LEN-1;
+};
+
 #endif  // RPEAK_DEL_HPP_
 
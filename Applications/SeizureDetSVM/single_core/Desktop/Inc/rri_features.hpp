@@ -30,6 +30,7 @@ extern "C" {
     #include "lib/fixmath.h"
 }
 #include "global_config.hpp"
+#include "lib/fastlomb.hpp"
 
 // ECG Frequency: Used for normalization to
 // translate rri from index difference to seconds
@@ -79,7 +80,11 @@ struct RriFreqFeats {
     fixed_t lowToHighFreqRatio;
 };
 
+// plan: FastLomb plan with maxFreq = 1 Hz and ofac = 2
+// power: work array of FLOMB_MAX_SIZE/2 elements for the spectrum
 RriFreqFeats ExtractRriFreqFeatures(
+    FastLombPlan& plan,
+    fixed_t* power,
     const fixed_t* hrv,
     const fixed_t* rriTime,
     int rriSize
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////
+// Author:          ESL team                    //
+// Optimizations:   Dimitrios Samakovlis        //
+/////////////////////////////////////////////////
+
+
+
+
+#ifndef STREAM_HPP_
+#define STREAM_HPP_
+
+extern "C" {
+    #include <stdio.h>
+    #include <stdint.h>
+}
+
+enum class StreamFormat {
+    CSV,        // Text samples separated by whitespace and/or commas (as ecg.csv)
+    RAW_INT16   // Native-endian int16_t samples
+};
+
+struct StreamStats {
+    int predictions;
+    int seizures;
+    int noDecisions;    // Windows with too few R peaks (see Decision)
+    // Latency of a prediction (ms)
+    double p50, p90, p99, max;
+};
+
+/**
+ * Reads an unbounded ECG stream (ADC_FRAC samples at ECG_FREQ) until EOF.
+ * The last WIN_SIZE samples are kept in a ring buffer and a prediction
+ * is made every NON_OVERLAP_SIZE samples once the first window is full,
+ * with PredictSeizure or, if incremental, with IncrementalPredictor.
+ * Every decision is written to out with the stream time of the end of
+ * its window and the latency of the prediction. Windows without enough
+ * R peaks (flat input, dropout) are reported as NO_DECISION.
+ */
+StreamStats RunEcgStream(FILE* in, FILE* out, StreamFormat format, bool incremental);
+
+void OutputStreamStats(FILE* out, const StreamStats& stats);
+
+/**
+ * Runs RunEcgStream, incremental and full, on inputs without usable
+ * R peaks: a flat signal, uniform noise and ecg (size ADC samples, looped)
+ * with a dropout to 0 in the middle. Fails if a stream stops early or if
+ * a window of the flat signal gets a decision. Returns 0 if all pass.
+ */
+int CheckDegenerateStreams(const int32_t* ecg, int size);
+
+#endif  // STREAM_HPP_
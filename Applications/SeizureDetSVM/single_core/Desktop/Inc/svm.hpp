@@ -35,5 +35,19 @@
  */
 fixed_t predict(fixed_t* feature);
 
+/**
+ * Same result as predict, with the support vectors stored feature-major
+ * so that each feature updates the distances to all of them at once
+ * (SVM_SIZE contiguous lanes, which the compiler vectorizes).
+ */
+fixed_t predictColumn(fixed_t* feature);
+
+/**
+ * Scores n feature vectors stored one after the other
+ * (n*NUM_FEATURES values) with predictColumn. As in predict,
+ * the features are normalized in place.
+ */
+void predictBatch(fixed_t* features, int n, fixed_t* out);
+
 #endif  // SVM_HPP_
 
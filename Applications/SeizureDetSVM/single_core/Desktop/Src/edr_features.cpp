@@ -26,21 +26,19 @@
 #include "lib/fastlomb.hpp"
 #include "edr.hpp"
 
-extern fixed_t *power;
-
 void ExtractEdrFreqFeatures(
+    FastLombPlan& plan,
+    fixed_t* power,
     const fixed_t* edr,
     const fixed_t* edrTime,
     int edrSize,
     fixed_t* feat,
     int featSize
 ) {
-    const fixed_t maxFreq = fx_itox(1, FLOMB_FRAC); // Hz
     const fixed_t timeSpan = FastLomb_timeSpan(edrTime, edrSize); // s
-    const fixed_t ofac = fx_itox(2, FLOMB_FRAC);
-    int nfs = FastLomb_numFreqs(maxFreq, timeSpan, ofac);
+    int nfs = plan.numFreqs(timeSpan);
 
-    FastLomb_(edr, edrTime, edrSize, timeSpan, maxFreq, power, ofac);
+    plan.run(edr, edrTime, edrSize, timeSpan, power);
 
     int64_t sumf = 0;
     for (int i = 0; i < nfs; ++i) {
@@ -55,9 +53,7 @@ void ExtractEdrFreqFeatures(
         }
         l = r;
     }
-    
-    free((void *) power);
-    
+
     fx_rdiv_t isumf;
     
     fx_invx(sumf>>5, FLOMB_FRAC, &isumf);
@@ -0,0 +1,135 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////
+// Author:          ESL team                    //
+// Optimizations:   Dimitrios Samakovlis        //
+/////////////////////////////////////////////////
+
+
+
+
+#include "fft_bench.hpp"
+extern "C" {
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <string.h>
+    #include <math.h>
+    #include <time.h>
+}
+#include "lib/fft.hpp"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define FFT_BENCH_TSC
+#endif
+
+// Input amplitude: leaves room for the growth of the unscaled transform
+static constexpr int AMPLITUDE = 1 << 16;
+static constexpr int REPEAT = 200;
+
+static cn input[FLOMB_MAX_SIZE];
+static cn work[FLOMB_MAX_SIZE];
+static fixed_t realInput[FLOMB_MAX_SIZE];
+static double refReal[FLOMB_MAX_SIZE], refImag[FLOMB_MAX_SIZE];
+
+static double Now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static uint64_t Cycles() {
+#ifdef FFT_BENCH_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// X[k] = sum x[m] exp(2*pi*i*m*k/n), the sign convention of the twiddles
+static void Dft(const cn* x, int n) {
+    for (int k = 0; k < n; ++k) {
+        double re = 0, im = 0;
+        for (int m = 0; m < n; ++m) {
+            double a = 2 * M_PI * (double)((int64_t)m * k % n) / n;
+            re += x[m].real * cos(a) - x[m].imag * sin(a);
+            im += x[m].real * sin(a) + x[m].imag * cos(a);
+        }
+        refReal[k] = re;
+        refImag[k] = im;
+    }
+}
+
+// Relative RMS error of the first bins of out against the reference
+static double Error(const cn* out, int bins) {
+    double err = 0, ref = 0;
+    for (int k = 0; k < bins; ++k) {
+        double dr = out[k].real - refReal[k], di = out[k].imag - refImag[k];
+        err += dr*dr + di*di;
+        ref += refReal[k]*refReal[k] + refImag[k]*refImag[k];
+    }
+    return sqrt(err / ref);
+}
+
+typedef void (*ComplexFft)(cn[], const int);
+
+static void RunComplex(const char* name, ComplexFft fft, int n) {
+    double t0 = Now();
+    uint64_t c0 = Cycles();
+    for (int r = 0; r < REPEAT; ++r) {
+        memcpy(work, input, n * sizeof(cn));
+        fft(work, n);
+    }
+    uint64_t c1 = Cycles();
+    double t1 = Now();
+    printf("%5d  %-8s %9.2f us %10.0f cycles   error %.2e\n", n, name,
+           (t1 - t0) / REPEAT * 1e6, (double)(c1 - c0) / REPEAT, Error(work, n));
+}
+
+void FftBenchmark() {
+    unsigned seed = 1;
+    printf("    n  kernel        time         TSC   relative RMS error\n");
+    for (int n = 64; n <= FLOMB_MAX_SIZE; n <<= 1) {
+        for (int i = 0; i < n; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            input[i].real = (int32_t)(seed >> 8) % AMPLITUDE;
+            seed = seed * 1103515245u + 12345u;
+            input[i].imag = (int32_t)(seed >> 8) % AMPLITUDE;
+        }
+        Dft(input, n);
+        RunComplex("Fft", Fft, n);
+        RunComplex("Fft4", Fft4, n);
+
+        // Real input: Fft on (x, 0) against FftReal on x
+        for (int i = 0; i < n; ++i) {
+            realInput[i] = input[i].real;
+            input[i].imag = 0;
+        }
+        Dft(input, n);
+        RunComplex("Fft re", Fft, n);
+
+        double t0 = Now();
+        uint64_t c0 = Cycles();
+        for (int r = 0; r < REPEAT; ++r) {
+            FftReal(realInput, work, n);
+        }
+        uint64_t c1 = Cycles();
+        double t1 = Now();
+        printf("%5d  %-8s %9.2f us %10.0f cycles   error %.2e\n", n, "FftReal",
+               (t1 - t0) / REPEAT * 1e6, (double)(c1 - c0) / REPEAT, Error(work, n/2 + 1));
+    }
+}
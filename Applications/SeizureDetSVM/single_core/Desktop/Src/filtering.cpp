@@ -31,9 +31,7 @@ extern "C"  {
 }
 
 // Remove the moving average of window "window_length" from the current signal
-void remove_moving_average(int32_t *data, int length, int32_t window_length)   {
-
-    int32_t *new_data = (int32_t *) malloc(length * sizeof(int32_t));
+void remove_moving_average(int32_t *data, int length, int32_t window_length, int32_t *new_data)   {
 
     // Calculate moving average
     int32_t sum = 0;
@@ -49,6 +47,4 @@ void remove_moving_average(int32_t *data, int length, int32_t window_length)   {
     for (int i = 0; i < length; i++)    {
         data[i] = data[i] - new_data[i];
     }
-
-    free(new_data);
 }
\ No newline at end of file
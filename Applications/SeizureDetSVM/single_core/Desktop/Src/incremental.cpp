@@ -0,0 +1,238 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////
+// Author:          ESL team                    //
+// Optimizations:   Dimitrios Samakovlis        //
+/////////////////////////////////////////////////
+
+
+
+
+#include "incremental.hpp"
+extern "C" {
+    #include <stdio.h>
+    #include <string.h>
+    #include "lib/fixmath.h"
+}
+#include "edr.hpp"
+#include "lib/utils.hpp"
+
+namespace {
+
+constexpr int INT_LEN = RpeakScanner<ECG_FREQ, int32_t>::INT_LEN;
+constexpr int INTEGRAL_RADIUS = std::ceil(0.1*ECG_FREQ);
+constexpr int EDR_WIN0 = std::ceil(0.2*ECG_FREQ);
+constexpr int EDR_WIN1 = std::ceil(0.6*ECG_FREQ);
+
+// Filtered samples that only see part of the moving average.
+constexpr int FILTER_HEAD = MOVING_AVG_WINDOW - 1;
+// From here on, both delineations see the same INT_LEN samples.
+constexpr int SYNC_FROM = FILTER_HEAD + INT_LEN - 1;
+// EDR of the peaks in [EDR_HEAD, WIN_SIZE - EDR_TAIL] does not
+// depend on the edges of the window.
+constexpr int EDR_HEAD = FILTER_HEAD + INTEGRAL_RADIUS;
+constexpr int EDR_TAIL = INTEGRAL_RADIUS + EDR_WIN0 + EDR_WIN1 - 1;
+
+}  // namespace
+
+IncrementalPredictor::IncrementalPredictor() :
+    scanner_(ecg_, fx_itox(1500, ECG_FRAC)), scanSize_(0) {}
+
+// Same as remove_moving_average, for the samples [from, to) of the window.
+void IncrementalPredictor::Filter(int from, int to) {
+    int32_t sum = 0;
+    for (int i = max(from - MOVING_AVG_WINDOW, 0); i < from; ++i) {
+        sum += raw_[i];
+    }
+    for (int i = from; i < to; ++i) {
+        sum += raw_[i];
+        if (i - MOVING_AVG_WINDOW >= 0)
+            sum -= raw_[i - MOVING_AVG_WINDOW];
+        ecg_[i] = raw_[i] - sum / MOVING_AVG_WINDOW;
+    }
+}
+
+// Continuous delineation of the samples [from, WIN_SIZE) of the window.
+void IncrementalPredictor::Scan(int from) {
+    for (int i = from; i < WIN_SIZE; ++i) {
+        int rPeak;
+        if (scanner_.process(i, &rPeak) && scanSize_ < SCAN_CAPACITY) {
+            scanPeak_[scanSize_] = rPeak;
+            scanDetect_[scanSize_] = i;
+            scanEdrFinal_[scanSize_] = false;
+            ++scanSize_;
+        }
+    }
+}
+
+Decision IncrementalPredictor::Start(const int32_t* ecg) {
+    memcpy(raw_, ecg, WIN_SIZE * sizeof(int32_t));
+    Filter(0, WIN_SIZE);
+
+    scanner_ = RpeakScanner<ECG_FREQ, int32_t>(ecg_, fx_itox(1500, ECG_FRAC));
+    scanSize_ = 0;
+    Scan(0);
+
+    return Predict(NULL, 0, 0);
+}
+
+Decision IncrementalPredictor::Advance(const int32_t* ecg) {
+    // Slide the window
+    memmove(raw_, raw_ + NON_OVERLAP_SIZE, OVERLAP_SIZE * sizeof(int32_t));
+    memcpy(raw_ + OVERLAP_SIZE, ecg, NON_OVERLAP_SIZE * sizeof(int32_t));
+    memmove(ecg_, ecg_ + NON_OVERLAP_SIZE, OVERLAP_SIZE * sizeof(int32_t));
+    Filter(OVERLAP_SIZE, WIN_SIZE);
+    Filter(0, FILTER_HEAD);
+
+    // Keep the peaks detected in the overlap and delineate the new samples
+    scanner_.shift(NON_OVERLAP_SIZE);
+    int kept = 0;
+    for (int i = 0; i < scanSize_; ++i) {
+        if (scanDetect_[i] >= NON_OVERLAP_SIZE) {
+            scanPeak_[kept] = scanPeak_[i] - NON_OVERLAP_SIZE;
+            scanDetect_[kept] = scanDetect_[i] - NON_OVERLAP_SIZE;
+            scanEdr_[kept] = scanEdr_[i];
+            scanEdrFinal_[kept] = scanEdrFinal_[i];
+            ++kept;
+        }
+    }
+    scanSize_ = kept;
+    Scan(OVERLAP_SIZE);
+
+    // Delineate the start of the window from scratch until both
+    // delineations test the same position with the same samples.
+    RpeakScanner<ECG_FREQ, int32_t> fresh(ecg_, fx_itox(1500, ECG_FRAC));
+    int16_t freshPeak[SCAN_CAPACITY];
+    int freshSize = 0;
+    int sync = WIN_SIZE;
+    int next = 0;
+    for (int i = 0; i < WIN_SIZE; ++i) {
+        if (i >= SYNC_FROM && fresh.testing()) {
+            while (next < scanSize_ && scanDetect_[next] < i) {
+                ++next;
+            }
+            if (next == 0 || i - scanDetect_[next-1] >= INT_LEN) {
+                sync = i;
+                break;
+            }
+        }
+        int rPeak;
+        if (fresh.process(i, &rPeak) && freshSize < SCAN_CAPACITY) {
+            freshPeak[freshSize++] = rPeak;
+        }
+    }
+
+    return Predict(freshPeak, freshSize, sync);
+}
+
+// Runs the features and the SVM on the peaks of the fresh delineation
+// followed by those of the continuous one detected from sync on.
+Decision IncrementalPredictor::Predict(const int16_t* freshPeak, int freshSize, int sync) {
+    int16_t rPeak[RPEAK_CAPACITY];
+    fixed_t edr[RPEAK_CAPACITY];
+    int rPeakSize = 0;
+
+    for (int i = 0; i < freshSize && rPeakSize < RPEAK_CAPACITY; ++i) {
+        rPeak[rPeakSize] = freshPeak[i];
+        edr[rPeakSize] = EcgDerivedRespirationAt<ECG_FREQ>(
+            ecg_, WIN_SIZE, freshPeak[i]
+        );
+        ++rPeakSize;
+    }
+    for (int i = 0; i < scanSize_ && rPeakSize < RPEAK_CAPACITY; ++i) {
+        if (scanDetect_[i] < sync) {
+            continue;
+        }
+        int center = scanPeak_[i];
+        rPeak[rPeakSize] = center;
+        if (scanEdrFinal_[i] && center >= EDR_HEAD) {
+            edr[rPeakSize] = scanEdr_[i];
+        } else {
+            edr[rPeakSize] = EcgDerivedRespirationAt<ECG_FREQ>(
+                ecg_, WIN_SIZE, center
+            );
+            if (center >= EDR_HEAD && center < WIN_SIZE - EDR_TAIL) {
+                scanEdr_[i] = edr[rPeakSize];
+                scanEdrFinal_[i] = true;
+            }
+        }
+        ++rPeakSize;
+    }
+
+    return PredictFromRpeaks(workspace_, rPeak, edr, rPeakSize);
+}
+
+namespace {
+
+IncrementalPredictor checkPredictor;
+FeatureWorkspace checkWorkspace;
+int32_t checkWindow[WIN_SIZE];
+
+// Sample k of the checked stream: ecg looped, with a dropout of one window
+// from the second hop on (in ECG_FRAC)
+int32_t CheckSample(const int32_t* ecg, int size, bool dropout, long k) {
+    if (dropout && k >= WIN_SIZE + NON_OVERLAP_SIZE && k < 2*WIN_SIZE + NON_OVERLAP_SIZE) {
+        return 0;
+    }
+    return fx_xtox(ecg[k % size], ADC_FRAC, ECG_FRAC);
+}
+
+}  // namespace
+
+int CheckIncremental(const int32_t* ecg, int size, int hops) {
+    int failures = 0;
+
+    for (int dropout = 0; dropout < 2; ++dropout) {
+        int windows = 0, noDecisions = 0, failed = 0;
+        for (int h = 0; h <= hops; ++h) {
+            long end = WIN_SIZE + (long) h * NON_OVERLAP_SIZE;
+            Decision incremental;
+            if (h == 0) {
+                for (int i = 0; i < WIN_SIZE; ++i) {
+                    checkWindow[i] = CheckSample(ecg, size, dropout, i);
+                }
+                incremental = checkPredictor.Start(checkWindow);
+            } else {
+                for (int i = 0; i < NON_OVERLAP_SIZE; ++i) {
+                    checkWindow[i] = CheckSample(ecg, size, dropout, end - NON_OVERLAP_SIZE + i);
+                }
+                incremental = checkPredictor.Advance(checkWindow);
+            }
+
+            // PredictSeizure filters the window in place
+            for (int i = 0; i < WIN_SIZE; ++i) {
+                checkWindow[i] = CheckSample(ecg, size, dropout, end - WIN_SIZE + i);
+            }
+            Decision full = PredictSeizure(checkWorkspace, checkWindow, WIN_SIZE);
+
+            bool same = incremental == full && (full == Decision::NO_DECISION ||
+                memcmp(checkPredictor.features(), checkWorkspace.feature, sizeof(checkWorkspace.feature)) == 0);
+            if (!same) {
+                fprintf(stderr, "%s window %d: incremental and full results differ\n",
+                        dropout ? "dropout" : "recording", h);
+            }
+            ++windows;
+            noDecisions += full == Decision::NO_DECISION;
+            failed += !same;
+        }
+        printf("%-9s %d windows (%d no decision), %d mismatches: %s\n",
+               dropout ? "dropout" : "recording", windows, noDecisions, failed, failed ? "FAIL" : "PASS");
+        failures += failed;
+    }
+    return failures;
+}
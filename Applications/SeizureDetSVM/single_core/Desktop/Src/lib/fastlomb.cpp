@@ -32,14 +32,12 @@ extern "C" {
     #include "fixmath.h"
 }
 
-#define MACC 4
+static constexpr int MACC = FastLombPlan::MACC;
 
-static int FastLomb_nck[MACC] = {1, 3, 3, 1};
-int FastLomb_fact = 6;
-static cn *w;
-fixed_t mean, var;
+static const int FastLomb_nck[MACC] = {1, 3, 3, 1};
+static const int FastLomb_fact = 6;
 
-inline void Mean_and_Variance(const fixed_t* input, int len, int frac) {
+static inline void Mean_and_Variance(const fixed_t* input, int len, int frac, fixed_t* mean, fixed_t* var) {
     int64_t mean_sum = 0, var_sum = 0;
     
     for (int i = 0; i < len; ++i) {
@@ -47,8 +45,8 @@ inline void Mean_and_Variance(const fixed_t* input, int len, int frac) {
 	var_sum += ((int64_t)input[i]*input[i]) >> frac;
     }
     
-    mean = mean_sum/len;
-    var = (var_sum - len*(((int64_t)mean*mean) >> frac))/(len-1);
+    *mean = mean_sum/len;
+    *var = (var_sum - len*(((int64_t)(*mean)*(*mean)) >> frac))/(len-1);
 }
 
 //Initialization integrated at Fastlomb_
@@ -70,15 +68,46 @@ fixed_t FastLomb_deltaFreq(
     return fx_invx(aux, FLOMB_FRAC, nullptr);
 }
 
+FastLombPlan::FastLombPlan(fixed_t maxFreq, fixed_t ofac) :
+    maxFreq_(maxFreq), ofac_(ofac), prepared_(false) {}
+
+void FastLombPlan::prepare(fixed_t timeSpan) {
+    if (prepared_ && timeSpan == timeSpan_) {
+        return;
+    }
+
+    fixed_t aux0 = fx_mulx(ofac_, timeSpan, FLOMB_FRAC);
+    fixed_t aux1 = fx_mulx(aux0, maxFreq_, FLOMB_FRAC);
+    int minFftSize = 4*MACC*fx_ceilx(aux1, FLOMB_FRAC);
+    fftSize_ = 64;
+    while (fftSize_ < minFftSize) fftSize_ *= 2;
+
+    fx_invx(aux0, FLOMB_FRAC, &iFftDeltaFq_);
+    nFqs_ = FastLomb_numFreqs(maxFreq_, timeSpan, ofac_);
+    deltaFreq_ = FastLomb_deltaFreq(timeSpan, ofac_);
+
+    timeSpan_ = timeSpan;
+    prepared_ = true;
+}
+
+int FastLombPlan::numFreqs(fixed_t timeSpan) {
+    prepare(timeSpan);
+    return nFqs_;
+}
+
+fixed_t FastLombPlan::deltaFreq(fixed_t timeSpan) {
+    prepare(timeSpan);
+    return deltaFreq_;
+}
 
 template<bool VALS_PART>
-void FastLomb_spread(fixed_t x, fixed_t y) {
+void FastLombPlan::spread(fixed_t x, fixed_t y) {
     fixed_t floorX = fx_floorx(x, FLOMB_FRAC);
     if (x == fx_itox(floorX, FLOMB_FRAC)) {
         if (VALS_PART) {
-                w[floorX].real += y;
+                w_[floorX].real += y;
         } else {
-                w[floorX].imag += y;
+                w_[floorX].imag += y;
         }
         return;
     }
@@ -98,72 +127,53 @@ void FastLomb_spread(fixed_t x, fixed_t y) {
         fixed_t add = fac1*FastLomb_nck[i-l];
 
         if (VALS_PART) {
-                w[i].real += add;
+                w_[i].real += add;
         } else {
-                w[i].imag += add;
+                w_[i].imag += add;
         }
         ctantTerm = -ctantTerm;
     }
 }
 
-inline void FastLomb_spread_vals(
-    fixed_t x, fixed_t y
-) {
-     FastLomb_spread<true>(x, y);
-}
-
-
-inline void FastLomb_spread_time(
-    fixed_t x, fixed_t y
-) {
-    FastLomb_spread<false>(x, y);
-}
-
-fx_rdiv_t iFftDeltaFq, istd;
-int fftSize;
-
-void FastLomb_(
+void FastLombPlan::run(
     const fixed_t* x,
     const fixed_t* t,
     int len,
     fixed_t timeSpan,
-    fixed_t maxFreq,
-    fixed_t* output,
-    fixed_t ofac
+    fixed_t* output
 ) {
-    
-    w = (cn *) malloc(sizeof(cn) * FLOMB_MAX_SIZE);
-	
-    fixed_t aux0 = fx_mulx(ofac, timeSpan, FLOMB_FRAC);
-    fixed_t aux1 = fx_mulx(aux0, maxFreq, FLOMB_FRAC);
-    int minFftSize = 4*MACC*fx_ceilx(aux1, FLOMB_FRAC);
-    fftSize = 64;
-    while (fftSize < minFftSize) fftSize *= 2;
+    prepare(timeSpan);
+    const int fftSize = fftSize_;
+    cn* w = w_;
 	
     // Extarpolation
     for (int i = 0; i < fftSize; ++i) {
 	    w[i] = {0, 0};
     }
     
-    Mean_and_Variance(x, len, FLOMB_FRAC);
+    fixed_t mean, var;
+    Mean_and_Variance(x, len, FLOMB_FRAC, &mean, &var);
     
-    fixed_t aux = fx_mulx(ofac, timeSpan, FLOMB_FRAC);
-    fx_invx(aux, FLOMB_FRAC, &iFftDeltaFq);
+    fx_rdiv_t istd;
     fixed_t std = fx_sqrtx(var, FLOMB_FRAC);
     fx_invx(std, FLOMB_FRAC, &istd);
 
     for (int i = 0; i < len; i++) {
-        fixed_t fftIndex = fx_itox(MACC/2-1, FLOMB_FRAC) + fx_rdivx((t[i] - t[0]), &iFftDeltaFq)*fftSize;
+        fixed_t fftIndex = fx_itox(MACC/2-1, FLOMB_FRAC) + fx_rdivx((t[i] - t[0]), &iFftDeltaFq_)*fftSize;
         fixed_t normalized = fx_rdivx(x[i] - mean, &istd);
-        FastLomb_spread_vals(fftIndex, normalized);
+        spread<true>(fftIndex, normalized);
         fftIndex *= 2;
-        FastLomb_spread_time(fftIndex, fx_itox(1, FLOMB_FRAC));
+        spread<false>(fftIndex, fx_itox(1, FLOMB_FRAC));
     }
     
     // Fast Fourrier Transform
-    Fft(w, fftSize);
+    if (FFT_RADIX4) {
+        Fft4(w, fftSize);
+    } else {
+        Fft(w, fftSize);
+    }
     
-    int nFqs = FastLomb_numFreqs(maxFreq, timeSpan, ofac);
+    int nFqs = nFqs_;
     
     for (int i = 0; i < nFqs; i++) {
 	    fixed_t w2real = (w[fftSize-i-1].imag + w[i+1].imag)/2;
@@ -198,8 +208,19 @@ void FastLomb_(
         
         output[i] = cterm + sterm;
     }
+}
 
-    free((void *) w);
+void FastLomb_(
+    const fixed_t* x,
+    const fixed_t* t,
+    int len,
+    fixed_t timeSpan,
+    fixed_t maxFreq,
+    fixed_t* output,
+    fixed_t ofac
+) {
+    FastLombPlan plan(maxFreq, ofac);
+    plan.run(x, t, len, timeSpan, output);
 }
 
 void FastLomb(
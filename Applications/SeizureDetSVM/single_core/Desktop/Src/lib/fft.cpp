@@ -24,6 +24,7 @@
 
 #include "fft.hpp"
 #include "fft_look_up_table.hpp"
+#include "fft_twiddles.hpp"
 
 void Fft (cn pol[], const int n)	{
     static constexpr int rSize = FLOMB_MAX_SIZE >> 1;
@@ -49,3 +50,98 @@ void Fft (cn pol[], const int n)	{
 		}
     }
 }
+
+
+static void BitReverse(cn pol[], const int n) {
+    for (int i = 1, j = 0; i < n; ++i) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            swap(pol[i], pol[j]);
+        }
+    }
+}
+
+// Multiplication by i (the quarter turn W^(n/4) with the sign of the twiddles)
+inline cn MulI(const cn& x) {
+    return {-x.imag, x.real};
+}
+
+void Fft4(cn pol[], const int n) {
+    BitReverse(pol, n);
+
+    // With an odd number of radix-2 stages, the first one is done apart.
+    // Its twiddle is 1, so it needs no multiplications.
+    int hlen = 1;
+    if (__builtin_ctz(n) & 1) {
+        for (int i = 0; i < n; i += 2) {
+            cn odd = pol[i+1];
+            pol[i+1] = pol[i] - odd;
+            pol[i] = pol[i] + odd;
+        }
+        hlen = 2;
+    }
+
+    // Radix-4 stages: each merges the radix-2 stages of half-length hlen
+    // and 2*hlen. After the bit reversal, the four quarters of a block hold
+    // the transforms of the samples congruent to 0, 2, 1 and 3 (mod 4).
+    for (; hlen < n; hlen <<= 2) {
+        const int dis = FLOMB_MAX_SIZE / (4*hlen);
+        for (int i = 0; i < n; i += 4*hlen) {
+            cn* a = pol + i;
+            cn* b = a + hlen;
+            cn* c = b + hlen;
+            cn* d = c + hlen;
+            for (int j = 0, id = 0; j < hlen; ++j, id += dis) {
+                cn t0 = a[j];
+                cn t1 = j ? fastmul(b[j], twiddles[2*id]) : b[j];
+                cn t2 = j ? fastmul(c[j], twiddles[id])   : c[j];
+                cn t3 = j ? fastmul(d[j], twiddles[3*id]) : d[j];
+
+                cn s01 = t0 + t1, d01 = t0 - t1;
+                cn s23 = t2 + t3, d23 = MulI(t2 - t3);
+                a[j] = s01 + s23;
+                b[j] = d01 + d23;
+                c[j] = s01 - s23;
+                d[j] = d01 - d23;
+            }
+        }
+    }
+}
+
+void FftReal(const fixed_t x[], cn out[], const int n) {
+    const int half = n >> 1;
+
+    // Even samples in the real part, odd samples in the imaginary part
+    for (int m = 0; m < half; ++m) {
+        out[m] = {x[2*m], x[2*m+1]};
+    }
+    Fft4(out, half);
+
+    // Split the transforms of the even (E) and odd (O) samples:
+    // X[k] = E[k] + W^k O[k], from Z[k] and conj(Z[half-k])
+    cn z0 = out[0];
+    out[half] = {z0.real - z0.imag, 0};
+    out[0] = {z0.real + z0.imag, 0};
+    const int dis = FLOMB_MAX_SIZE / n;
+    for (int k = 1; k <= half - k; ++k) {
+        cn zk = out[k];
+        cn zr = out[half - k];
+
+        cn ek = {(zk.real + zr.real) >> 1, (zk.imag - zr.imag) >> 1};
+        cn ok = {(zk.imag + zr.imag) >> 1, (zr.real - zk.real) >> 1};
+        cn er = {ek.real, -ek.imag};
+        cn orr = {ok.real, -ok.imag};
+
+        cn wo = fastmul(ok, twiddles[k*dis]);
+        // W^(half-k) = -conj(W^k)
+        cn wr = twiddles[k*dis];
+        cn wor = fastmul(orr, {-wr.real, wr.imag});
+
+        out[k] = ek + wo;
+        out[half - k] = er + wor;
+    }
+}
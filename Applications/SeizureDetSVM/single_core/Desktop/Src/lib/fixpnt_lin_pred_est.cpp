@@ -65,48 +65,61 @@ void ComputeLinPredCoeffs(
 
 //TODO remove printfs
 
-void ComputeLinPredCoeffs(
-    const int32_t* seq,
-    int seqSize,
-    int order,
-    int32_t* alpha,
-    int frac
-) {
+int CorrelationShift(const int32_t* seq, int seqSize) {
     int32_t accShift = 1;
     while ((1<<accShift) < seqSize) {
         accShift += 1;
     }
-    
-    int minLeadingZeroes = 64;
+
+    // clz of the OR of all magnitudes is the minimum of their clz
+    uint32_t magnitudes = 1;
     for (int i = 0; i < seqSize; ++i) {
-        int lz = fx_clz(labs(seq[i]) | 1);
-        if (lz < minLeadingZeroes) {
-            minLeadingZeroes = lz;
-        }
+        magnitudes |= labs(seq[i]);
     }
-    accShift -= 2*minLeadingZeroes;
+    accShift -= 2*fx_clz(magnitudes);
     if (accShift < 0) accShift = 0;
+    return accShift;
+}
 
-    uint64_t corr0 = 0;
-    for (int i = 0; i < seqSize; ++i) {
-        corr0 += ((int64_t)seq[i]*seq[i]) >> accShift;
-    }
+void NormalizeCorrelations(
+    const int64_t* corr,
+    int order,
+    int32_t* norm_corr,
+    int frac
+) {
+    uint64_t corr0 = corr[0];
     int32_t corr0shift = 33;
     while (corr0shift > 0 && (corr0 & (1LL << (30+corr0shift))) == 0) {
         corr0shift -= 1;
     }
 
-    fixed_t norm_corr[order];
+    int32_t rcorr0 = corr0 >> corr0shift;
     for (int i = 1; i <= order; ++i) {
+        int32_t rcorri = corr[i] >> corr0shift;
+        norm_corr[i-1] = fx_divx(rcorri, rcorr0, frac);
+    }
+}
+
+void ComputeLinPredCoeffs(
+    const int32_t* seq,
+    int seqSize,
+    int order,
+    int32_t* alpha,
+    int frac
+) {
+    int accShift = CorrelationShift(seq, seqSize);
+
+    int64_t corr[LPC_MAX_ORDER+1] = {0};
+    for (int i = 0; i <= order; ++i) {
         int64_t corri = 0;
         for (int j = 0; j+i < seqSize; ++j) {
             corri += ((int64_t)seq[j]*seq[j+i]) >> accShift;
         }
-        int32_t rcorr0 = corr0 >> corr0shift;
-        int32_t rcorri = corri >> corr0shift;
-        norm_corr[i-1] = fx_divx(rcorri, rcorr0, frac);
+        corr[i] = corri;
     }
 
+    fixed_t norm_corr[LPC_MAX_ORDER];
+    NormalizeCorrelations(corr, order, norm_corr, frac);
     ComputeLinPredCoeffs(norm_corr, order, alpha, frac);
 }
 
@@ -140,7 +153,7 @@ void ComputeLinPredCoeffs(
         corr0 += ((int64_t)seq[i]*seq[i]) >> accShift;
     }
 
-    fixed_t norm_corr[order];
+    fixed_t norm_corr[LPC_MAX_ORDER];
     for (int i = 1; i <= order; ++i) {
         int32_t corri = 0;
         for (int j = 0; j+i < seqSize; ++j) {
@@ -25,9 +25,13 @@
 extern "C" {
     #include <stdio.h>
     #include <cstdlib>
+    #include <string.h>
 }
 #include "global_config.hpp"
 #include "procedure.hpp"
+#include "incremental.hpp"
+#include "stream.hpp"
+#include "fft_bench.hpp"
 #include "lib/fastlomb.hpp"
 
 #ifndef DATA_ACQUISITION
@@ -36,15 +40,67 @@ int32_t ecgData[WIN_SIZE] = {
 };
 #endif
 
-int main() {
-     
+IncrementalPredictor predictor;
+int32_t hop[NON_OVERLAP_SIZE];
+
+// Hops of inccheck by default: the recording is looped 5 times
+const int INCCHECK_HOPS = 5 * WIN_SIZE / NON_OVERLAP_SIZE;
+
+int main(int argc, char** argv) {
+
+    if (argc > 1 && strcmp(argv[1], "fftbench") == 0) {
+        FftBenchmark();
+        return 0;
+    }
+
+    // IncrementalPredictor against PredictSeizure on every hop: SeizDetSVM inccheck [hops]
+    if (argc > 1 && strcmp(argv[1], "inccheck") == 0) {
+        return CheckIncremental(ecgData, WIN_SIZE, argc > 2 ? atoi(argv[2]) : INCCHECK_HOPS) > 0;
+    }
+
+    // Streams without usable R peaks must give a result for every window
+    if (argc > 1 && strcmp(argv[1], "streamcheck") == 0) {
+        return CheckDegenerateStreams(ecgData, WIN_SIZE);
+    }
+
+    // Stream mode: SeizDetSVM <file|-> [raw] [full]
+    if (argc > 1) {
+        bool raw = false, incremental = true;
+        for (int i = 2; i < argc; ++i) {
+            if (strcmp(argv[i], "raw") == 0) raw = true;
+            if (strcmp(argv[i], "full") == 0) incremental = false;
+        }
+        FILE* in = strcmp(argv[1], "-") == 0 ? stdin : fopen(argv[1], raw ? "rb" : "r");
+        if (in == NULL) {
+            fprintf(stderr, "Cannot open %s\n", argv[1]);
+            return 1;
+        }
+        StreamStats stats = RunEcgStream(
+            in, stdout, raw ? StreamFormat::RAW_INT16 : StreamFormat::CSV, incremental
+        );
+        OutputStreamStats(stdout, stats);
+        if (in != stdin) fclose(in);
+        return 0;
+    }
+
     // Convert to new fixed-point representation
     // Keep in mind input data are 16-bit with 4 bits of decimal part
     for (int i = 0; i < WIN_SIZE; ++i) {
         ecgData[i] = fx_xtox(ecgData[i], ADC_FRAC, ECG_FRAC);
     }
 
-    PredictSeizure((int32_t *)ecgData, WIN_SIZE);
+    if (INCREMENTAL_HOPS > 0) {
+        // Slide the window over the recording, reusing the overlap
+        predictor.Start((int32_t *)ecgData);
+        for (int h = 0; h < INCREMENTAL_HOPS; ++h) {
+            for (int i = 0; i < NON_OVERLAP_SIZE; ++i) {
+                hop[i] = ecgData[(OVERLAP_SIZE + h*NON_OVERLAP_SIZE + NON_OVERLAP_SIZE + i) % WIN_SIZE];
+            }
+            predictor.Advance(hop);
+        }
+    } else {
+        PredictSeizure((int32_t *)ecgData, WIN_SIZE);
+    }
     
 
     return 0;
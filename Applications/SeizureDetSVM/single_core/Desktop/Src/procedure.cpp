@@ -23,6 +23,7 @@
 
 
 #include "procedure.hpp"
+#include <cassert>
 extern "C" {
     #include <stdio.h>
     #include "lib/fixmath.h"
@@ -41,80 +42,131 @@ extern "C" {
 using namespace fixpnt_32b;
 
 
-static fixed_t feature[NUM_FEATURES];
-static fixed_t edrFreqFeat[EDR_NUM_FREQ_FEATS];
-static fixed_t edrLpc[EDR_LPC_ORDER];
-static int16_t rPeak[RPEAK_CAPACITY];
-static int16_t rri[RPEAK_CAPACITY-1];
+FeatureWorkspace::FeatureWorkspace()
+    : lomb(fx_itox(1, FLOMB_FRAC), fx_itox(2, FLOMB_FRAC)) {}
 
-bool PredictSeizure(int32_t* ecg, int ecgSize) {
+
+static FeatureWorkspace workspace;
+
+Decision PredictSeizure(int32_t* ecg, int ecgSize) {
+    return PredictSeizure(workspace, ecg, ecgSize);
+}
+
+Decision PredictSeizure(FeatureWorkspace& ws, int32_t* ecg, int ecgSize) {
+
+    assert(ecgSize <= WIN_SIZE);
 
     // Module 0: Filtering (subtract moving average)
-    remove_moving_average(ecg, ecgSize, MOVING_AVG_WINDOW);
+    size_t mark = ws.scratch.mark();
+    int32_t* movingAvg = ws.scratch.take<int32_t>(ecgSize);
+    assert(movingAvg != nullptr);
+    remove_moving_average(ecg, ecgSize, MOVING_AVG_WINDOW, movingAvg);
+    ws.scratch.release(mark);
 
     // Module 1: R peak delineation
     int rPeakSize;
     DelineateRpeaks<ECG_FREQ>(
         ecg, 
         ecgSize, 
-        rPeak, 
+        ws.rPeak, 
         &rPeakSize, 
         RPEAK_CAPACITY, 
         fx_itox(1500, ECG_FRAC)
     );
+
+    // Module 2: ECG derived respiration (EDR).
+    fixed_t* edr = ws.scratch.take<fixed_t>(rPeakSize);
+    size_t edrMark = ws.scratch.mark();
+    fixed_t* woBaseline = ws.scratch.take<fixed_t>(ecgSize);
+    assert(edr != nullptr && woBaseline != nullptr);
+    EcgDerivedRespiration<ECG_FREQ>(
+        ecg, ecgSize, ws.rPeak, rPeakSize, edr, woBaseline
+    );
+    ws.scratch.release(edrMark);
+
+    Decision decision = PredictFromRpeaks(ws, ws.rPeak, edr, rPeakSize);
+    ws.scratch.release(mark);
+    return decision;
+}
+
+// True if no two consecutive values differ
+template<typename T>
+static bool Constant(const T* x, int size) {
+    for (int i = 1; i < size; ++i) {
+        if (x[i] != x[0]) return false;
+    }
+    return true;
+}
+
+Decision PredictFromRpeaks(
+    FeatureWorkspace& ws, const int16_t* rPeak, const fixed_t* edrEcg, int rPeakSize
+) {
+
+    assert(rPeakSize <= RPEAK_CAPACITY);
+
     int rriSize = rPeakSize - 1;
     for (int i = 0; i < rriSize; ++i) {
-        rri[i] = rPeak[i+1] - rPeak[i];
+        ws.rri[i] = rPeak[i+1] - rPeak[i];
     }
     if (PRINT_DELINEATION) {
         OutputVector(rPeak, rPeakSize, "rPeak");
     }
 
-    // Module 2: ECG derived respiration (EDR).
-    fixed_t edr[rPeakSize];
-    EcgDerivedRespiration<ECG_FREQ, WIN_SIZE>(
-        ecg, ecgSize, rPeak, rPeakSize, edr
-    );
-    if (PRINT_EDR) OutputFixVector(edr, rPeakSize, "edr", ECG_FRAC);
+    if (PRINT_EDR) OutputFixVector(edrEcg, rPeakSize, "edr", ECG_FRAC);
+
+    // The features divide by the spread of the RRI and of the EDR
+    if (rPeakSize < MIN_RPEAKS || Constant(ws.rri, rriSize) || Constant(edrEcg, rPeakSize)) {
+        if (PRINT_PREDICTION) {
+            printf("Prediction: NO_DECISION (%d R peaks)\n", rPeakSize);
+        }
+        return Decision::NO_DECISION;
+    }
+    size_t mark = ws.scratch.mark();
 
     // Extraction of RR interval sequence features
-    RriFeats rriFeats = ExtractRriFeatures(rri, rriSize);
+    RriFeats rriFeats = ExtractRriFeatures(ws.rri, rriSize);
     if (PRINT_RRI_FAST_FEATURES) Output(rriFeats);
 
     // Extraction of RR interval frequency features
-    fixed_t hrv[rriSize];
-    fixed_t rPeakTime[rPeakSize];
+    fixed_t* hrv = ws.scratch.take<fixed_t>(rriSize);
+    fixed_t* rPeakTime = ws.scratch.take<fixed_t>(rPeakSize);
+    assert(hrv != nullptr && rPeakTime != nullptr);
     fx_rdiv_t ifreq;
     fx_invx(fx_itox(ECG_FREQ, FLOMB_FRAC), FLOMB_FRAC, &ifreq);
     for (int i = 0; i < rriSize; ++i) {
-        hrv[i] = fx_itox(ECG_FREQ, FLOMB_FRAC) / rri[i];
+        hrv[i] = fx_itox(ECG_FREQ, FLOMB_FRAC) / ws.rri[i];
         rPeakTime[i] = fx_rdivx(fx_itox(rPeak[i], FLOMB_FRAC), &ifreq);
     }
     rPeakTime[rPeakSize-1] =
         fx_rdivx(fx_itox(rPeak[rPeakSize-1], FLOMB_FRAC), &ifreq);
     RriFreqFeats rriFreqFeats =
-        ExtractRriFreqFeatures(hrv, rPeakTime, rriSize);
+        ExtractRriFreqFeatures(ws.lomb, ws.power, hrv, rPeakTime, rriSize);
     if (PRINT_RRI_FREQ_FEATURES) {
         Output(rriFreqFeats);
     }
 
     // Module 3: Linear prediction coefficients of the EDR signal
-    ComputeLinPredCoeffs(edr, rPeakSize, EDR_LPC_ORDER, edrLpc, LPC_FRAC);
+    ComputeLinPredCoeffs<EDR_LPC_ORDER>(edrEcg, rPeakSize, ws.edrLpc, LPC_FRAC);
     if (PRINT_EDR_LPC)
-        OutputFixVector(edrLpc, EDR_LPC_ORDER, "edrLpc", LPC_FRAC);
+        OutputFixVector(ws.edrLpc, EDR_LPC_ORDER, "edrLpc", LPC_FRAC);
 
     // Extraction of EDR signal frequency features
+    fixed_t* edr = ws.scratch.take<fixed_t>(rPeakSize);
+    assert(edr != nullptr);
     for (int i = 0; i < rPeakSize; ++i) {
-        edr[i] = fx_xtox(edr[i], ECG_FRAC, FLOMB_FRAC);
+        edr[i] = fx_xtox(edrEcg[i], ECG_FRAC, FLOMB_FRAC);
     }
     ExtractEdrFreqFeatures(
-        edr, rPeakTime, rPeakSize, edrFreqFeat, EDR_NUM_FREQ_FEATS
+        ws.lomb, ws.power, edr, rPeakTime, rPeakSize,
+        ws.edrFreqFeat, EDR_NUM_FREQ_FEATS
     );
     if (PRINT_FREQ_EDR) OutputFixVector(
-        edrFreqFeat, EDR_NUM_FREQ_FEATS, "edrFreqFeat", FLOMB_FRAC
+        ws.edrFreqFeat, EDR_NUM_FREQ_FEATS, "edrFreqFeat", FLOMB_FRAC
     );
+    ws.scratch.release(mark);
 
     // Module 4: Support Vector Machine
+    fixed_t* feature = ws.feature;
     feature[0] = fx_xtox(rriFeats.stats.mean, RRI_FRAC, SVM_FRAC);
     feature[1] = fx_xtox(rriFeats.stats.stdDev, RRI_FRAC, SVM_FRAC);
     feature[2] = fx_xtox(
@@ -135,11 +187,11 @@ bool PredictSeizure(int32_t* ecg, int ecgSize) {
     feature[13] = fx_xtox(rriFeats.lorenz.modCsi, RRI_FRAC, SVM_FRAC);
     feature[14] = fx_xtox(rriFeats.lorenz.cvi, RRI_FRAC, SVM_FRAC);
     for (int i = 0; i < EDR_NUM_FREQ_FEATS; ++i) {
-        feature[15+i] = fx_xtox(edrFreqFeat[i], FLOMB_FRAC, SVM_FRAC);
+        feature[15+i] = fx_xtox(ws.edrFreqFeat[i], FLOMB_FRAC, SVM_FRAC);
     }
     for (int i = 0; i < EDR_LPC_ORDER; ++i) {
         feature[15+EDR_NUM_FREQ_FEATS+i] =
-            fx_xtox(edrLpc[i], LPC_FRAC, SVM_FRAC);
+            fx_xtox(ws.edrLpc[i], LPC_FRAC, SVM_FRAC);
     }
     if (PRINT_FEATURES) {
         for (int i = 0; i < NUM_FEATURES; ++i) {
@@ -155,7 +207,7 @@ bool PredictSeizure(int32_t* ecg, int ecgSize) {
         }
     }
 
-    fixed_t out = predict(feature);
+    fixed_t out = SVM_COLUMN_MAJOR? predictColumn(feature) : predict(feature);
     bool seizure = out > 0;
     if (PRINT_SVM) {
         OutputFixVector(&out, 1, "svm", SVM_FRAC);
@@ -164,5 +216,5 @@ bool PredictSeizure(int32_t* ecg, int ecgSize) {
         printf("Prediction: %s\n", seizure? "SEIZURE" : "NON_SEIZURE");
     }
     
-    return seizure;
+    return seizure? Decision::SEIZURE : Decision::NON_SEIZURE;
 }
@@ -97,20 +97,16 @@ RriFeats ExtractRriFeatures(const int16_t* rri, int size) {
 }
 
 // Frequency Features ─────────────────────────────────────────────────────────
-fixed_t *power;
-
 RriFreqFeats ExtractRriFreqFeatures(
+    FastLombPlan& plan,
+    fixed_t* power,
     const fixed_t* hrv,
     const fixed_t* rriTime,
     int rriSize
 ) {
-    const fixed_t maxFreq = fx_itox(1, FLOMB_FRAC); // Hz
     const fixed_t timeSpan = FastLomb_timeSpan(rriTime, rriSize); // s
     // const fixed_t timeSpan = 60; // s
-    const fixed_t ofac = fx_itox(2, FLOMB_FRAC);
 
-    power = (fixed_t *) malloc(sizeof(fixed_t) * (FLOMB_MAX_SIZE/2));
-    
     // Computing square integral as total power
     RriFreqFeats feats;
     feats.totPow = 0;
@@ -119,9 +115,9 @@ RriFreqFeats ExtractRriFreqFeatures(
     }
     feats.totPow = fx_divx(feats.totPow, timeSpan, FLOMB_FRAC);
 
-    int nfs = FastLomb_numFreqs(maxFreq, timeSpan, ofac);
-    FastLomb_(hrv, rriTime, rriSize, timeSpan, maxFreq, power, ofac);
-    fixed_t deltaFreq = FastLomb_deltaFreq(timeSpan, ofac);
+    int nfs = plan.numFreqs(timeSpan);
+    plan.run(hrv, rriTime, rriSize, timeSpan, power);
+    fixed_t deltaFreq = plan.deltaFreq(timeSpan);
 
     // Sum frequencies
 
@@ -0,0 +1,197 @@
+/*
+ *  Copyright (c) [2024] [Embedded Systems Laboratory (ESL), EPFL]
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License);
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an AS IS BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////////////////////////
+// Author:          ESL team                    //
+// Optimizations:   Dimitrios Samakovlis        //
+/////////////////////////////////////////////////
+
+
+
+
+#include "stream.hpp"
+extern "C" {
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <time.h>
+    #include "lib/fixmath.h"
+}
+#include "global_config.hpp"
+#include "procedure.hpp"
+#include "incremental.hpp"
+
+static int32_t ring[WIN_SIZE];
+static int32_t window[WIN_SIZE];
+static IncrementalPredictor predictor;
+
+static bool ReadSample(FILE* in, StreamFormat format, int32_t* sample) {
+    if (format == StreamFormat::RAW_INT16) {
+        int16_t v;
+        if (fread(&v, sizeof(v), 1, in) != 1) return false;
+        *sample = v;
+    } else {
+        int v;
+        if (fscanf(in, "%d ,", &v) != 1) return false;
+        *sample = v;
+    }
+    return true;
+}
+
+// Copies the last n samples of the ring (ending before head) to dst.
+static void Unroll(int head, int n, int32_t* dst) {
+    int start = (head - n + WIN_SIZE) % WIN_SIZE;
+    for (int i = 0; i < n; ++i) {
+        dst[i] = ring[(start + i) % WIN_SIZE];
+    }
+}
+
+static double Now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static int CompareDouble(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static const char* DecisionName(Decision decision) {
+    switch (decision) {
+        case Decision::SEIZURE: return "SEIZURE";
+        case Decision::NON_SEIZURE: return "NON_SEIZURE";
+        default: return "NO_DECISION";
+    }
+}
+
+// Nearest-rank percentile of n sorted values
+static double Percentile(const double* sorted, int n, int p) {
+    if (n == 0) return 0;
+    int rank = (p * n + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+StreamStats RunEcgStream(FILE* in, FILE* out, StreamFormat format, bool incremental) {
+    StreamStats stats = {0, 0, 0, 0, 0, 0, 0};
+    int capacity = 1024;
+    double* latency = (double*) malloc(capacity * sizeof(double));
+
+    long samples = 0;
+    int head = 0;
+    int32_t sample;
+    while (ReadSample(in, format, &sample)) {
+        // Keep in mind input data are 16-bit with 4 bits of decimal part
+        ring[head] = fx_xtox(sample, ADC_FRAC, ECG_FRAC);
+        head = (head + 1) % WIN_SIZE;
+        ++samples;
+        if (samples < WIN_SIZE || (samples - WIN_SIZE) % NON_OVERLAP_SIZE != 0) {
+            continue;
+        }
+
+        double start = Now();
+        Decision decision;
+        if (!incremental) {
+            Unroll(head, WIN_SIZE, window);
+            decision = PredictSeizure(window, WIN_SIZE);
+        } else if (samples == WIN_SIZE) {
+            Unroll(head, WIN_SIZE, window);
+            decision = predictor.Start(window);
+        } else {
+            Unroll(head, NON_OVERLAP_SIZE, window);
+            decision = predictor.Advance(window);
+        }
+        double ms = (Now() - start) * 1e3;
+
+        if (stats.predictions == capacity) {
+            capacity *= 2;
+            latency = (double*) realloc(latency, capacity * sizeof(double));
+        }
+        latency[stats.predictions++] = ms;
+        stats.seizures += decision == Decision::SEIZURE;
+        stats.noDecisions += decision == Decision::NO_DECISION;
+
+        fprintf(out, "%10.1f s  %-11s  %8.3f ms\n",
+                (double) samples / ECG_FREQ, DecisionName(decision), ms);
+        fflush(out);
+    }
+
+    qsort(latency, stats.predictions, sizeof(double), CompareDouble);
+    stats.p50 = Percentile(latency, stats.predictions, 50);
+    stats.p90 = Percentile(latency, stats.predictions, 90);
+    stats.p99 = Percentile(latency, stats.predictions, 99);
+    stats.max = stats.predictions > 0 ? latency[stats.predictions - 1] : 0;
+    free(latency);
+
+    return stats;
+}
+
+void OutputStreamStats(FILE* out, const StreamStats& stats) {
+    fprintf(out, "Predictions: %d (%d seizure, %d no decision)\n",
+            stats.predictions, stats.seizures, stats.noDecisions);
+    fprintf(out, "Latency [p50, p90, p99, max] (ms) = [%.3f %.3f %.3f %.3f]\n",
+            stats.p50, stats.p90, stats.p99, stats.max);
+    if (stats.p99 > 0) {
+        // Every prediction has NON_OVERLAP_SIZE_S seconds to finish
+        fprintf(out, "Real-time streams per core (p99): %.0f\n",
+                NON_OVERLAP_SIZE_S * 1e3 / stats.p99);
+    }
+}
+
+enum CheckInput { FLAT, NOISE, DROPOUT, NUM_CHECK_INPUTS };
+
+int CheckDegenerateStreams(const int32_t* ecg, int size) {
+    const char* names[NUM_CHECK_INPUTS] = {"flat", "noise", "dropout"};
+    const int hops = 4;
+    const int length = WIN_SIZE + hops * NON_OVERLAP_SIZE;
+    int failures = 0;
+
+    for (int input = FLAT; input < NUM_CHECK_INPUTS; ++input) {
+        // The stream is written as RAW_INT16 to a temporary file
+        FILE* in = tmpfile();
+        FILE* out = tmpfile();
+        if (in == NULL || out == NULL) {
+            fprintf(stderr, "Cannot create temporary files\n");
+            return 1;
+        }
+        unsigned seed = 1;
+        for (int i = 0; i < length; ++i) {
+            int16_t v = 0;
+            if (input == NOISE) {
+                seed = seed * 1103515245u + 12345u;
+                v = (int16_t)((int32_t)(seed >> 8) % 2000);
+            } else if (input == DROPOUT &&
+                       (i < length / 3 || i >= 2 * length / 3)) {
+                v = (int16_t) ecg[i % size];
+            }
+            fwrite(&v, sizeof(v), 1, in);
+        }
+
+        for (int incremental = 1; incremental >= 0; --incremental) {
+            rewind(in);
+            StreamStats stats = RunEcgStream(in, out, StreamFormat::RAW_INT16, incremental);
+            bool pass = stats.predictions == hops + 1 &&
+                (input != FLAT || stats.noDecisions == stats.predictions);
+            printf("%-8s %-12s %d windows, %d no decision: %s\n",
+                   names[input], incremental ? "incremental" : "full",
+                   stats.predictions, stats.noDecisions, pass ? "PASS" : "FAIL");
+            failures += !pass;
+        }
+        fclose(in);
+        fclose(out);
+    }
+    return failures > 0;
+}
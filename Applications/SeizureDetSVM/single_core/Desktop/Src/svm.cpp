@@ -54,3 +54,63 @@ fixed_t predict(fixed_t* feat) {
     return sum;
 }
 
+
+// Support vectors stored feature-major: col[j][i] = svmVect[i][j],
+// transposed by the static initializer, before main
+struct SvmColumns {
+    SvmColumns() {
+        for (int i = 0; i < SVM_SIZE; ++i) {
+            for (int j = 0; j < NUM_FEATURES; ++j) {
+                col[j][i] = svmVect[i][j];
+            }
+        }
+    }
+
+    int32_t col[NUM_FEATURES][SVM_SIZE];
+};
+
+static const SvmColumns svmVectCol;
+
+static void normalize(fixed_t* feat) {
+    for (int i = 0; i < NUM_FEATURES; ++i) {
+        feat[i] -= meanFeat[i];
+        feat[i] = fx_mulx(feat[i], scaleFeat[i], SVM_FRAC);
+    }
+}
+
+static fixed_t decision(const fixed_t* feat) {
+    // Squared distances to all the support vectors, one feature at a time.
+    // Each term is fx_mulx(aux, aux, SVM_FRAC), computed from |aux| with an
+    // unsigned 32x32->64 multiply (available in SSE2) so the loop vectorizes.
+    uint32_t norm[SVM_SIZE] = {0};
+    for (int j = 0; j < NUM_FEATURES; ++j) {
+        const fixed_t x = feat[j];
+        const int32_t* sv = svmVectCol.col[j];
+        for (int i = 0; i < SVM_SIZE; ++i) {
+            fixed_t aux = x - sv[i];
+            uint32_t mag = aux < 0 ? -(uint32_t) aux : (uint32_t) aux;
+            uint64_t sq = (uint64_t) mag * mag;
+            norm[i] += (uint32_t) (((sq >> (SVM_FRAC - 1)) + 1) >> 1);
+        }
+    }
+
+    fixed_t sum = bias;
+    for (int i = 0; i < SVM_SIZE; ++i) {
+        fixed_t exp = fx_expx(-(fixed_t) norm[i], SVM_FRAC);
+        sum += fx_mulx(alpha[i], exp, SVM_FRAC);
+    }
+    return sum;
+}
+
+fixed_t predictColumn(fixed_t* feat) {
+    normalize(feat);
+    return decision(feat);
+}
+
+void predictBatch(fixed_t* feats, int n, fixed_t* out) {
+    for (int b = 0; b < n; ++b) {
+        fixed_t* feat = feats + b * NUM_FEATURES;
+        normalize(feat);
+        out[b] = decision(feat);
+    }
+}